@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/device/device_gemm.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/tensor_operation_instance/gpu/gemm.hpp"
+#include "ck/library/tensor_operation_instance/device_operation_instance_registry.hpp"
+
+using F16 = ck::half_t;
+
+using Row = ck::tensor_layout::gemm::RowMajor;
+using Col = ck::tensor_layout::gemm::ColumnMajor;
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+using DeviceOp = ck::tensor_operation::device::
+    DeviceGemm<Row, Col, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>;
+
+using ck::tensor_operation::device::instance::DeviceOperationInstanceFactory;
+using ck::tensor_operation::device::instance::DeviceOperationInstanceMetadata;
+using ck::tensor_operation::device::instance::DeviceOperationInstanceRegistry;
+
+constexpr int NumRepeat = 100;
+
+// average time [us] of f() over NumRepeat calls
+template <typename F>
+double time_us(F&& f)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    for(int i = 0; i < NumRepeat; ++i)
+        f();
+
+    const auto stop = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::micro>(stop - start).count() / NumRepeat;
+}
+
+// Micro-benchmark of instance lookup: constructing all instances with the factory on every lookup,
+// against filtering the instances cached by DeviceOperationInstanceRegistry on their descriptors.
+// No kernel is launched.
+int main()
+{
+    // only instances with 256 threads and 128 x 128 tiles
+    auto pred = [](const DeviceOperationInstanceMetadata& metadata) {
+        const auto* block_size  = metadata.descriptor_.Get<int64_t>("BlockSize");
+        const auto* m_per_block = metadata.descriptor_.Get<int64_t>("MPerBlock");
+        const auto* n_per_block = metadata.descriptor_.Get<int64_t>("NPerBlock");
+
+        return block_size != nullptr && *block_size == 256 && m_per_block != nullptr &&
+               *m_per_block == 128 && n_per_block != nullptr && *n_per_block == 128;
+    };
+
+    std::size_t num_factory_instances = 0;
+
+    const double factory_us = time_us([&] {
+        num_factory_instances = DeviceOperationInstanceFactory<DeviceOp>::GetInstances().size();
+    });
+
+    const auto first_lookup_start = std::chrono::steady_clock::now();
+
+    auto& registry = DeviceOperationInstanceRegistry<DeviceOp>::GetInstance();
+
+    const double first_lookup_us = std::chrono::duration<double, std::micro>(
+                                       std::chrono::steady_clock::now() - first_lookup_start)
+                                       .count();
+
+    std::size_t num_registry_instances = 0;
+
+    const double registry_us =
+        time_us([&] { num_registry_instances = registry.GetInstances(pred).size(); });
+
+    const uint64_t hash =
+        registry.GetNumInstances() > 0 ? registry.GetMetadata()[0].hash_ : uint64_t{0};
+
+    const double find_us = time_us([&] { (void)registry.FindByHash(hash); });
+
+    std::cout << "factory GetInstances(): " << num_factory_instances << " instances, "
+              << factory_us << " us" << std::endl;
+    std::cout << "registry first use: " << first_lookup_us << " us" << std::endl;
+    std::cout << "registry GetInstances(pred): " << num_registry_instances << " instances, "
+              << registry_us << " us" << std::endl;
+    std::cout << "registry FindByHash(): " << find_us << " us" << std::endl;
+
+    return 0;
+}
@@ -18,8 +18,11 @@
 #include "ck/library/utility/device_memory.hpp"
 #include "ck/library/utility/fill.hpp"
 #include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_random.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
 #include "ck/library/utility/literals.hpp"
+#include "ck/library/utility/perf_db.hpp"
+#include "ck/library/utility/reference_cache.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
 
 struct ProblemSize final
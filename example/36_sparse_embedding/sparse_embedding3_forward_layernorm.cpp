@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: MIT
 // Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
 
+#include <chrono>
 #include <iostream>
 #include <numeric>
 #include <initializer_list>
@@ -17,7 +18,7 @@
 #include "ck/library/utility/host_common_util.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
-#include "ck/library/reference_tensor_operation/cpu/reference_sparse_embedding3_forward_layernorm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_sparse_embeddings_forward_layernorm.hpp"
 
 // clang-format off
 using EmbType       = ck::half_t;
@@ -67,15 +68,16 @@ int main()
     };
 
     using ReferenceInstance =
-        ck::tensor_operation::host::ReferenceSparseEmbedding3ForwardLayernorm<EmbType,
+        ck::tensor_operation::host::ReferenceSparseEmbeddingsForwardLayernorm<EmbType,
                                                                               IndexType,
                                                                               GammaDataType,
                                                                               BetaDataType,
                                                                               AccDataType,
-                                                                              OutType>;
+                                                                              OutType,
+                                                                              3>;
 
     ck::static_for<0, dims.Size(), 1>{}([&](auto I) {
-        std::srand(std::time(nullptr));
+        ck::utils::set_host_random_seed(std::time(nullptr));
         constexpr auto current_dim = dims.At(I);
         Tensor<EmbType> emb_a(f_host_tensor_desc_2d(num_rows, current_dim));
         Tensor<EmbType> emb_b(f_host_tensor_desc_2d(num_rows, current_dim));
@@ -155,17 +157,14 @@ int main()
         auto invoker_ptr = device_instance.MakeInvokerPointer();
         float time_ms    = invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
 
-        bool pass = true;
+        bool pass         = true;
+        float ref_time_ms = 0;
         {
             Tensor<OutType> out_from_dev(f_host_tensor_desc_2d(index_length, current_dim));
             ReferenceInstance ref;
             auto ref_argument = ref.MakeArgument(out,
-                                                 emb_a,
-                                                 emb_b,
-                                                 emb_c,
-                                                 index_a,
-                                                 index_b,
-                                                 index_c,
+                                                 {emb_a, emb_b, emb_c},
+                                                 {index_a, index_b, index_c},
                                                  gamma,
                                                  beta,
                                                  num_rows,
@@ -173,7 +172,12 @@ int main()
                                                  index_length,
                                                  epsilon);
             auto ref_invoker  = ref.MakeInvoker();
+
+            const auto ref_start = std::chrono::steady_clock::now();
             ref_invoker.Run(ref_argument);
+            ref_time_ms = std::chrono::duration<float, std::milli>(
+                              std::chrono::steady_clock::now() - ref_start)
+                              .count();
 
             out_dev.FromDevice(out_from_dev.mData.data());
             pass &= ck::utils::check_err(out_from_dev, out, "Error: Incorrect results", 1e-3, 1e-3);
@@ -186,7 +190,8 @@ int main()
         double gbps        = (total_read + total_write) / time_ms / 1e6;
 
         std::cout << ", total bytes:" << (total_read + total_write) << ", time:" << time_ms
-                  << ", gbps:" << gbps << ", valid:" << (pass ? "y" : "n") << std::endl
+                  << ", gbps:" << gbps << ", host reference time:" << ref_time_ms
+                  << ", valid:" << (pass ? "y" : "n") << std::endl
                   << std::flush;
     });
 
@@ -0,0 +1,40 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <chrono>
+
+#include "ck/stream_config.hpp"
+
+// Host counterpart of launch_and_time_kernel() for operators running on the CPU: kernel() is run
+// once, or, when timing, cold_niters_ times to warm up the caches and the threads, then nrepeat_
+// times. Returns the mean time of the timed runs in ms, 0 when not timing.
+template <typename F>
+float launch_and_time_host_kernel(const StreamConfig& stream_config, F&& kernel)
+{
+    if(!stream_config.time_kernel_)
+    {
+        kernel();
+
+        return 0;
+    }
+
+    for(int i = 0; i < stream_config.cold_niters_; ++i)
+    {
+        kernel();
+    }
+
+    const int nrepeat = stream_config.nrepeat_ > 0 ? stream_config.nrepeat_ : 1;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for(int i = 0; i < nrepeat; ++i)
+    {
+        kernel();
+    }
+
+    const auto stop = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<float, std::milli>(stop - start).count() / nrepeat;
+}
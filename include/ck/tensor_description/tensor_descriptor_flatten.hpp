@@ -0,0 +1,685 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include "ck/utility/common_header.hpp"
+#include "ck/tensor_description/tensor_descriptor.hpp"
+#include "ck/tensor_description/multi_index_transform_helper.hpp"
+
+namespace ck {
+namespace detail {
+
+template <typename Transform>
+struct is_merge_transform : integral_constant<bool, false>
+{
+};
+
+template <typename LowLengths>
+struct is_merge_transform<Merge_v1_carry_check<LowLengths>> : integral_constant<bool, true>
+{
+};
+
+template <typename LowLengths>
+struct is_merge_transform<Merge_v2_magic_division<LowLengths>> : integral_constant<bool, true>
+{
+};
+
+template <typename LowLengths>
+struct is_merge_transform<Merge_v2r2_magic_division<LowLengths>> : integral_constant<bool, true>
+{
+};
+
+template <typename LowLengths>
+struct is_merge_transform<Merge_v3_division_mod<LowLengths>> : integral_constant<bool, true>
+{
+};
+
+template <typename Transform>
+struct is_unmerge_transform : integral_constant<bool, false>
+{
+};
+
+template <typename UpLengths, bool Use24BitIntegerCalculation>
+struct is_unmerge_transform<UnMerge<UpLengths, Use24BitIntegerCalculation>>
+    : integral_constant<bool, true>
+{
+};
+
+// Transforms of one lower dimension, affine in the upper index, and mapping every valid upper
+// index to a valid lower index, e.g. PassThrough, Embed, UnMerge, Slice, Freeze, Vectorize, and
+// pads which skip the validity check
+template <typename Transform>
+struct is_affine_transform
+{
+    static constexpr bool value = Transform::GetNumOfLowerDimension() == 1 &&
+                                  Transform::IsLinearTransform() &&
+                                  Transform::IsValidUpperIndexAlwaysMappedToValidLowerIndex();
+};
+
+// the 24-bit multiplications wrap around
+template <typename UpLengths>
+struct is_affine_transform<UnMerge<UpLengths, true>> : integral_constant<bool, false>
+{
+};
+
+// affine transforms mapping the upper index 0 to the lower index 0
+template <typename Transform>
+struct is_offset_free_transform : integral_constant<bool, false>
+{
+};
+
+template <typename LowLength>
+struct is_offset_free_transform<PassThrough<LowLength>> : integral_constant<bool, true>
+{
+};
+
+template <typename UpLengths, typename Coefficients>
+struct is_offset_free_transform<Embed<UpLengths, Coefficients>> : integral_constant<bool, true>
+{
+};
+
+template <typename UpLengths>
+struct is_offset_free_transform<UnMerge<UpLengths, false>> : integral_constant<bool, true>
+{
+};
+
+template <typename VectorSize, typename UpLength>
+struct is_offset_free_transform<Vectorize<VectorSize, UpLength>> : integral_constant<bool, true>
+{
+};
+
+template <typename TensorDesc, index_t ITran>
+using tensor_descriptor_transform_t =
+    remove_cvref_t<decltype(TensorDesc{}.GetTransforms().At(Number<ITran>{}))>;
+
+// both lengths are known at compile-time and equal
+template <typename XLengths, typename YLengths>
+__host__ __device__ constexpr bool is_known_equal_lengths()
+{
+    if constexpr(XLengths::Size() == YLengths::Size() &&
+                 is_known_at_compile_time<XLengths>::value &&
+                 is_known_at_compile_time<YLengths>::value)
+    {
+        bool equal = true;
+
+        static_for<0, XLengths::Size(), 1>{}(
+            [&](auto i) { equal &= XLengths{}.At(i).value == YLengths{}.At(i).value; });
+
+        return equal;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+template <index_t... Is>
+__host__ __device__ constexpr index_t sequence_count_less(Sequence<Is...>, index_t x)
+{
+    return (0 + ... + (Is < x ? 1 : 0));
+}
+
+// make_tuple(itran, idim_up, found): the transform of which the hidden dimension is an upper
+// dimension, and its position in the upper dimensions
+template <typename TensorDesc>
+__host__ __device__ constexpr auto get_producing_transform(index_t idim_hidden)
+{
+    index_t itran_found   = 0;
+    index_t idim_up_found = 0;
+    bool found            = false;
+
+    static_for<0, TensorDesc::GetNumOfTransform(), 1>{}([&](auto itran) {
+        constexpr auto up_dim_ids = TensorDesc::GetUpperDimensionIdss().At(itran);
+
+        static_for<0, up_dim_ids.Size(), 1>{}([&](auto idim_up) {
+            if(up_dim_ids.At(idim_up) == idim_hidden)
+            {
+                itran_found   = itran;
+                idim_up_found = idim_up;
+                found         = true;
+            }
+        });
+    });
+
+    return make_tuple(itran_found, idim_up_found, found);
+}
+
+// make_tuple(found, itran_first, itran_second): the first pair of a Merge followed by an UnMerge
+// of its upper dimension, or of an UnMerge followed by a Merge of all its upper dimensions in the
+// same order, with the same lengths known at compile-time. The pair is an identity.
+template <typename TensorDesc>
+__host__ __device__ constexpr auto find_cancelling_merge_unmerge()
+{
+    bool found           = false;
+    index_t itran_first  = 0;
+    index_t itran_second = 0;
+
+    static_for<0, TensorDesc::GetNumOfTransform(), 1>{}([&](auto itran) {
+        using Tran = tensor_descriptor_transform_t<TensorDesc, itran>;
+
+        constexpr auto low_dim_ids = TensorDesc::GetLowerDimensionIdss().At(itran);
+
+        if constexpr(is_merge_transform<Tran>::value || is_unmerge_transform<Tran>::value)
+        {
+            constexpr auto tmp = get_producing_transform<TensorDesc>(low_dim_ids.At(Number<0>{}));
+
+            constexpr index_t iprev = tmp[Number<0>{}];
+
+            if constexpr(tmp[Number<2>{}])
+            {
+                using Prev = tensor_descriptor_transform_t<TensorDesc, iprev>;
+
+                constexpr auto prev_up_dim_ids =
+                    TensorDesc::GetUpperDimensionIdss().At(Number<iprev>{});
+
+                bool cancel = false;
+
+                if constexpr(is_merge_transform<Prev>::value && is_unmerge_transform<Tran>::value)
+                {
+                    cancel = is_known_equal_lengths<decltype(Prev::low_lengths_),
+                                                    decltype(Tran::up_lengths_)>();
+                }
+                else if constexpr(is_unmerge_transform<Prev>::value &&
+                                  is_merge_transform<Tran>::value &&
+                                  is_same<decltype(prev_up_dim_ids), decltype(low_dim_ids)>::value)
+                {
+                    cancel = is_known_equal_lengths<decltype(Prev::up_lengths_),
+                                                    decltype(Tran::low_lengths_)>();
+                }
+
+                if(cancel && !found)
+                {
+                    found        = true;
+                    itran_first  = iprev;
+                    itran_second = itran;
+                }
+            }
+        }
+    });
+
+    return make_tuple(found, itran_first, itran_second);
+}
+
+// Descriptor of the transforms, with the hidden dimension ids renumbered from 0 in the same order,
+// so that ids left unused by the removed transforms are dropped. Id 0 stays the offset.
+template <typename Transforms,
+          typename LowerDimensionIdss,
+          typename UpperDimensionIdss,
+          typename VisibleDimensionIds,
+          typename ElementSpaceSize>
+__host__ __device__ constexpr auto
+make_tensor_descriptor_with_compact_hidden_ids(const Transforms& transforms,
+                                               LowerDimensionIdss,
+                                               UpperDimensionIdss,
+                                               VisibleDimensionIds,
+                                               const ElementSpaceSize& element_space_size)
+{
+    constexpr auto all_low_dim_ids = unpack(
+        [](auto&&... xs) constexpr { return merge_sequences(xs...); }, LowerDimensionIdss{});
+
+    constexpr auto all_up_dim_ids = unpack(
+        [](auto&&... xs) constexpr { return merge_sequences(xs...); }, UpperDimensionIdss{});
+
+    using AllDimIds = typename sequence_unique_sort<decltype(merge_sequences(all_low_dim_ids,
+                                                                             all_up_dim_ids)),
+                                                    math::less<index_t>,
+                                                    math::equal<index_t>>::type;
+
+    auto compact = [](auto dim_ids) constexpr {
+        return transform_sequences(
+            [](index_t id) constexpr { return sequence_count_less(AllDimIds{}, id); }, dim_ids);
+    };
+
+    constexpr auto low_dim_idss = transform_tuples(compact, LowerDimensionIdss{});
+    constexpr auto up_dim_idss  = transform_tuples(compact, UpperDimensionIdss{});
+    constexpr auto visible_ids  = compact(VisibleDimensionIds{});
+
+    return TensorDescriptor<remove_cv_t<Transforms>,
+                            remove_cv_t<decltype(low_dim_idss)>,
+                            remove_cv_t<decltype(up_dim_idss)>,
+                            remove_cv_t<decltype(visible_ids)>,
+                            remove_cv_t<ElementSpaceSize>>{transforms, element_space_size};
+}
+
+// Descriptor with each transform replaced by the transforms, lower idss and upper idss of
+// f_replace(itran), a tuple of three tuples
+template <typename TensorDesc, typename F>
+__host__ __device__ constexpr auto replace_transforms(const TensorDesc& desc, F f_replace)
+{
+    const auto parts = generate_tuple(f_replace, Number<TensorDesc::GetNumOfTransform()>{});
+
+    const auto transforms = unpack(
+        [](const auto&... xs) { return container_concat(xs.At(Number<0>{})...); }, parts);
+
+    const auto low_dim_idss = unpack(
+        [](const auto&... xs) { return container_concat(xs.At(Number<1>{})...); }, parts);
+
+    const auto up_dim_idss = unpack(
+        [](const auto&... xs) { return container_concat(xs.At(Number<2>{})...); }, parts);
+
+    return make_tensor_descriptor_with_compact_hidden_ids(transforms,
+                                                          low_dim_idss,
+                                                          up_dim_idss,
+                                                          TensorDesc::GetVisibleDimensionIds(),
+                                                          desc.GetElementSpaceSize());
+}
+
+template <typename TensorDesc, index_t ITran>
+__host__ __device__ constexpr auto keep_transform(const TensorDesc& desc, Number<ITran> itran)
+{
+    return make_tuple(make_tuple(desc.GetTransforms().At(itran)),
+                      make_tuple(TensorDesc::GetLowerDimensionIdss().At(itran)),
+                      make_tuple(TensorDesc::GetUpperDimensionIdss().At(itran)));
+}
+
+// replaces the Merge and UnMerge pair by PassThrough
+template <index_t IFirst, index_t ISecond, typename TensorDesc>
+__host__ __device__ constexpr auto cancel_merge_unmerge(const TensorDesc& desc)
+{
+    return replace_transforms(desc, [&](auto itran) {
+        if constexpr(itran == IFirst)
+        {
+            return make_tuple(Tuple<>{}, Tuple<>{}, Tuple<>{});
+        }
+        else if constexpr(itran == ISecond)
+        {
+            using First = tensor_descriptor_transform_t<TensorDesc, IFirst>;
+
+            constexpr auto first_low_dim_ids =
+                TensorDesc::GetLowerDimensionIdss().At(Number<IFirst>{});
+            constexpr auto second_up_dim_ids =
+                TensorDesc::GetUpperDimensionIdss().At(Number<ISecond>{});
+
+            if constexpr(is_merge_transform<First>::value)
+            {
+                // the lower dimensions of the Merge are the upper dimensions of the UnMerge
+                constexpr index_t ndim = first_low_dim_ids.Size();
+
+                const auto& low_lengths = desc.GetTransforms().At(Number<IFirst>{}).low_lengths_;
+
+                return make_tuple(generate_tuple(
+                                      [&](auto i) {
+                                          return make_pass_through_transform(low_lengths.At(i));
+                                      },
+                                      Number<ndim>{}),
+                                  generate_tuple(
+                                      [&](auto i) {
+                                          return Sequence<TensorDesc::GetLowerDimensionIdss()
+                                                              .At(Number<IFirst>{})
+                                                              .At(i)>{};
+                                      },
+                                      Number<ndim>{}),
+                                  generate_tuple(
+                                      [&](auto i) {
+                                          return Sequence<TensorDesc::GetUpperDimensionIdss()
+                                                              .At(Number<ISecond>{})
+                                                              .At(i)>{};
+                                      },
+                                      Number<ndim>{}));
+            }
+            else
+            {
+                // the lower dimension of the UnMerge is the upper dimension of the Merge
+                const auto& second = desc.GetTransforms().At(Number<ISecond>{});
+
+                const auto up_length = second.GetUpperLengths().At(Number<0>{});
+
+                return make_tuple(make_tuple(make_pass_through_transform(up_length)),
+                                  make_tuple(first_low_dim_ids),
+                                  make_tuple(second_up_dim_ids));
+            }
+        }
+        else
+        {
+            return keep_transform(desc, itran);
+        }
+    });
+}
+
+// For each transform, the hidden dimension at the root of the affine transforms stacked on it:
+// its lower dimension if it is the offset or the upper dimension of a transform which is not
+// affine, the root of the transform of its lower dimension otherwise. -1 if it is not affine.
+template <typename TensorDesc>
+__host__ __device__ constexpr auto get_affine_roots()
+{
+    constexpr index_t ntransform = TensorDesc::GetNumOfTransform();
+
+    Array<index_t, ntransform> roots{};
+
+    static_for<0, ntransform, 1>{}([&](auto itran) {
+        roots(itran) = -1;
+
+        if constexpr(is_affine_transform<tensor_descriptor_transform_t<TensorDesc, itran>>::value)
+        {
+            constexpr index_t idim_low =
+                TensorDesc::GetLowerDimensionIdss().At(itran).At(Number<0>{});
+
+            constexpr auto tmp = get_producing_transform<TensorDesc>(idim_low);
+
+            constexpr index_t iprev = tmp[Number<0>{}];
+            constexpr bool found    = tmp[Number<2>{}];
+
+            roots(itran) = found && roots[iprev] >= 0 ? roots[iprev] : idim_low;
+        }
+    });
+
+    return roots;
+}
+
+// make_tuple(size, ids): the transforms of the root, in order
+template <typename TensorDesc>
+__host__ __device__ constexpr auto get_affine_group(index_t root)
+{
+    constexpr index_t ntransform = TensorDesc::GetNumOfTransform();
+    constexpr auto roots         = get_affine_roots<TensorDesc>();
+
+    Array<index_t, ntransform> ids{};
+    index_t size = 0;
+
+    for(index_t itran = 0; itran < ntransform; ++itran)
+    {
+        if(roots[itran] == root)
+        {
+            ids(size++) = itran;
+        }
+    }
+
+    return make_tuple(size, ids);
+}
+
+// make_tuple(size, ids): the upper dimensions of the transforms of the root which are not lower
+// dimensions of any of them, in order
+template <typename TensorDesc>
+__host__ __device__ constexpr auto get_affine_group_upper_dimensions(index_t root)
+{
+    constexpr index_t ndim_hidden = TensorDesc::GetNumOfHiddenDimension();
+    constexpr auto roots          = get_affine_roots<TensorDesc>();
+
+    Array<bool, ndim_hidden> is_up{};
+    Array<bool, ndim_hidden> is_low{};
+
+    static_for<0, TensorDesc::GetNumOfTransform(), 1>{}([&](auto itran) {
+        if(roots[itran] == root)
+        {
+            constexpr auto low_dim_ids = TensorDesc::GetLowerDimensionIdss().At(itran);
+            constexpr auto up_dim_ids  = TensorDesc::GetUpperDimensionIdss().At(itran);
+
+            static_for<0, low_dim_ids.Size(), 1>{}(
+                [&](auto i) { is_low(low_dim_ids.At(i)) = true; });
+            static_for<0, up_dim_ids.Size(), 1>{}([&](auto i) { is_up(up_dim_ids.At(i)) = true; });
+        }
+    });
+
+    Array<index_t, ndim_hidden> ids{};
+    index_t size = 0;
+
+    for(index_t idim = 0; idim < ndim_hidden; ++idim)
+    {
+        if(is_up[idim] && !is_low[idim])
+        {
+            ids(size++) = idim;
+        }
+    }
+
+    return make_tuple(size, ids);
+}
+
+// index of the root dimension for the index of the upper dimensions of its affine transforms
+template <typename TensorDesc, typename GroupIds, typename UpDimIds, typename Transforms>
+__host__ __device__ constexpr index_t
+calculate_affine_group_lower_index(const Transforms& transforms,
+                                   const MultiIndex<UpDimIds::Size()>& idx_up,
+                                   index_t root)
+{
+    auto idx_hidden = make_zero_multi_index<TensorDesc::GetNumOfHiddenDimension()>();
+
+    set_container_subset(idx_hidden, UpDimIds{}, idx_up);
+
+    static_for<GroupIds::Size(), 0, -1>{}([&](auto i_p1) {
+        constexpr auto itran    = Number<GroupIds::At(i_p1 - Number<1>{})>{};
+        constexpr auto dims_low = TensorDesc::GetLowerDimensionIdss().At(itran);
+        constexpr auto dims_up  = TensorDesc::GetUpperDimensionIdss().At(itran);
+
+        const auto idx_tran_up = get_container_subset(idx_hidden, dims_up);
+
+        auto idx_tran_low = make_zero_multi_index<dims_low.Size()>();
+
+        transforms.At(itran).CalculateLowerIndex(idx_tran_low, idx_tran_up);
+
+        set_container_subset(idx_hidden, dims_low, idx_tran_low);
+    });
+
+    index_t idx_root = 0;
+
+    static_for<0, TensorDesc::GetNumOfHiddenDimension(), 1>{}([&](auto idim) {
+        if(idim == root)
+        {
+            idx_root = idx_hidden[idim];
+        }
+    });
+
+    return idx_root;
+}
+
+// Embed, preceded by a Slice for the constant offset if any, equivalent to the affine transforms
+// stacked on the root of transform IFirst
+template <index_t IFirst, typename TensorDesc>
+__host__ __device__ constexpr auto collapse_affine_group(const TensorDesc& desc)
+{
+    constexpr index_t root = get_affine_roots<TensorDesc>()[IFirst];
+
+    constexpr auto group = get_affine_group<TensorDesc>(root);
+    constexpr auto up    = get_affine_group_upper_dimensions<TensorDesc>(root);
+
+    constexpr index_t ntransform = group[Number<0>{}];
+    constexpr index_t ndim_up    = up[Number<0>{}];
+
+    constexpr auto group_ids = generate_sequence_v2(
+        [&](auto i) { return Number<get_affine_group<TensorDesc>(root)[Number<1>{}][i]>{}; },
+        Number<ntransform>{});
+
+    constexpr auto up_dim_ids = generate_sequence_v2(
+        [&](auto i) {
+            return Number<get_affine_group_upper_dimensions<TensorDesc>(root)[Number<1>{}][i]>{};
+        },
+        Number<ndim_up>{});
+
+    using GroupIds = remove_cv_t<decltype(group_ids)>;
+    using UpDimIds = remove_cv_t<decltype(up_dim_ids)>;
+
+    using Transforms = remove_cvref_t<decltype(desc.GetTransforms())>;
+
+    constexpr bool is_known = [&] {
+        bool known = true;
+
+        static_for<0, ntransform, 1>{}([&](auto i) {
+            known &= tensor_descriptor_transform_t<TensorDesc, GroupIds::At(i)>::
+                IsKnownAtCompileTime();
+        });
+
+        return known;
+    }();
+
+    constexpr bool is_offset_free = [&] {
+        bool offset_free = true;
+
+        static_for<0, ntransform, 1>{}([&](auto i) {
+            offset_free &=
+                is_offset_free_transform<tensor_descriptor_transform_t<TensorDesc,
+                                                                       GroupIds::At(i)>>::value;
+        });
+
+        return offset_free;
+    }();
+
+    const auto up_lengths = generate_tuple(
+        [&](auto i) {
+            constexpr auto tmp = get_producing_transform<TensorDesc>(UpDimIds::At(i));
+
+            return desc.GetTransforms()
+                .At(Number<tmp[Number<0>{}]>{})
+                .GetUpperLengths()
+                .At(Number<tmp[Number<1>{}]>{});
+        },
+        Number<ndim_up>{});
+
+    // the coefficients and the offset are the differences and the value of the lower index at
+    // unit and zero upper indices
+    const auto coefficients = generate_tuple(
+        [&](auto i) {
+            constexpr auto idx_unit = generate_tuple(
+                [&](auto j) { return index_t{j.value == i.value}; }, Number<ndim_up>{});
+
+            if constexpr(is_known)
+            {
+                constexpr index_t coefficient =
+                    calculate_affine_group_lower_index<TensorDesc, GroupIds, UpDimIds>(
+                        Transforms{}, idx_unit, root) -
+                    calculate_affine_group_lower_index<TensorDesc, GroupIds, UpDimIds>(
+                        Transforms{}, make_zero_multi_index<ndim_up>(), root);
+
+                return Number<coefficient>{};
+            }
+            else
+            {
+                return calculate_affine_group_lower_index<TensorDesc, GroupIds, UpDimIds>(
+                           desc.GetTransforms(), idx_unit, root) -
+                       calculate_affine_group_lower_index<TensorDesc, GroupIds, UpDimIds>(
+                           desc.GetTransforms(), make_zero_multi_index<ndim_up>(), root);
+            }
+        },
+        Number<ndim_up>{});
+
+    const auto embed = make_embed_transform(up_lengths, coefficients);
+
+    constexpr auto offset_known_zero = [&] {
+        if constexpr(is_offset_free)
+        {
+            return true;
+        }
+        else if constexpr(is_known)
+        {
+            return calculate_affine_group_lower_index<TensorDesc, GroupIds, UpDimIds>(
+                       Transforms{}, make_zero_multi_index<ndim_up>(), root) == 0;
+        }
+        else
+        {
+            return false;
+        }
+    }();
+
+    if constexpr(offset_known_zero)
+    {
+        return make_tuple(make_tuple(embed), make_tuple(Sequence<root>{}), make_tuple(UpDimIds{}));
+    }
+    else
+    {
+        const auto offset = [&] {
+            if constexpr(is_known)
+            {
+                return Number<calculate_affine_group_lower_index<TensorDesc, GroupIds, UpDimIds>(
+                    Transforms{}, make_zero_multi_index<ndim_up>(), root)>{};
+            }
+            else
+            {
+                return calculate_affine_group_lower_index<TensorDesc, GroupIds, UpDimIds>(
+                    desc.GetTransforms(), make_zero_multi_index<ndim_up>(), root);
+            }
+        }();
+
+        // only the begin of the slice is used, its lengths are the ones of a single element
+        const auto shift = make_slice_transform(offset + Number<1>{}, offset, offset + Number<1>{});
+
+        // id of the dimension between the Slice and the Embed, unused by desc
+        constexpr index_t idim_shifted = TensorDesc::GetNumOfHiddenDimension() + IFirst;
+
+        return make_tuple(make_tuple(shift, embed),
+                          make_tuple(Sequence<root>{}, Sequence<idim_shifted>{}),
+                          make_tuple(Sequence<idim_shifted>{}, UpDimIds{}));
+    }
+}
+
+// replaces each group of at least two affine transforms stacked on a same root by an Embed
+template <typename TensorDesc>
+__host__ __device__ constexpr auto collapse_affine_transforms(const TensorDesc& desc)
+{
+    constexpr auto roots = get_affine_roots<TensorDesc>();
+
+    constexpr bool has_group = [&] {
+        bool found = false;
+
+        for(index_t itran = 0; itran < TensorDesc::GetNumOfTransform(); ++itran)
+        {
+            found |= roots[itran] >= 0 &&
+                     get_affine_group<TensorDesc>(roots[itran])[Number<0>{}] >= 2;
+        }
+
+        return found;
+    }();
+
+    if constexpr(!has_group)
+    {
+        return desc;
+    }
+    else
+    {
+        return replace_transforms(desc, [&](auto itran) {
+            constexpr index_t root = get_affine_roots<TensorDesc>()[itran];
+
+            if constexpr(root < 0)
+            {
+                return keep_transform(desc, itran);
+            }
+            else
+            {
+                constexpr auto group = get_affine_group<TensorDesc>(root);
+
+                if constexpr(group[Number<0>{}] < 2)
+                {
+                    return keep_transform(desc, itran);
+                }
+                else if constexpr(group[Number<1>{}][0] == itran)
+                {
+                    return collapse_affine_group<itran>(desc);
+                }
+                else
+                {
+                    return make_tuple(Tuple<>{}, Tuple<>{}, Tuple<>{});
+                }
+            }
+        });
+    }
+}
+
+} // namespace detail
+
+// Equivalent descriptor with fewer transforms for CalculateOffset() and move_tensor_coordinate()
+// to walk: same lengths, same offsets, and same validity of the offsets.
+//   1) A Merge followed by an UnMerge of the same lengths, or an UnMerge followed by a Merge of
+//      all its upper dimensions, becomes PassThrough, if the lengths are known at compile-time.
+//   2) The affine transforms stacked on a same hidden dimension, e.g. the Embed of a naive
+//      descriptor and the UnMerge, PassThrough, Slice and Freeze above it, are collapsed into one
+//      Embed of the dimensions they leave to the other transforms, preceded by a Slice if the
+//      offset of the zero index is not known to be 0. Transforms that may map to an invalid index,
+//      e.g. pads with the validity check, are kept. The coefficients of the Embed are Number<> if
+//      the collapsed transforms are known at compile-time.
+// The transforms differ from the ones of desc, so the UpdateLowerIndexHack of the coordinate steps
+// of desc do not apply to the result.
+template <typename TensorDesc>
+__host__ __device__ constexpr auto flatten_tensor_descriptor(const TensorDesc& desc)
+{
+    constexpr auto cancel = detail::find_cancelling_merge_unmerge<TensorDesc>();
+
+    if constexpr(cancel[Number<0>{}])
+    {
+        return flatten_tensor_descriptor(
+            detail::cancel_merge_unmerge<cancel[Number<1>{}], cancel[Number<2>{}]>(desc));
+    }
+    else
+    {
+        return detail::collapse_affine_transforms(desc);
+    }
+}
+
+} // namespace ck
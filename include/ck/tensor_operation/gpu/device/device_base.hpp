@@ -3,8 +3,13 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <sstream>
+#include <utility>
+#include <variant>
+#include <vector>
 
 #include "ck/stream_config.hpp"
 
@@ -37,6 +42,93 @@ struct BaseInvoker
     virtual ~BaseInvoker() {}
 };
 
+// Typed description of a device operator instance: its name and its tuning parameters (BlockSize,
+// MPerBlock, ..., as integers, and enum parameters like the loop scheduler by name) in template
+// parameter order. Instances can be filtered and indexed by it without parsing GetTypeString().
+// Unlike GetTypeIdHashCode(), GetHash() only depends on the contents, so it is the same in every
+// build and process.
+struct DeviceOperatorDescriptor
+{
+    using Value = std::variant<int64_t, std::string>;
+
+    DeviceOperatorDescriptor() = default;
+
+    explicit DeviceOperatorDescriptor(std::string name) : name_(std::move(name)) {}
+
+    DeviceOperatorDescriptor& Add(std::string key, int64_t value)
+    {
+        params_.emplace_back(std::move(key), value);
+        return *this;
+    }
+
+    DeviceOperatorDescriptor& Add(std::string key, std::string value)
+    {
+        params_.emplace_back(std::move(key), std::move(value));
+        return *this;
+    }
+
+    // nullptr if there is no parameter key
+    const Value* Find(std::string_view key) const
+    {
+        for(const auto& param : params_)
+            if(param.first == key)
+                return &param.second;
+
+        return nullptr;
+    }
+
+    // nullptr if there is no parameter key of type T (int64_t or std::string)
+    template <typename T>
+    const T* Get(std::string_view key) const
+    {
+        const Value* value = Find(key);
+
+        return value == nullptr ? nullptr : std::get_if<T>(value);
+    }
+
+    // 64-bit FNV-1a hash of the name and of the parameters
+    uint64_t GetHash() const
+    {
+        uint64_t hash = 0xcbf29ce484222325ull;
+
+        auto update_int = [&](uint64_t x) {
+            for(int i = 0; i < 8; ++i)
+            {
+                hash ^= (x >> (8 * i)) & 0xffu;
+                hash *= 0x100000001b3ull;
+            }
+        };
+
+        auto update_string = [&](std::string_view str) {
+            update_int(str.size());
+
+            for(const char c : str)
+            {
+                hash ^= static_cast<unsigned char>(c);
+                hash *= 0x100000001b3ull;
+            }
+        };
+
+        update_string(name_);
+
+        for(const auto& [key, value] : params_)
+        {
+            update_string(key);
+            update_int(value.index());
+
+            if(const auto* i = std::get_if<int64_t>(&value))
+                update_int(static_cast<uint64_t>(*i));
+            else
+                update_string(std::get<std::string>(value));
+        }
+
+        return hash;
+    }
+
+    std::string name_;
+    std::vector<std::pair<std::string, Value>> params_;
+};
+
 struct BaseOperator
 {
     BaseOperator()                    = default;
@@ -46,6 +138,12 @@ struct BaseOperator
     virtual bool IsSupportedArgument(const BaseArgument*) { return false; }
     virtual std::string GetTypeString() const { return ""; }
 
+    // operators without a descriptor of their own are described by their type string only
+    virtual DeviceOperatorDescriptor GetDescriptor() const
+    {
+        return DeviceOperatorDescriptor{GetTypeString()};
+    }
+
     virtual std::string GetTypeIdName() const { return typeid(*this).name(); }
 
     virtual std::string GetTypeIdHashCode() const
@@ -640,6 +640,25 @@ struct DeviceGemmDl : public DeviceGemm<ALayout,
 
         return str.str();
     }
+
+    DeviceOperatorDescriptor GetDescriptor() const override
+    {
+        DeviceOperatorDescriptor desc{"DeviceGemmDl"};
+
+        desc.Add("GemmSpec", getGemmSpecializationString(GemmSpec))
+            .Add("BlockSize", BlockSize)
+            .Add("MPerBlock", MPerBlock)
+            .Add("NPerBlock", NPerBlock)
+            .Add("K0PerBlock", K0PerBlock)
+            .Add("K1", K1)
+            .Add("M1PerThread", M1PerThread)
+            .Add("N1PerThread", N1PerThread)
+            .Add("KPerThread", KPerThread)
+            .Add("CThreadTransferSrcDstVectorDim", CThreadTransferSrcDstVectorDim)
+            .Add("CThreadTransferDstScalarPerVector", CThreadTransferDstScalarPerVector);
+
+        return desc;
+    }
 };
 
 } // namespace device
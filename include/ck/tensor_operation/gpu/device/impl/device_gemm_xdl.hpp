@@ -299,6 +299,37 @@ struct DeviceGemmXdl : public DeviceGemm<ALayout,
 
         return str.str();
     }
+
+    DeviceOperatorDescriptor GetDescriptor() const override
+    {
+        DeviceOperatorDescriptor desc{"DeviceGemmXdl"};
+
+        desc.Add("GemmSpec", getGemmSpecializationString(GemmSpec))
+            .Add("BlockSize", BlockSize)
+            .Add("MPerBlock", MPerBlock)
+            .Add("NPerBlock", NPerBlock)
+            .Add("K0PerBlock", K0PerBlock)
+            .Add("K1", K1)
+            .Add("MPerXDL", MPerXDL)
+            .Add("NPerXDL", NPerXDL)
+            .Add("MXdlPerWave", MXdlPerWave)
+            .Add("NXdlPerWave", NXdlPerWave)
+            .Add("ABlockTransferSrcVectorDim", ABlockTransferSrcVectorDim)
+            .Add("ABlockTransferSrcScalarPerVector", ABlockTransferSrcScalarPerVector)
+            .Add("ABlockTransferDstScalarPerVector_K1", ABlockTransferDstScalarPerVector_K1)
+            .Add("ABlockLdsAddExtraM", ABlockLdsAddExtraM)
+            .Add("BBlockTransferSrcVectorDim", BBlockTransferSrcVectorDim)
+            .Add("BBlockTransferSrcScalarPerVector", BBlockTransferSrcScalarPerVector)
+            .Add("BBlockTransferDstScalarPerVector_K1", BBlockTransferDstScalarPerVector_K1)
+            .Add("BBlockLdsAddExtraN", BBlockLdsAddExtraN)
+            .Add("CThreadTransferSrcDstVectorDim", CThreadTransferSrcDstVectorDim)
+            .Add("CThreadTransferDstScalarPerVector", CThreadTransferDstScalarPerVector)
+            .Add("NumPrefetch", NumPrefetch)
+            .Add("LoopScheduler", get_loop_scheduler_name(LoopSched))
+            .Add("PipelineVersion", get_pipeline_version_name(PipelineVer));
+
+        return desc;
+    }
 };
 
 } // namespace device
@@ -302,6 +302,40 @@ struct DeviceGemm_Xdl_CShuffle : public DeviceGemm<ALayout,
 
         return str.str();
     }
+
+    DeviceOperatorDescriptor GetDescriptor() const override
+    {
+        DeviceOperatorDescriptor desc{"DeviceGemm_Xdl_CShuffle"};
+
+        desc.Add("GemmSpec", getGemmSpecializationString(GemmSpec))
+            .Add("NumGemmKPrefetchStage", NumGemmKPrefetchStage)
+            .Add("BlockSize", BlockSize)
+            .Add("MPerBlock", MPerBlock)
+            .Add("NPerBlock", NPerBlock)
+            .Add("KPerBlock", KPerBlock)
+            .Add("AK1", AK1)
+            .Add("BK1", BK1)
+            .Add("MPerXDL", MPerXDL)
+            .Add("NPerXDL", NPerXDL)
+            .Add("MXdlPerWave", MXdlPerWave)
+            .Add("NXdlPerWave", NXdlPerWave)
+            .Add("ABlockTransferSrcVectorDim", ABlockTransferSrcVectorDim)
+            .Add("ABlockTransferSrcScalarPerVector", ABlockTransferSrcScalarPerVector)
+            .Add("ABlockTransferDstScalarPerVector_AK1", ABlockTransferDstScalarPerVector_AK1)
+            .Add("ABlockLdsExtraM", ABlockLdsExtraM)
+            .Add("BBlockTransferSrcVectorDim", BBlockTransferSrcVectorDim)
+            .Add("BBlockTransferSrcScalarPerVector", BBlockTransferSrcScalarPerVector)
+            .Add("BBlockTransferDstScalarPerVector_BK1", BBlockTransferDstScalarPerVector_BK1)
+            .Add("BBlockLdsExtraN", BBlockLdsExtraN)
+            .Add("CShuffleMXdlPerWavePerShuffle", CShuffleMXdlPerWavePerShuffle)
+            .Add("CShuffleNXdlPerWavePerShuffle", CShuffleNXdlPerWavePerShuffle)
+            .Add("CShuffleBlockTransferScalarPerVector_NPerBlock",
+                 CShuffleBlockTransferScalarPerVector_NPerBlock)
+            .Add("LoopScheduler", get_loop_scheduler_name(LoopSched))
+            .Add("PipelineVersion", get_pipeline_version_name(PipelineVer));
+
+        return desc;
+    }
 };
 
 } // namespace device
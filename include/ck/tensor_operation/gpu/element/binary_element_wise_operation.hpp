@@ -354,6 +354,21 @@ struct AddFastGelu
 
         e = type_convert<half_t>(x1_f);
     }
+
+    // host span overloads of the cases computing in float, see FastGelu
+    __host__ void operator()(float* p_e, const float* p_c, const float* p_d, std::size_t n) const
+    {
+        apply_host_span_as_float(
+            FastGelu{}, n, p_e, [&](std::size_t i) { return p_c[i] + p_d[i]; });
+    }
+
+    __host__ void
+    operator()(half_t* p_e, const float* p_c, const half_t* p_d, std::size_t n) const
+    {
+        apply_host_span_as_float(FastGelu{}, n, p_e, [&](std::size_t i) {
+            return p_c[i] + type_convert<float>(p_d[i]);
+        });
+    }
 };
 
 } // namespace element_wise
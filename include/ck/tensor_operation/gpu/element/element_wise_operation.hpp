@@ -309,6 +309,37 @@ struct AddAddFastGelu
 
         e = type_convert<int8_t>(x1_f);
     }
+
+    // host span overloads of the cases computing in float, see FastGelu
+    template <typename E, typename D>
+    __host__ void RunHostSpan(
+        E* p_e, const float* p_c, const D* p_d0, const D* p_d1, std::size_t n) const
+    {
+        apply_host_span_as_float(FastGelu{}, n, p_e, [&](std::size_t i) {
+            return p_c[i] + type_convert<float>(p_d0[i]) + type_convert<float>(p_d1[i]);
+        });
+    }
+
+    __host__ void operator()(
+        float* p_e, const float* p_c, const float* p_d0, const float* p_d1, std::size_t n) const
+    {
+        RunHostSpan(p_e, p_c, p_d0, p_d1, n);
+    }
+
+    __host__ void operator()(
+        half_t* p_e, const float* p_c, const half_t* p_d0, const half_t* p_d1, std::size_t n) const
+    {
+        RunHostSpan(p_e, p_c, p_d0, p_d1, n);
+    }
+
+    __host__ void operator()(bhalf_t* p_e,
+                             const float* p_c,
+                             const bhalf_t* p_d0,
+                             const bhalf_t* p_d1,
+                             std::size_t n) const
+    {
+        RunHostSpan(p_e, p_c, p_d0, p_d1, n);
+    }
 };
 
 // E = Relu(alpha1 * C + alpha2 * D0 + D1)
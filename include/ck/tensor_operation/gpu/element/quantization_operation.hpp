@@ -1,12 +1,47 @@
 #pragma once
 
+#include <cstddef>
+
 #include "ck/utility/data_type.hpp"
+#include "ck/tensor_operation/gpu/element/unary_element_wise_operation.hpp"
 // #include "ck/utility/get_id.hpp"
 
 namespace ck {
 namespace tensor_operation {
 namespace element_wise {
 
+// Host span of the requantizing operations below:
+//   p_y[i] = int8(clamp(scale_out(i) * activation(x(i)), -128, 127))
+// where x(i) is the float input of the activation, computed with the host span overload of the
+// activation if it has one
+template <typename Activation, typename X, typename ScaleOut>
+__host__ void requantize_host_span(
+    const Activation& activation, std::size_t n, int8_t* p_y, X&& x, ScaleOut&& scale_out)
+{
+    constexpr std::size_t chunk = 256;
+
+    float y[chunk];
+
+    for(std::size_t i = 0; i < n; i += chunk)
+    {
+        const std::size_t count = n - i < chunk ? n - i : chunk;
+
+        for(std::size_t j = 0; j < count; ++j)
+        {
+            y[j] = x(i + j);
+        }
+
+        apply_host_span(activation, count, y, y);
+
+        for(std::size_t j = 0; j < count; ++j)
+        {
+            const float y_fp32 = math::clamp(scale_out(i + j) * y[j], -128.f, 127.f);
+
+            p_y[i + j] = ck::type_convert<int8_t>(y_fp32);
+        }
+    }
+}
+
 // Y = Sy * Qy
 // W = Sw * Qw
 // X = Sx * Qx
@@ -61,6 +96,17 @@ struct Activation_Mul_Clamp
         y = math::clamp(requantScale_ * y, -128.f, 127.f);
     }
 
+    // host span overload, with the span overload of the activation if it has one
+    __host__ void operator()(int8_t* p_y, const int32_t* p_x, std::size_t n) const
+    {
+        requantize_host_span(
+            activationOp_,
+            n,
+            p_y,
+            [&](std::size_t i) { return ck::type_convert<float>(p_x[i]); },
+            [&](std::size_t) { return requantScale_; });
+    }
+
     float requantScale_;
     Activation activationOp_;
 };
@@ -90,6 +136,17 @@ struct Mul_Activation_Mul_Clamp
         y      = ck::type_convert<int8_t>(y_fp32);
     }
 
+    // host span overload, with the span overload of the activation if it has one
+    __host__ void operator()(int8_t* p_y, const int32_t* p_x, std::size_t n) const
+    {
+        requantize_host_span(
+            activationOp_,
+            n,
+            p_y,
+            [&](std::size_t i) { return scaleAcc_ * ck::type_convert<float>(p_x[i]); },
+            [&](std::size_t) { return scale_z_inv_; });
+    }
+
     float scale_z_inv_;
     float scaleAcc_;
     Activation activationOp_;
@@ -123,6 +180,20 @@ struct Activation_Mul2_Clamp
         y      = ck::type_convert<int32_t>(y_fp32);
     }
 
+    // host span overload, with the span overload of the activation if it has one
+    __host__ void operator()(int8_t* p_y,
+                             const int32_t* p_x,
+                             const float* p_requant_scale,
+                             std::size_t n) const
+    {
+        requantize_host_span(
+            activationOp_,
+            n,
+            p_y,
+            [&](std::size_t i) { return ck::type_convert<float>(p_x[i]); },
+            [&](std::size_t i) { return p_requant_scale[i]; });
+    }
+
     Activation activationOp_;
 };
 
@@ -166,6 +237,18 @@ struct Add_Activation_Mul_Clamp
         y      = ck::type_convert<int32_t>(y_fp32);
     }
 
+    // host span overload, with the span overload of the activation if it has one
+    __host__ void
+    operator()(int8_t* p_y, const int32_t* p_x, const int32_t* p_bias, std::size_t n) const
+    {
+        requantize_host_span(
+            activationOp_,
+            n,
+            p_y,
+            [&](std::size_t i) { return ck::type_convert<float>(p_x[i] + p_bias[i]); },
+            [&](std::size_t) { return requantScale_; });
+    }
+
     float requantScale_;
     Activation activationOp_;
 };
@@ -197,6 +280,21 @@ struct Add_Activation_Mul2_Clamp
         y      = ck::type_convert<int32_t>(y_fp32);
     }
 
+    // host span overload, with the span overload of the activation if it has one
+    __host__ void operator()(int8_t* p_y,
+                             const int32_t* p_x,
+                             const int32_t* p_bias,
+                             const float* p_requant_scale,
+                             std::size_t n) const
+    {
+        requantize_host_span(
+            activationOp_,
+            n,
+            p_y,
+            [&](std::size_t i) { return ck::type_convert<float>(p_x[i] + p_bias[i]); },
+            [&](std::size_t i) { return p_requant_scale[i]; });
+    }
+
     Activation activationOp_;
 };
 
@@ -238,6 +336,18 @@ struct Add_Mul_Activation_Mul_Clamp
         y      = ck::type_convert<int32_t>(y_fp32);
     }
 
+    // host span overload, with the span overload of the activation if it has one
+    __host__ void
+    operator()(int8_t* p_y, const int32_t* p_x, const int32_t* p_bias, std::size_t n) const
+    {
+        requantize_host_span(
+            activationOp_,
+            n,
+            p_y,
+            [&](std::size_t i) { return scaleAcc_ * ck::type_convert<float>(p_x[i] + p_bias[i]); },
+            [&](std::size_t) { return scale_z_inv_; });
+    }
+
     float scale_z_inv_;
     float scaleAcc_;
     Activation activationOp_;
@@ -277,6 +387,23 @@ struct Add_Mul2_Activation_Mul_Clamp
         y      = ck::type_convert<int32_t>(y_fp32);
     }
 
+    // host span overload, with the span overload of the activation if it has one
+    __host__ void operator()(int8_t* p_y,
+                             const int32_t* p_x,
+                             const int32_t* p_bias,
+                             const float* p_scale_acc,
+                             std::size_t n) const
+    {
+        requantize_host_span(
+            activationOp_,
+            n,
+            p_y,
+            [&](std::size_t i) {
+                return p_scale_acc[i] * ck::type_convert<float>(p_x[i] + p_bias[i]);
+            },
+            [&](std::size_t) { return scale_z_inv_; });
+    }
+
     float scale_z_inv_;
     Activation activationOp_;
 };
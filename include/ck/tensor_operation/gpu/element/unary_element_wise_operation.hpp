@@ -3,7 +3,13 @@
 
 #pragma once
 
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
 #include "ck/utility/data_type.hpp"
+#include "ck/utility/host_vector_math.hpp"
+#include "ck/utility/is_detected.hpp"
 #include "ck/utility/math.hpp"
 #include "ck/utility/math_v2.hpp"
 #include "ck/utility/type_convert.hpp"
@@ -16,6 +22,62 @@ namespace element_wise {
 extern "C" __device__ float __ocml_native_recip_f32(float);
 #endif
 
+// Some operations have host span overloads op(p_y, p_x..., n), which compute op(p_y[i], p_x[i]...)
+// for i < n like the scalar host operation, but with the math functions of host_vector_math.hpp,
+// so that the compiler vectorizes the loop. The references call them on whole rows through
+// apply_host_span(). p_y may be one of the p_x.
+template <typename Op, typename Y, typename... Xs>
+using host_span_invoke_t = decltype(std::declval<const Op&>()(
+    std::declval<Y*>(), std::declval<const Xs*>()..., std::declval<std::size_t>()));
+
+template <typename Op, typename Y, typename... Xs>
+inline constexpr bool is_host_span_invocable_v =
+    is_detected<host_span_invoke_t, Op, Y, Xs...>::value;
+
+// op(p_y[i], p_xs[i]...) for i < n, by the host span overload of op if it has one
+template <typename Op, typename Y, typename... Xs>
+__host__ void apply_host_span(const Op& op, std::size_t n, Y* p_y, const Xs*... p_xs)
+{
+    if constexpr(is_host_span_invocable_v<Op, Y, Xs...>)
+    {
+        op(p_y, p_xs..., n);
+    }
+    else
+    {
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            op(p_y[i], p_xs[i]...);
+        }
+    }
+}
+
+// p_y[i] = type_convert<Y>(op(x(i))) for i < n with the float host span overload of op, for the
+// span overloads of operations computing in float, e.g. to half_t
+template <typename Op, typename Y, typename F>
+__host__ void apply_host_span_as_float(const Op& op, std::size_t n, Y* p_y, F&& x)
+{
+    constexpr std::size_t chunk = 256;
+
+    float y[chunk];
+
+    for(std::size_t i = 0; i < n; i += chunk)
+    {
+        const std::size_t count = n - i < chunk ? n - i : chunk;
+
+        for(std::size_t j = 0; j < count; ++j)
+        {
+            y[j] = x(i + j);
+        }
+
+        op(y, y, count);
+
+        for(std::size_t j = 0; j < count; ++j)
+        {
+            p_y[i + j] = type_convert<Y>(y[j]);
+        }
+    }
+}
+
 struct PassThroughPack2
 {
     template <typename Y, typename X>
@@ -514,6 +576,27 @@ struct FastGelu
 
         y = type_convert<half_t>(y_f);
     }
+
+    // host span overloads, with exp() replaced by math::exp_approx(). The results differ from the
+    // scalar host operation by at most 2 ulp of x, not of y, as x * cdf(x) is tiny for negative x.
+    // The bound is checked on a sample of all the float exponents, see test_element_wise_host_span.
+    __host__ void operator()(float* p_y, const float* p_x, std::size_t n) const
+    {
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            const float x   = p_x[i];
+            const float u   = 2.f * x * (0.035677f * x * x + 0.797885f);
+            const float emu = math::exp_approx(-u);
+            const float cdf = 0.5f + 0.5f * (2.f / (1.f + emu) - 1.f);
+
+            p_y[i] = x * cdf;
+        }
+    }
+
+    __host__ void operator()(half_t* p_y, const float* p_x, std::size_t n) const
+    {
+        apply_host_span_as_float(*this, n, p_y, [&](std::size_t i) { return p_x[i]; });
+    }
 };
 
 // https://paperswithcode.com/method/gelu
@@ -535,6 +618,24 @@ struct Gelu
     {
         y = ck::half_t(0.5) * x * (ck::half_t(1) + ck::half_t(erf(float(0.70710678118f * x))));
     }
+
+    // host span overloads, with erf() replaced by math::erf_approx(). The results differ from the
+    // scalar host operation by at most 2 ulp of x, not of y, as x * cdf(x) is tiny for negative x.
+    // The bound is checked on a sample of all the float exponents, see test_element_wise_host_span.
+    __host__ void operator()(float* p_y, const float* p_x, std::size_t n) const
+    {
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            const float x = p_x[i];
+
+            p_y[i] = 0.5f * x * (1.f + math::erf_approx(0.70710678118f * x));
+        }
+    }
+
+    __host__ void operator()(half_t* p_y, const float* p_x, std::size_t n) const
+    {
+        apply_host_span_as_float(*this, n, p_y, [&](std::size_t i) { return p_x[i]; });
+    }
 };
 
 struct Sigmoid
@@ -549,6 +650,21 @@ struct Sigmoid
         constexpr T one = type_convert<T>(1);
         y               = one / (one + ck::math::exp(-x));
     };
+
+    // host span overloads, with exp() replaced by math::exp_approx(): the results differ from the
+    // scalar host operation by at most 4 ulp on the sample of test_element_wise_host_span
+    __host__ void operator()(float* p_y, const float* p_x, std::size_t n) const
+    {
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            p_y[i] = 1.f / (1.f + math::exp_approx(-p_x[i]));
+        }
+    }
+
+    __host__ void operator()(half_t* p_y, const float* p_x, std::size_t n) const
+    {
+        apply_host_span_as_float(*this, n, p_y, [&](std::size_t i) { return p_x[i]; });
+    }
 };
 
 struct TanH
@@ -563,6 +679,21 @@ struct TanH
 
         y = ck::math::tanh(x);
     };
+
+    // host span overloads, with tanh() replaced by math::tanh_approx(): the results differ from
+    // the scalar host operation by at most 3 ulp on the sample of test_element_wise_host_span
+    __host__ void operator()(float* p_y, const float* p_x, std::size_t n) const
+    {
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            p_y[i] = math::tanh_approx(p_x[i]);
+        }
+    }
+
+    __host__ void operator()(half_t* p_y, const float* p_x, std::size_t n) const
+    {
+        apply_host_span_as_float(*this, n, p_y, [&](std::size_t i) { return p_x[i]; });
+    }
 };
 
 struct Swish
@@ -584,6 +715,23 @@ struct Swish
         y        = type_convert<Y>(x / (1.f + ck::math::exp(bx)));
     };
 
+    // host span overloads, with exp() replaced by math::exp_approx(): the results differ from the
+    // scalar host operation by at most 4 ulp on the sample of test_element_wise_host_span
+    __host__ void operator()(float* p_y, const float* p_x, std::size_t n) const
+    {
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            const float x = p_x[i];
+
+            p_y[i] = x / (1.f + math::exp_approx(-beta_ * x));
+        }
+    }
+
+    __host__ void operator()(half_t* p_y, const float* p_x, std::size_t n) const
+    {
+        apply_host_span_as_float(*this, n, p_y, [&](std::size_t i) { return p_x[i]; });
+    }
+
     const float beta_;
 };
 
@@ -708,6 +708,8 @@ struct BlockToCTileMap_GemmStreamK
     //--------------------------------------
 
     // prefer construct on host
+    // sk_blocks overrides the heuristic below, e.g. with the best split found by
+    // ck::utils::tune_stream_k() (library/utility/stream_k_simulator.hpp)
     BlockToCTileMap_GemmStreamK(uint32_t m,
                                 uint32_t n,
                                 uint32_t k,
@@ -905,7 +907,7 @@ struct BlockToCTileMap_GemmStreamK
         return __builtin_amdgcn_readfirstlane(blockIdx.x);
     }
 
-    __device__ void
+    __host__ __device__ void
     get_block_itr(uint32_t block_idx, uint32_t& iter_start, uint32_t& iter_end) const
     {
         if(block_idx < sk_num_big_blocks)
@@ -941,7 +943,7 @@ struct BlockToCTileMap_GemmStreamK
 
     __device__ uint32_t get_tile_idx(uint32_t iter) const { return k_iters_per_tile.div(iter); }
 
-    __device__ void
+    __host__ __device__ void
     get_tile_idx_with_offset(uint32_t iter, uint32_t& tile_idx, uint32_t& iter_offset) const
     {
         k_iters_per_tile.divmod(iter, tile_idx, iter_offset);
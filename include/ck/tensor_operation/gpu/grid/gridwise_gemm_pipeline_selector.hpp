@@ -19,6 +19,17 @@ enum struct PipelineVersion
     v4,
 };
 
+constexpr const char* get_pipeline_version_name(PipelineVersion pipeline_version)
+{
+    switch(pipeline_version)
+    {
+    case PipelineVersion::v1: return "v1";
+    case PipelineVersion::v2: return "v2";
+    case PipelineVersion::v4: return "v4";
+    default: return "unknown";
+    }
+}
+
 template <PipelineVersion PipelineVer,
           index_t NumPrefetch     = 1,
           LoopScheduler LoopSched = LoopScheduler::Default>
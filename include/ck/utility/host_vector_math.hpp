@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#ifndef __HIP_DEVICE_COMPILE__
+#include <cmath>
+#endif
+
+#include <cstdint>
+
+#include "ck/utility/type.hpp"
+
+namespace ck {
+namespace math {
+
+// Float approximations of exp, erf and tanh for the host span overloads of the element-wise
+// operations. They have no branches nor library calls, so that loops over arrays of floats are
+// vectorized by the compiler. The errors are versus the float functions of <cmath> over all
+// floats, without contraction into FMA. GCC vectorizes the selects only with -fno-trapping-math.
+
+// At most 1 ulp. Overflows to inf and underflows to 0 through the denormals like std::exp.
+__host__ inline float exp_approx(float x)
+{
+    // the results are 0 below -104 and inf above 89
+    const float xc = x < -104.f ? -104.f : (x > 89.f ? 89.f : x);
+
+    // n = round(x / ln2), the rounding being done by the addition of 1.5 * 2^23
+    constexpr float round_magic = 12582912.f;
+
+    const float t = xc * 1.44269504f + round_magic;
+    const float n = t - round_magic;
+
+    // r = x - n * ln2 in [-ln2 / 2, ln2 / 2], with ln2 split into an exact part and a remainder
+    const float r = (xc - n * 0.693359375f) - n * -2.12194440e-4f;
+
+    // exp(r), Cephes expf polynomial
+    float p = 1.9875691500e-4f;
+    p       = p * r + 1.3981999507e-3f;
+    p       = p * r + 8.3334519073e-3f;
+    p       = p * r + 4.1665795894e-2f;
+    p       = p * r + 1.6666665459e-1f;
+    p       = p * r + 5.0000001201e-1f;
+    p       = p * r * r + r + 1.f;
+
+    // 2^n as 2^n1 * 2^n2, so that both factors are normal floats for n in [-150, 129]
+    const int32_t n_int = bit_cast<int32_t>(t) - bit_cast<int32_t>(round_magic);
+    const int32_t n1    = n_int / 2;
+    const int32_t n2    = n_int - n1;
+
+    const float y = p * bit_cast<float>((n1 + 127) << 23) * bit_cast<float>((n2 + 127) << 23);
+
+    return x != x ? x : y;
+}
+
+// At most 3 ulp.
+__host__ inline float erf_approx(float x)
+{
+    const float z  = std::abs(x);
+    const float z2 = z * z;
+
+    // Taylor series up to z^17 for z < 0.75
+    float p = 1.6462114365889248e-06f;
+    p       = p * z2 - 1.4925650358406252e-05f;
+    p       = p * z2 + 1.2055332981789665e-04f;
+    p       = p * z2 - 8.5483270234508530e-04f;
+    p       = p * z2 + 5.2239776254421880e-03f;
+    p       = p * z2 - 2.6866170645131252e-02f;
+    p       = p * z2 + 1.1283791670955128e-01f;
+    p       = p * z2 - 3.7612638903183754e-01f;
+    p       = p * z2 + 1.1283791670955126f;
+
+    const float y_small = x * p;
+
+    // 1 - erfc(z) otherwise, with the erfc approximation of Numerical Recipes, of relative error
+    // below 1.2e-7
+    const float t = 1.f / (1.f + 0.5f * z);
+
+    float q = 0.17087277f;
+    q       = q * t - 0.82215223f;
+    q       = q * t + 1.48851587f;
+    q       = q * t - 1.13520398f;
+    q       = q * t + 0.27886807f;
+    q       = q * t - 0.18628806f;
+    q       = q * t + 0.09678418f;
+    q       = q * t + 0.37409196f;
+    q       = q * t + 1.00002368f;
+    q       = q * t - 1.26551223f;
+
+    const float y_large = std::copysign(1.f - t * exp_approx(q - z2), x);
+
+    return z < 0.75f ? y_small : y_large;
+}
+
+// At most 3 ulp.
+__host__ inline float tanh_approx(float x)
+{
+    const float z  = std::abs(x);
+    const float x2 = x * x;
+
+    // Taylor series up to x^17 for |x| < 0.5
+    float p = 5.9002744094558600e-04f;
+    p       = p * x2 - 1.4558343870513183e-03f;
+    p       = p * x2 + 3.5921280365724810e-03f;
+    p       = p * x2 - 8.8632355299021970e-03f;
+    p       = p * x2 + 2.1869488536155203e-02f;
+    p       = p * x2 - 5.3968253968253970e-02f;
+    p       = p * x2 + 1.3333333333333333e-01f;
+    p       = p * x2 - 3.3333333333333333e-01f;
+
+    const float y_small = x + x * x2 * p;
+
+    // 1 - 2 / (exp(2|x|) + 1) otherwise
+    const float y_large = std::copysign(1.f - 2.f / (exp_approx(2.f * z) + 1.f), x);
+
+    return z < 0.5f ? y_small : y_large;
+}
+
+} // namespace math
+} // namespace ck
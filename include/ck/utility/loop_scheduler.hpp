@@ -23,4 +23,9 @@ constexpr LoopScheduler make_default_loop_scheduler()
 #endif // if CK_EXPERIMENTAL_DEFAULT_TO_INTER_WAVE_SCHEDULING
 }
 
+constexpr const char* get_loop_scheduler_name(LoopScheduler loop_scheduler)
+{
+    return loop_scheduler == LoopScheduler::Interwave ? "Interwave" : "Default";
+}
+
 } // namespace ck
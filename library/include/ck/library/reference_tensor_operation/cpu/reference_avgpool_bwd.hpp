@@ -3,12 +3,16 @@
 
 #pragma once
 
+#include <functional>
 #include <iostream>
+#include <numeric>
 #include <sstream>
+#include <vector>
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 
 #include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_thread_pool.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -58,238 +62,159 @@ struct ReferenceAvgPoolBwd : public device::BaseOperator
     {
         using Argument = ReferenceAvgPoolBwd::Argument;
 
-        template <ck::index_t NDimSpatial_,
-                  typename std::enable_if<NDimSpatial_ == 1, bool>::type = false>
-        float RunAvgPoolBwd(const Argument& arg)
+        // Let input = x, outpu = y
+        // shape of x = [10], y = [6]
+        // window_size = 5, pad = 0, stride = 1, dilation = 1
+        // Forward:
+        // y0 = 1/5 * (x0 + x1 + x2 + x3 + x4)
+        // y1 = 1/5 * (x1 + x2 + x3 + x4 + x5)
+        // ...
+        // y5 = 1/5 * (x5 + x6 + x7 + x8 + x9)
+
+        // Backward:
+        // shape of dy = [6], dx = [10]
+        // dx0 = 1/5 * dy0
+        // dx1 = 1/5 * (dy0 + dy1)
+        // ...
+        // dx9 = 1/5 * (dy5)
+        //
+        // The doutput pixels covering a dinput pixel are the product of the ones covering it along
+        // each spatial dimension, so the sums are taken one dimension at a time, from the last to
+        // the first, each pass replacing the output length of its dimension by the input length.
+        // The work is proportional to the sum of the window lengths over the strides instead of
+        // their product, and each thread writes its own rows of the partial sums.
+        float Run(const Argument& arg)
         {
-            // Let input = x, outpu = y
-            // shape of x = [10], y = [6]
-            // window_size = 5, pad = 0, stride = 1, dilation = 1
-            // Forward:
-            // y0 = 1/5 * (x0 + x1 + x2 + x3 + x4)
-            // y1 = 1/5 * (x1 + x2 + x3 + x4 + x5)
-            // ...
-            // y5 = 1/5 * (x5 + x6 + x7 + x8 + x9)
-            // y6 = 1/5 * (x6 + x7 + x8 + x9)
-            // ...
-            // y9 = 1/5 * (x9)
-
-            // Backward:
-            // shape of dy = [6], dx = [10]
-            // dx0 = 1/5 * dy0
-            // dx1 = 1/5 * (dy0 + dy1)
-            // dx2 = 1/5 * (dy0 + dy1 + dy2)
-            // ...
-            // dx4 = 1/5 * (dy0 + dy1 + dy2 + dy3 + dy4)
-            // dx5 = 1/5 * (dy1 + dy2 + dy3 + dy4 + dy5)
-            // ...
-            // dx9 = 1/5 * (dy5 + dy6 + dy7 + dy8 + dy9)
-
-            auto f_ncw = [&](auto n, auto c, auto wi) {
-                std::size_t X  = arg.window_spatial_lengths_[0];
-                std::size_t Wo = arg.doutput_.GetLengths()[2];
-
-                float v_acc = 0;
-
-                for(std::size_t x = 0; x < X; ++x)
-                {
-                    // Out_Position = (In_Position + pad - x * dilation) / stride
-                    auto w_tmp = static_cast<ck::long_index_t>(wi) +
-                                 static_cast<ck::long_index_t>(arg.in_left_pads_[0]) -
-                                 static_cast<ck::long_index_t>(x * arg.window_dilations_[0]);
-
-                    // Check the input pixel validity (in perspective of being affected by some
-                    // doutput pixel)
-                    if(w_tmp % arg.window_strides_[0] == 0)
+            if(!(arg.dinput_.GetNumOfDimension() == NDimSpatial + 2 &&
+                 arg.doutput_.GetNumOfDimension() == NDimSpatial + 2))
+            {
+                throw std::runtime_error("wrong! inconsistent dimension");
+            }
+
+            constexpr std::size_t NDim = NDimSpatial + 2;
+
+            const auto& dout_lengths = arg.doutput_.GetLengths();
+            const auto& din_lengths  = arg.dinput_.GetLengths();
+
+            // Calls f(offset, i) for the elements of tensor in row-major order, i counting them.
+            // Rows, i.e. all but the last dimension, are spread over the threads.
+            auto for_each_element = [](const auto& tensor, auto f) {
+                const auto& lengths = tensor.GetLengths();
+                const auto& strides = tensor.GetStrides();
+
+                const std::size_t row_length = lengths[NDim - 1];
+                const std::size_t num_row    = tensor.GetElementSize() / row_length;
+
+                auto f_rows = [&](std::size_t row_begin, std::size_t row_end) {
+                    for(std::size_t row = row_begin; row < row_end; ++row)
                     {
-                        auto wo = static_cast<ck::long_index_t>(w_tmp) /
-                                  static_cast<ck::long_index_t>(arg.window_strides_[0]);
+                        std::size_t offset = 0;
 
-                        // Get the doutput pixel in valid range to accumulate the gradients for this
-                        // input pixel
-                        if(wo >= 0 && ck::type_convert<std::size_t>(wo) < Wo)
+                        for(std::size_t d = NDim - 1, r = row; d-- > 0;)
                         {
-                            v_acc += ck::type_convert<float>(arg.doutput_(n, c, wo));
+                            offset += (r % lengths[d]) * strides[d];
+                            r /= lengths[d];
                         }
+
+                        for(std::size_t w = 0; w < row_length; ++w)
+                            f(offset + w * strides[NDim - 1], row * row_length + w);
                     }
-                }
+                };
 
-                v_acc /= ck::type_convert<float>(X);
-                arg.dinput_(n, c, wi) = ck::type_convert<DInDataType>(v_acc);
+                ck::utils::host_parallel_for(num_row, f_rows);
             };
 
-            make_ParallelTensorFunctor(f_ncw,
-                                       arg.dinput_.GetLengths()[0],
-                                       arg.dinput_.GetLengths()[1],
-                                       arg.dinput_.GetLengths()[2])(
-                std::thread::hardware_concurrency());
+            if(arg.dinput_.GetElementSize() == 0)
+                return 0;
 
-            return 0;
-        }
+            // partial sums, packed, of lengths
+            std::vector<std::size_t> lengths(dout_lengths.begin(), dout_lengths.end());
+            std::vector<float> sums(arg.doutput_.GetElementSize());
 
-        template <ck::index_t NDimSpatial_,
-                  typename std::enable_if<NDimSpatial_ == 2, bool>::type = false>
-        float RunAvgPoolBwd(const Argument& arg)
-        {
-            auto f_nchw = [&](auto n, auto c, auto hi, auto wi) {
-                std::size_t Y = arg.window_spatial_lengths_[0];
-                std::size_t X = arg.window_spatial_lengths_[1];
+            if(!sums.empty())
+            {
+                for_each_element(arg.doutput_, [&](std::size_t offset, std::size_t i) {
+                    sums[i] = ck::type_convert<float>(arg.doutput_.mData[offset]);
+                });
+            }
+
+            for(std::size_t k = NDimSpatial; k-- > 0;)
+            {
+                const std::size_t dim = k + 2;
 
-                std::size_t Ho = arg.doutput_.GetLengths()[2];
-                std::size_t Wo = arg.doutput_.GetLengths()[3];
+                const auto X        = static_cast<ck::long_index_t>(arg.window_spatial_lengths_[k]);
+                const auto stride   = static_cast<ck::long_index_t>(arg.window_strides_[k]);
+                const auto dilation = static_cast<ck::long_index_t>(arg.window_dilations_[k]);
+                const auto pad      = static_cast<ck::long_index_t>(arg.in_left_pads_[k]);
 
-                float v_acc = 0;
+                const std::size_t Lo = lengths[dim];
+                const std::size_t Li = din_lengths[dim];
 
-                for(std::size_t y = 0; y < Y; ++y)
+                // covers[wi]: output positions whose window covers the input position wi, in the
+                // order of the window
+                std::vector<std::vector<std::size_t>> covers(Li);
+
+                for(std::size_t wi = 0; wi < Li; ++wi)
                 {
-                    // Out_Position = (In_Position + pad - x * dilation) / stride
-                    auto h_tmp = static_cast<ck::long_index_t>(hi) +
-                                 static_cast<ck::long_index_t>(arg.in_left_pads_[0]) -
-                                 static_cast<ck::long_index_t>(y * arg.window_dilations_[0]);
-
-                    // Check the input pixel validity (in perspective of being affected by some
-                    // doutput pixel)
-                    if(h_tmp % arg.window_strides_[0] == 0)
+                    for(ck::long_index_t x = 0; x < X; ++x)
                     {
-                        auto ho = static_cast<ck::long_index_t>(h_tmp) /
-                                  static_cast<ck::long_index_t>(arg.window_strides_[0]);
+                        // Out_Position = (In_Position + pad - x * dilation) / stride
+                        const auto w_tmp = static_cast<ck::long_index_t>(wi) + pad - x * dilation;
 
-                        // Get the doutput pixel in valid range to accumulate the gradients for this
-                        // input pixel
-                        if(ho >= 0 && ck::type_convert<std::size_t>(ho) < Ho)
+                        if(w_tmp >= 0 && w_tmp % stride == 0 &&
+                           static_cast<std::size_t>(w_tmp / stride) < Lo)
                         {
-                            for(std::size_t x = 0; x < X; ++x)
-                            {
-                                auto w_tmp =
-                                    static_cast<ck::long_index_t>(wi) +
-                                    static_cast<ck::long_index_t>(arg.in_left_pads_[1]) -
-                                    static_cast<ck::long_index_t>(x * arg.window_dilations_[1]);
-                                if(w_tmp % arg.window_strides_[1] == 0)
-                                {
-                                    auto wo = static_cast<ck::long_index_t>(w_tmp) /
-                                              static_cast<ck::long_index_t>(arg.window_strides_[1]);
-                                    if(wo >= 0 && ck::type_convert<std::size_t>(wo) < Wo)
-                                    {
-                                        v_acc +=
-                                            ck::type_convert<float>(arg.doutput_(n, c, ho, wo));
-                                    }
-                                }
-                            }
+                            covers[wi].push_back(static_cast<std::size_t>(w_tmp / stride));
                         }
                     }
                 }
 
-                v_acc /= ck::type_convert<float>(Y * X);
-                arg.dinput_(n, c, hi, wi) = ck::type_convert<DInDataType>(v_acc);
-            };
-
-            make_ParallelTensorFunctor(f_nchw,
-                                       arg.dinput_.GetLengths()[0],
-                                       arg.dinput_.GetLengths()[1],
-                                       arg.dinput_.GetLengths()[2],
-                                       arg.dinput_.GetLengths()[3])(
-                std::thread::hardware_concurrency());
-
-            return 0;
-        }
-
-        template <ck::index_t NDimSpatial_,
-                  typename std::enable_if<NDimSpatial_ == 3, bool>::type = false>
-        float RunAvgPoolBwd(const Argument& arg)
-        {
-            auto f_ncdhw = [&](auto n, auto c, auto di, auto hi, auto wi) {
-                std::size_t Z = arg.window_spatial_lengths_[0];
-                std::size_t Y = arg.window_spatial_lengths_[1];
-                std::size_t X = arg.window_spatial_lengths_[2];
-
-                std::size_t Do = arg.doutput_.GetLengths()[2];
-                std::size_t Ho = arg.doutput_.GetLengths()[3];
-                std::size_t Wo = arg.doutput_.GetLengths()[4];
+                const std::size_t num_outer = std::accumulate(lengths.begin(),
+                                                              lengths.begin() + dim,
+                                                              std::size_t{1},
+                                                              std::multiplies<std::size_t>{});
+                const std::size_t inner     = std::accumulate(lengths.begin() + dim + 1,
+                                                          lengths.end(),
+                                                          std::size_t{1},
+                                                          std::multiplies<std::size_t>{});
 
-                float v_acc = 0;
+                std::vector<float> next(num_outer * Li * inner, 0.f);
 
-                for(std::size_t z = 0; z < Z; ++z)
-                {
-                    // Out_Position = (In_Position + pad - x * dilation) / stride
-                    auto d_tmp = static_cast<ck::long_index_t>(di) +
-                                 static_cast<ck::long_index_t>(arg.in_left_pads_[0]) -
-                                 static_cast<ck::long_index_t>(z * arg.window_dilations_[0]);
-
-                    // Check the input pixel validity (in perspective of being affected by some
-                    // doutput pixel)
-                    if(d_tmp % arg.window_strides_[0] == 0)
+                auto f_rows = [&](std::size_t row_begin, std::size_t row_end) {
+                    for(std::size_t row = row_begin; row < row_end; ++row)
                     {
-                        auto do_ = static_cast<ck::long_index_t>(d_tmp) /
-                                   static_cast<ck::long_index_t>(arg.window_strides_[0]);
+                        const std::size_t outer = row / Li;
+                        const std::size_t wi    = row % Li;
+
+                        float* dst = next.data() + row * inner;
 
-                        // Get the doutput pixel in valid range to accumulate the gradients for this
-                        // input pixel
-                        if(do_ >= 0 && ck::type_convert<std::size_t>(do_) < Do)
+                        for(const std::size_t wo : covers[wi])
                         {
-                            for(std::size_t y = 0; y < Y; ++y)
-                            {
-                                auto h_tmp =
-                                    static_cast<ck::long_index_t>(hi) +
-                                    static_cast<ck::long_index_t>(arg.in_left_pads_[1]) -
-                                    static_cast<ck::long_index_t>(y * arg.window_dilations_[1]);
-                                if(h_tmp % arg.window_strides_[1] == 0)
-                                {
-                                    auto ho = static_cast<ck::long_index_t>(h_tmp) /
-                                              static_cast<ck::long_index_t>(arg.window_strides_[1]);
-                                    if(ho >= 0 && ck::type_convert<std::size_t>(ho) < Ho)
-                                    {
-                                        for(std::size_t x = 0; x < X; ++x)
-                                        {
-                                            auto w_tmp = static_cast<ck::long_index_t>(wi) +
-                                                         static_cast<ck::long_index_t>(
-                                                             arg.in_left_pads_[2]) -
-                                                         static_cast<ck::long_index_t>(
-                                                             x * arg.window_dilations_[2]);
-
-                                            if(w_tmp % arg.window_strides_[2] == 0)
-                                            {
-                                                auto wo = static_cast<ck::long_index_t>(w_tmp) /
-                                                          static_cast<ck::long_index_t>(
-                                                              arg.window_strides_[2]);
-                                                if(wo >= 0 &&
-                                                   ck::type_convert<std::size_t>(wo) < Wo)
-                                                {
-                                                    v_acc += ck::type_convert<float>(
-                                                        arg.doutput_(n, c, do_, ho, wo));
-                                                }
-                                            }
-                                        }
-                                    }
-                                }
-                            }
+                            const float* src = sums.data() + (outer * Lo + wo) * inner;
+
+                            for(std::size_t j = 0; j < inner; ++j)
+                                dst[j] += src[j];
                         }
                     }
-                }
+                };
 
-                v_acc /= ck::type_convert<float>(Z * Y * X);
-                arg.dinput_(n, c, di, hi, wi) = ck::type_convert<DInDataType>(v_acc);
-            };
+                ck::utils::host_parallel_for(num_outer * Li, f_rows);
 
-            make_ParallelTensorFunctor(f_ncdhw,
-                                       arg.dinput_.GetLengths()[0],
-                                       arg.dinput_.GetLengths()[1],
-                                       arg.dinput_.GetLengths()[2],
-                                       arg.dinput_.GetLengths()[3],
-                                       arg.dinput_.GetLengths()[4])(
-                std::thread::hardware_concurrency());
+                lengths[dim] = Li;
+                sums.swap(next);
+            }
 
-            return 0;
-        }
+            const auto window_size = std::accumulate(arg.window_spatial_lengths_.begin(),
+                                                     arg.window_spatial_lengths_.end(),
+                                                     std::size_t{1},
+                                                     std::multiplies<std::size_t>{});
 
-        float Run(const Argument& arg)
-        {
-            if(!(arg.dinput_.GetNumOfDimension() == NDimSpatial + 2 &&
-                 arg.doutput_.GetNumOfDimension() == NDimSpatial + 2))
-            {
-                throw std::runtime_error("wrong! inconsistent dimension");
-            }
+            for_each_element(arg.dinput_, [&](std::size_t offset, std::size_t i) {
+                arg.dinput_.mData[offset] =
+                    ck::type_convert<DInDataType>(sums[i] / ck::type_convert<float>(window_size));
+            });
 
-            return RunAvgPoolBwd<NDimSpatial>(arg);
+            return 0;
         }
 
         float Run(const device::BaseArgument* p_arg,
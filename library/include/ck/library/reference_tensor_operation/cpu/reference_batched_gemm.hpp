@@ -8,6 +8,7 @@
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_view.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -25,9 +26,9 @@ struct ReferenceBatchedGemm : public device::BaseOperator
     // Argument
     struct Argument : public device::BaseArgument
     {
-        Argument(const Tensor<ADataType>& a_g_m_k,
-                 const Tensor<BDataType>& b_g_k_n,
-                 Tensor<CDataType>& c_g_m_n,
+        Argument(TensorView<const ADataType> a_g_m_k,
+                 TensorView<const BDataType> b_g_k_n,
+                 TensorView<CDataType> c_g_m_n,
                  AElementwiseOperation a_element_op,
                  BElementwiseOperation b_element_op,
                  CElementwiseOperation c_element_op)
@@ -40,9 +41,9 @@ struct ReferenceBatchedGemm : public device::BaseOperator
         {
         }
 
-        const Tensor<ADataType>& a_g_m_k_;
-        const Tensor<BDataType>& b_g_k_n_;
-        Tensor<CDataType>& c_g_m_n_;
+        TensorView<const ADataType> a_g_m_k_;
+        TensorView<const BDataType> b_g_k_n_;
+        TensorView<CDataType> c_g_m_n_;
 
         AElementwiseOperation a_element_op_;
         BElementwiseOperation b_element_op_;
@@ -103,9 +104,9 @@ struct ReferenceBatchedGemm : public device::BaseOperator
 
     bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
 
-    static auto MakeArgument(const Tensor<ADataType>& a_g_m_k,
-                             const Tensor<BDataType>& b_g_k_n,
-                             Tensor<CDataType>& c_g_m_n,
+    static auto MakeArgument(TensorView<const ADataType> a_g_m_k,
+                             TensorView<const BDataType> b_g_k_n,
+                             TensorView<CDataType> c_g_m_n,
                              AElementwiseOperation a_element_op,
                              BElementwiseOperation b_element_op,
                              CElementwiseOperation c_element_op)
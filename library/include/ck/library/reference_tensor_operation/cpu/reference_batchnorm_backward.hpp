@@ -78,8 +78,6 @@ struct ReferenceBatchNormBwd : public device::DeviceBatchNormBwd<XDataType,
               p_dscale_(p_dscale),
               p_dbias_(p_dbias)
         {
-            using ck::host_common::get_index_set;
-
             if(std::any_of(
                    reduceDims.begin(), reduceDims.end(), [](int d) { return d < 0 || d >= Rank; }))
                 throw std::runtime_error("Invalid reduce dimensions!");
@@ -126,9 +124,6 @@ struct ReferenceBatchNormBwd : public device::DeviceBatchNormBwd<XDataType,
             reduceSize_ = std::accumulate(
                 reduce_lengths_.begin(), reduce_lengths_.end(), 1, std::multiplies<size_t>{});
 
-            invariant_index_set_ = get_index_set<NumInvariantDim>(invariant_lengths_);
-            reduce_index_set_    = get_index_set<NumBatchNormReduceDim>(reduce_lengths_);
-
             epsilon_ = type_convert<AccDataType>(epsilon);
 
             haveSavedMeanInvVar_ = (p_savedMean != nullptr && p_savedInvVar != nullptr);
@@ -164,9 +159,6 @@ struct ReferenceBatchNormBwd : public device::DeviceBatchNormBwd<XDataType,
 
         bool haveSavedMeanInvVar_;
 
-        std::vector<std::array<index_t, NumInvariantDim>> invariant_index_set_;
-        std::vector<std::array<index_t, NumBatchNormReduceDim>> reduce_index_set_;
-
         AccDataType epsilon_;
         size_t reduceSize_;
     };
@@ -175,7 +167,9 @@ struct ReferenceBatchNormBwd : public device::DeviceBatchNormBwd<XDataType,
     {
         float Run(const Argument& arg)
         {
+            using ck::host_common::for_each_index_offset;
             using ck::host_common::get_offset_from_index;
+            using ck::host_common::parallel_for_each_index;
 
             auto thread_reduce_func = [&](auto invariant_index) {
                 size_t x_invariant_offset = get_offset_from_index<NumInvariantDim>(
@@ -203,25 +197,24 @@ struct ReferenceBatchNormBwd : public device::DeviceBatchNormBwd<XDataType,
                 else
                 {
                     // compute mean, variance using welford method
-                    for(const auto& reduce_index : arg.reduce_index_set_)
-                    {
-                        size_t x_reduce_offset = get_offset_from_index<NumBatchNormReduceDim>(
-                            arg.x_reduce_strides_, reduce_index);
+                    for_each_index_offset<NumBatchNormReduceDim>(
+                        arg.reduce_lengths_,
+                        [&](size_t, size_t x_reduce_offset) {
+                            auto x_offset = x_invariant_offset + x_reduce_offset;
 
-                        auto x_offset = x_invariant_offset + x_reduce_offset;
+                            curr_count++;
 
-                        curr_count++;
-
-                        AccDataType x = type_convert<AccDataType>(arg.p_x_[x_offset]);
+                            AccDataType x = type_convert<AccDataType>(arg.p_x_[x_offset]);
 
-                        AccDataType delta = x - mean;
+                            AccDataType delta = x - mean;
 
-                        mean += delta / curr_count;
+                            mean += delta / curr_count;
 
-                        AccDataType delta2 = x - mean;
+                            AccDataType delta2 = x - mean;
 
-                        variance += delta * delta2;
-                    };
+                            variance += delta * delta2;
+                        },
+                        arg.x_reduce_strides_);
 
                     // actual variance
                     variance = variance / curr_count;
@@ -239,26 +232,24 @@ struct ReferenceBatchNormBwd : public device::DeviceBatchNormBwd<XDataType,
                 // 1) calculate dy * (x - mean) * inv-variance
                 // 2) calculate sum(dy) on reduced dimensions
                 // 3) calculate sum(dy * norm_x) on reduced dimensions
-                for(const auto& reduce_index : arg.reduce_index_set_)
-                {
-                    size_t x_reduce_offset = get_offset_from_index<NumBatchNormReduceDim>(
-                        arg.x_reduce_strides_, reduce_index);
-                    size_t dy_reduce_offset = get_offset_from_index<NumBatchNormReduceDim>(
-                        arg.dy_reduce_strides_, reduce_index);
-
-                    auto x_offset  = x_invariant_offset + x_reduce_offset;
-                    auto dy_offset = dy_invariant_offset + dy_reduce_offset;
+                for_each_index_offset<NumBatchNormReduceDim>(
+                    arg.reduce_lengths_,
+                    [&](size_t, size_t x_reduce_offset, size_t dy_reduce_offset) {
+                        auto x_offset  = x_invariant_offset + x_reduce_offset;
+                        auto dy_offset = dy_invariant_offset + dy_reduce_offset;
 
-                    AccDataType x = type_convert<AccDataType>(arg.p_x_[x_offset]);
+                        AccDataType x = type_convert<AccDataType>(arg.p_x_[x_offset]);
 
-                    AccDataType norm_x = (x - mean) * invVar;
-                    AccDataType dy     = type_convert<AccDataType>(arg.p_dy_[dy_offset]);
+                        AccDataType norm_x = (x - mean) * invVar;
+                        AccDataType dy     = type_convert<AccDataType>(arg.p_dy_[dy_offset]);
 
-                    arg.dy_elementwise_op_(dy, dy);
+                        arg.dy_elementwise_op_(dy, dy);
 
-                    dbias += dy;
-                    dscale += norm_x * dy;
-                };
+                        dbias += dy;
+                        dscale += norm_x * dy;
+                    },
+                    arg.x_reduce_strides_,
+                    arg.dy_reduce_strides_);
 
                 size_t dscale_offset = get_offset_from_index<NumInvariantDim>(
                     arg.bnDscaleDbiasStrides_, invariant_index);
@@ -280,56 +271,37 @@ struct ReferenceBatchNormBwd : public device::DeviceBatchNormBwd<XDataType,
                 // 1) calculate tmp = dscale * (x - mean) * inv-variance
                 // 2) calculate dx = 1/reduceSize * inv-variance * scale * (reduceSize * dy - dbias
                 // - tmp)
-                for(const auto& reduce_index : arg.reduce_index_set_)
-                {
-                    size_t x_reduce_offset = get_offset_from_index<NumBatchNormReduceDim>(
-                        arg.x_reduce_strides_, reduce_index);
-                    size_t dy_reduce_offset = get_offset_from_index<NumBatchNormReduceDim>(
-                        arg.dy_reduce_strides_, reduce_index);
-                    size_t dx_reduce_offset = get_offset_from_index<NumBatchNormReduceDim>(
-                        arg.dx_reduce_strides_, reduce_index);
-
-                    auto x_offset  = x_invariant_offset + x_reduce_offset;
-                    auto dy_offset = dy_invariant_offset + dy_reduce_offset;
-                    auto dx_offset = dx_invariant_offset + dx_reduce_offset;
+                for_each_index_offset<NumBatchNormReduceDim>(
+                    arg.reduce_lengths_,
+                    [&](size_t,
+                        size_t x_reduce_offset,
+                        size_t dy_reduce_offset,
+                        size_t dx_reduce_offset) {
+                        auto x_offset  = x_invariant_offset + x_reduce_offset;
+                        auto dy_offset = dy_invariant_offset + dy_reduce_offset;
+                        auto dx_offset = dx_invariant_offset + dx_reduce_offset;
 
-                    AccDataType x = type_convert<AccDataType>(arg.p_x_[x_offset]);
+                        AccDataType x = type_convert<AccDataType>(arg.p_x_[x_offset]);
 
-                    AccDataType norm_x = (x - mean) * invVar;
-                    AccDataType dy     = type_convert<AccDataType>(arg.p_dy_[dy_offset]);
+                        AccDataType norm_x = (x - mean) * invVar;
+                        AccDataType dy     = type_convert<AccDataType>(arg.p_dy_[dy_offset]);
 
-                    arg.dy_elementwise_op_(dy, dy);
+                        arg.dy_elementwise_op_(dy, dy);
 
-                    AccDataType tmpVal = norm_x * dscale;
+                        AccDataType tmpVal = norm_x * dscale;
 
-                    AccDataType dx = multiplier * (type_convert<AccDataType>(arg.reduceSize_) * dy -
-                                                   dbias - tmpVal);
+                        AccDataType dx =
+                            multiplier *
+                            (type_convert<AccDataType>(arg.reduceSize_) * dy - dbias - tmpVal);
 
-                    arg.p_dx_[dx_offset] = type_convert<DxDataType>(dx);
-                };
+                        arg.p_dx_[dx_offset] = type_convert<DxDataType>(dx);
+                    },
+                    arg.x_reduce_strides_,
+                    arg.dy_reduce_strides_,
+                    arg.dx_reduce_strides_);
             };
 
-            std::size_t num_thread = std::thread::hardware_concurrency();
-            std::size_t work_per_thread =
-                (arg.invariant_index_set_.size() + num_thread - 1) / num_thread;
-
-            std::vector<joinable_thread> threads(num_thread);
-
-            for(std::size_t it = 0; it < num_thread; ++it)
-            {
-                std::size_t i_begin = it * work_per_thread;
-                std::size_t i_end   = std::min(static_cast<size_t>((it + 1) * work_per_thread),
-                                             arg.invariant_index_set_.size());
-
-                auto f = [=] {
-                    for(std::size_t i = i_begin; i < i_end; ++i)
-                    {
-                        thread_reduce_func(arg.invariant_index_set_[i]);
-                    }
-                };
-
-                threads[it] = joinable_thread(f);
-            }
+            parallel_for_each_index<NumInvariantDim>(arg.invariant_lengths_, thread_reduce_func);
 
             return (0.0f);
         };
@@ -69,8 +69,6 @@ struct ReferenceBatchNormInfer : public device::DeviceBatchNormInfer<XDataType,
               estimatedVariance_(estimatedVariance),
               p_y_(p_y)
         {
-            using ck::host_common::get_index_set;
-
             if(std::any_of(
                    reduceDims.begin(), reduceDims.end(), [](int d) { return d < 0 || d >= Rank; }))
                 throw std::runtime_error("Invalid reduce dimensions!");
@@ -113,9 +111,6 @@ struct ReferenceBatchNormInfer : public device::DeviceBatchNormInfer<XDataType,
                 i++;
             };
 
-            invariant_index_set_ = get_index_set<NumInvariantDim>(invariant_lengths_);
-            reduce_index_set_    = get_index_set<NumBatchNormReduceDim>(reduce_lengths_);
-
             epsilon_ = type_convert<AccDataType>(epsilon);
         }
 
@@ -144,9 +139,6 @@ struct ReferenceBatchNormInfer : public device::DeviceBatchNormInfer<XDataType,
 
         YDataType* p_y_;
 
-        std::vector<std::array<index_t, NumInvariantDim>> invariant_index_set_;
-        std::vector<std::array<index_t, NumBatchNormReduceDim>> reduce_index_set_;
-
         AccDataType epsilon_;
     };
 
@@ -154,7 +146,9 @@ struct ReferenceBatchNormInfer : public device::DeviceBatchNormInfer<XDataType,
     {
         float Run(const Argument& arg)
         {
+            using ck::host_common::for_each_index_offset;
             using ck::host_common::get_offset_from_index;
+            using ck::host_common::parallel_for_each_index;
 
             auto thread_reduce_func = [&](auto invariant_index) {
                 size_t x_invariant_offset = get_offset_from_index<NumInvariantDim>(
@@ -181,49 +175,27 @@ struct ReferenceBatchNormInfer : public device::DeviceBatchNormInfer<XDataType,
                 AccDataType bias  = type_convert<AccDataType>(arg.bnBias_[bias_offset]);
 
                 // normalization
-                for(const auto& reduce_index : arg.reduce_index_set_)
-                {
-                    size_t x_reduce_offset = get_offset_from_index<NumBatchNormReduceDim>(
-                        arg.x_reduce_strides_, reduce_index);
-                    size_t y_reduce_offset = get_offset_from_index<NumBatchNormReduceDim>(
-                        arg.y_reduce_strides_, reduce_index);
-
-                    auto x_offset = x_invariant_offset + x_reduce_offset;
-                    auto y_offset = y_invariant_offset + y_reduce_offset;
+                for_each_index_offset<NumBatchNormReduceDim>(
+                    arg.reduce_lengths_,
+                    [&](size_t, size_t x_reduce_offset, size_t y_reduce_offset) {
+                        auto x_offset = x_invariant_offset + x_reduce_offset;
+                        auto y_offset = y_invariant_offset + y_reduce_offset;
 
-                    AccDataType x = type_convert<AccDataType>(arg.p_x_[x_offset]);
+                        AccDataType x = type_convert<AccDataType>(arg.p_x_[x_offset]);
 
-                    AccDataType norm_x = (x - mean) * invVariance;
+                        AccDataType norm_x = (x - mean) * invVariance;
 
-                    AccDataType y = scale * norm_x + bias;
+                        AccDataType y = scale * norm_x + bias;
 
-                    arg.y_elementwise_op_(y, y);
+                        arg.y_elementwise_op_(y, y);
 
-                    arg.p_y_[y_offset] = type_convert<YDataType>(y);
-                };
+                        arg.p_y_[y_offset] = type_convert<YDataType>(y);
+                    },
+                    arg.x_reduce_strides_,
+                    arg.y_reduce_strides_);
             };
 
-            std::size_t num_thread = std::thread::hardware_concurrency();
-            std::size_t work_per_thread =
-                (arg.invariant_index_set_.size() + num_thread - 1) / num_thread;
-
-            std::vector<joinable_thread> threads(num_thread);
-
-            for(std::size_t it = 0; it < num_thread; ++it)
-            {
-                std::size_t i_begin = it * work_per_thread;
-                std::size_t i_end   = std::min(static_cast<size_t>((it + 1) * work_per_thread),
-                                             arg.invariant_index_set_.size());
-
-                auto f = [=] {
-                    for(std::size_t i = i_begin; i < i_end; ++i)
-                    {
-                        thread_reduce_func(arg.invariant_index_set_[i]);
-                    }
-                };
-
-                threads[it] = joinable_thread(f);
-            }
+            parallel_for_each_index<NumInvariantDim>(arg.invariant_lengths_, thread_reduce_func);
 
             return (0.0f);
         };
@@ -0,0 +1,388 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+// Cache-blocked, register-tiled CPU GEMM used as the fast path of the reference operators.
+//
+// Operands are converted to AccDataType while being packed into contiguous MR-tall (A) and
+// NR-wide (B) slivers, so the micro-kernel is a dense loop nest over a fixed-size accumulator tile
+// which the compiler keeps in vector registers. The loops are blocked as
+//   (MC x NC) output tile per task  ->  KC slice of K  ->  (MR x NR) register tile
+// Each output element is accumulated over k = 0, 1, ..., K - 1 in order by a single accumulator
+// that starts from zero, hence the result of blocked_gemm() is bit-identical to the naive triple
+// loop. batched_blocked_gemm() gives up that order to split the reduction of small outputs.
+struct BlockedGemmTileConfig
+{
+    static constexpr std::size_t MR = 4;
+    static constexpr std::size_t NR = 8;
+    static constexpr std::size_t MC = 64;
+    static constexpr std::size_t NC = 256;
+    static constexpr std::size_t KC = 256;
+};
+
+template <typename AccDataType>
+struct is_blocked_gemm_acc_type
+    : std::integral_constant<bool,
+                             std::is_same_v<AccDataType, float> ||
+                                 std::is_same_v<AccDataType, double> ||
+                                 std::is_same_v<AccDataType, int32_t>>
+{
+};
+
+template <typename AccDataType>
+inline constexpr bool is_blocked_gemm_acc_type_v = is_blocked_gemm_acc_type<AccDataType>::value;
+
+namespace detail {
+
+template <typename AccDataType, std::size_t MR, std::size_t NR>
+inline void blocked_gemm_micro_kernel(std::size_t kc,
+                                      const AccDataType* __restrict__ p_a_sliver,
+                                      const AccDataType* __restrict__ p_b_sliver,
+                                      AccDataType* __restrict__ p_c,
+                                      std::size_t ldc)
+{
+    AccDataType acc[MR][NR];
+
+    for(std::size_t i = 0; i < MR; ++i)
+        for(std::size_t j = 0; j < NR; ++j)
+            acc[i][j] = p_c[i * ldc + j];
+
+    for(std::size_t k = 0; k < kc; ++k)
+    {
+        const AccDataType* a = p_a_sliver + k * MR;
+        const AccDataType* b = p_b_sliver + k * NR;
+
+        for(std::size_t i = 0; i < MR; ++i)
+            for(std::size_t j = 0; j < NR; ++j)
+                acc[i][j] += a[i] * b[j];
+    }
+
+    for(std::size_t i = 0; i < MR; ++i)
+        for(std::size_t j = 0; j < NR; ++j)
+            p_c[i * ldc + j] = acc[i][j];
+}
+
+// Below this number of output tiles, batched_blocked_gemm() splits the reduction into chunks of at
+// least BlockedGemmMinKCsPerSplit slices of KC. Neither depends on the number of threads, so a
+// problem is always split the same way and its result does not depend on the thread count.
+inline constexpr std::size_t BlockedGemmSplitKMinTiles = 64;
+inline constexpr std::size_t BlockedGemmMinKCsPerSplit = 4;
+
+// C[m_begin:m_begin+mc, n_begin:n_begin+nc] = sum_{k_begin <= k < k_end} A[m, k] * B[k, n] into
+// p_c_tile, which holds (mc rounded up to MR) x (nc rounded up to NR) accumulators
+template <typename AccDataType, typename Config, typename ALoad, typename BLoad>
+void blocked_gemm_tile(std::size_t m_begin,
+                       std::size_t mc,
+                       std::size_t n_begin,
+                       std::size_t nc,
+                       std::size_t k_begin,
+                       std::size_t k_end,
+                       ALoad& a_load,
+                       BLoad& b_load,
+                       AccDataType* p_c_tile)
+{
+    constexpr std::size_t MR = Config::MR;
+    constexpr std::size_t NR = Config::NR;
+    constexpr std::size_t MC = Config::MC;
+    constexpr std::size_t NC = Config::NC;
+    constexpr std::size_t KC = Config::KC;
+
+    const std::size_t mc_padded = (mc + MR - 1) / MR * MR;
+    const std::size_t nc_padded = (nc + NR - 1) / NR * NR;
+
+    thread_local std::vector<AccDataType> a_packed;
+    thread_local std::vector<AccDataType> b_packed;
+
+    a_packed.resize(MC * KC);
+    b_packed.resize(KC * NC);
+    std::fill(p_c_tile, p_c_tile + mc_padded * nc_padded, AccDataType{0});
+
+    for(std::size_t k_slice = k_begin; k_slice < k_end; k_slice += KC)
+    {
+        const std::size_t kc = std::min(KC, k_end - k_slice);
+
+        // pack B[k_slice:k_slice+kc, n_begin:n_begin+nc] into NR-wide slivers, zero padded
+        for(std::size_t jr = 0; jr < nc_padded; jr += NR)
+        {
+            AccDataType* p_b_sliver = b_packed.data() + jr * kc;
+
+            for(std::size_t k = 0; k < kc; ++k)
+                for(std::size_t j = 0; j < NR; ++j)
+                    p_b_sliver[k * NR + j] = jr + j < nc ? b_load(k_slice + k, n_begin + jr + j)
+                                                         : AccDataType{0};
+        }
+
+        // pack A[m_begin:m_begin+mc, k_slice:k_slice+kc] into MR-tall slivers, zero padded
+        for(std::size_t ir = 0; ir < mc_padded; ir += MR)
+        {
+            AccDataType* p_a_sliver = a_packed.data() + ir * kc;
+
+            for(std::size_t k = 0; k < kc; ++k)
+                for(std::size_t i = 0; i < MR; ++i)
+                    p_a_sliver[k * MR + i] = ir + i < mc ? a_load(m_begin + ir + i, k_slice + k)
+                                                         : AccDataType{0};
+        }
+
+        for(std::size_t jr = 0; jr < nc_padded; jr += NR)
+            for(std::size_t ir = 0; ir < mc_padded; ir += MR)
+            {
+                blocked_gemm_micro_kernel<AccDataType, MR, NR>(kc,
+                                                               a_packed.data() + ir * kc,
+                                                               b_packed.data() + jr * kc,
+                                                               p_c_tile + ir * nc_padded + jr,
+                                                               nc_padded);
+            }
+    }
+}
+
+// G independent GEMMs C[g] = A[g] * B[g], parallel over (g, MC x NC tile). With k_per_split < K,
+// each tile is computed as the partial products of the chunks [0, k_per_split),
+// [k_per_split, 2 * k_per_split), ... in parallel, which are then summed in chunk order.
+template <typename AccDataType,
+          typename Config,
+          typename ALoad,
+          typename BLoad,
+          typename CStore>
+void run_blocked_gemm(std::size_t G,
+                      std::size_t M,
+                      std::size_t N,
+                      std::size_t K,
+                      std::size_t k_per_split,
+                      ALoad& a_load,
+                      BLoad& b_load,
+                      CStore& c_store,
+                      std::size_t num_thread)
+{
+    constexpr std::size_t MR = Config::MR;
+    constexpr std::size_t NR = Config::NR;
+    constexpr std::size_t MC = Config::MC;
+    constexpr std::size_t NC = Config::NC;
+
+    static_assert(MC % MR == 0 && NC % NR == 0, "MC/NC must be multiples of MR/NR");
+
+    if(G == 0 || M == 0 || N == 0)
+        return;
+
+    const std::size_t num_tile_m  = (M + MC - 1) / MC;
+    const std::size_t num_tile_n  = (N + NC - 1) / NC;
+    const std::size_t num_k_split = K > k_per_split ? (K + k_per_split - 1) / k_per_split : 1;
+
+    auto get_tile_lengths = [&](std::size_t mb, std::size_t nb) {
+        return std::make_pair(std::min(MC, M - mb * MC), std::min(NC, N - nb * NC));
+    };
+
+    auto store_tile = [&](std::size_t g, std::size_t mb, std::size_t nb, const AccDataType* p_c) {
+        const auto [mc, nc]         = get_tile_lengths(mb, nb);
+        const std::size_t nc_padded = (nc + NR - 1) / NR * NR;
+
+        for(std::size_t i = 0; i < mc; ++i)
+        {
+            if constexpr(std::is_invocable_v<CStore,
+                                             std::size_t,
+                                             std::size_t,
+                                             std::size_t,
+                                             const AccDataType*,
+                                             std::size_t>)
+            {
+                c_store(g, mb * MC + i, nb * NC, p_c + i * nc_padded, nc);
+            }
+            else
+            {
+                for(std::size_t j = 0; j < nc; ++j)
+                    c_store(g, mb * MC + i, nb * NC + j, p_c[i * nc_padded + j]);
+            }
+        }
+    };
+
+    auto compute_tile = [&](std::size_t g,
+                            std::size_t mb,
+                            std::size_t nb,
+                            std::size_t k_begin,
+                            std::size_t k_end,
+                            AccDataType* p_c) {
+        const auto [mc, nc] = get_tile_lengths(mb, nb);
+
+        auto a_load_g = [&](std::size_t m, std::size_t k) { return a_load(g, m, k); };
+        auto b_load_g = [&](std::size_t k, std::size_t n) { return b_load(g, k, n); };
+
+        blocked_gemm_tile<AccDataType, Config>(
+            mb * MC, mc, nb * NC, nc, k_begin, k_end, a_load_g, b_load_g, p_c);
+    };
+
+    if(num_k_split == 1)
+    {
+        auto f_tile = [&](std::size_t g, std::size_t mb, std::size_t nb) {
+            thread_local std::vector<AccDataType> c_tile;
+
+            c_tile.resize(MC * NC);
+
+            compute_tile(g, mb, nb, 0, K, c_tile.data());
+            store_tile(g, mb, nb, c_tile.data());
+        };
+
+        make_ParallelTensorFunctor(f_tile, G, num_tile_m, num_tile_n)(num_thread);
+
+        return;
+    }
+
+    // one MC x NC buffer per (g, tile, chunk), the chunks of a tile next to each other
+    std::vector<AccDataType> partials(G * num_tile_m * num_tile_n * num_k_split * MC * NC);
+
+    auto get_partials = [&](std::size_t g, std::size_t mb, std::size_t nb) {
+        return partials.data() + ((g * num_tile_m + mb) * num_tile_n + nb) * num_k_split * MC * NC;
+    };
+
+    auto f_partial = [&](std::size_t g, std::size_t mb, std::size_t nb, std::size_t ks) {
+        compute_tile(g,
+                     mb,
+                     nb,
+                     ks * k_per_split,
+                     std::min(K, (ks + 1) * k_per_split),
+                     get_partials(g, mb, nb) + ks * MC * NC);
+    };
+
+    make_ParallelTensorFunctor(f_partial, G, num_tile_m, num_tile_n, num_k_split)(num_thread);
+
+    auto f_reduce = [&](std::size_t g, std::size_t mb, std::size_t nb) {
+        AccDataType* p_c = get_partials(g, mb, nb);
+
+        for(std::size_t ks = 1; ks < num_k_split; ++ks)
+        {
+            const AccDataType* p_partial = p_c + ks * MC * NC;
+
+            for(std::size_t i = 0; i < MC * NC; ++i)
+                p_c[i] += p_partial[i];
+        }
+
+        store_tile(g, mb, nb, p_c);
+    };
+
+    make_ParallelTensorFunctor(f_reduce, G, num_tile_m, num_tile_n)(num_thread);
+}
+
+} // namespace detail
+
+// Length of the chunks batched_blocked_gemm() splits the reduction of a problem into, K or more if
+// the reduction is not split. The reduction is split when the G x M x N output has fewer than
+// BlockedGemmSplitKMinTiles tiles, into as many chunks as needed to reach that number of tasks,
+// each at least BlockedGemmMinKCsPerSplit x KC long.
+template <typename Config = BlockedGemmTileConfig>
+std::size_t get_blocked_gemm_k_per_split(std::size_t G, std::size_t M, std::size_t N, std::size_t K)
+{
+    constexpr std::size_t MC = Config::MC;
+    constexpr std::size_t NC = Config::NC;
+    constexpr std::size_t KC = Config::KC;
+
+    const std::size_t num_tile = G * ((M + MC - 1) / MC) * ((N + NC - 1) / NC);
+
+    if(num_tile == 0 || num_tile >= detail::BlockedGemmSplitKMinTiles)
+        return K;
+
+    const std::size_t num_kc = (K + KC - 1) / KC;
+    const std::size_t num_split =
+        std::min(std::max<std::size_t>(num_kc / detail::BlockedGemmMinKCsPerSplit, 1),
+                 (detail::BlockedGemmSplitKMinTiles + num_tile - 1) / num_tile);
+
+    return (num_kc + num_split - 1) / num_split * KC;
+}
+
+// C[m, n] = sum_k A[m, k] * B[k, n]
+//   a_load(m, k)      -> AccDataType : reads and converts one element of A
+//   b_load(k, n)      -> AccDataType : reads and converts one element of B
+//   c_store(m, n, acc)               : consumes the final accumulator of C[m, n], exactly once
+//     or c_store(m, n, p_acc, count) : consumes the final accumulators of C[m, n:n+count], so that
+//                                      the epilogue may process rows, e.g. with host span overloads
+// The loaders are called once per element per task while packing, never from the inner loop.
+template <typename AccDataType,
+          typename Config = BlockedGemmTileConfig,
+          typename ALoad,
+          typename BLoad,
+          typename CStore>
+void blocked_gemm(std::size_t M,
+                  std::size_t N,
+                  std::size_t K,
+                  ALoad&& a_load,
+                  BLoad&& b_load,
+                  CStore&& c_store,
+                  std::size_t num_thread = std::thread::hardware_concurrency())
+{
+    static_assert(is_blocked_gemm_acc_type_v<AccDataType>, "unsupported accumulation type");
+
+    auto a_load_g = [&](std::size_t, std::size_t m, std::size_t k) { return a_load(m, k); };
+    auto b_load_g = [&](std::size_t, std::size_t k, std::size_t n) { return b_load(k, n); };
+
+    if constexpr(std::is_invocable_v<CStore,
+                                     std::size_t,
+                                     std::size_t,
+                                     const AccDataType*,
+                                     std::size_t>)
+    {
+        auto c_store_g = [&](std::size_t,
+                             std::size_t m,
+                             std::size_t n,
+                             const AccDataType* p_acc,
+                             std::size_t count) { c_store(m, n, p_acc, count); };
+
+        detail::run_blocked_gemm<AccDataType, Config>(
+            1, M, N, K, K, a_load_g, b_load_g, c_store_g, num_thread);
+    }
+    else
+    {
+        auto c_store_g = [&](std::size_t, std::size_t m, std::size_t n, AccDataType v_acc) {
+            c_store(m, n, v_acc);
+        };
+
+        detail::run_blocked_gemm<AccDataType, Config>(
+            1, M, N, K, K, a_load_g, b_load_g, c_store_g, num_thread);
+    }
+}
+
+// G independent GEMMs C[g][m, n] = sum_k A[g][m, k] * B[g][k, n], with the loaders and the store
+// of blocked_gemm() taking the batch index g first. The tasks are the (g, MC x NC tile) pairs of
+// all the batches, and when they are too few to occupy the threads, the reduction is split as
+// given by get_blocked_gemm_k_per_split(). A split reduction is summed in a different order than
+// blocked_gemm(), but in the same order for any number of threads.
+template <typename AccDataType,
+          typename Config = BlockedGemmTileConfig,
+          typename ALoad,
+          typename BLoad,
+          typename CStore>
+void batched_blocked_gemm(std::size_t G,
+                          std::size_t M,
+                          std::size_t N,
+                          std::size_t K,
+                          ALoad&& a_load,
+                          BLoad&& b_load,
+                          CStore&& c_store,
+                          std::size_t num_thread = std::thread::hardware_concurrency())
+{
+    static_assert(is_blocked_gemm_acc_type_v<AccDataType>, "unsupported accumulation type");
+
+    detail::run_blocked_gemm<AccDataType, Config>(G,
+                                                  M,
+                                                  N,
+                                                  K,
+                                                  get_blocked_gemm_k_per_split<Config>(G, M, N, K),
+                                                  a_load,
+                                                  b_load,
+                                                  c_store,
+                                                  num_thread);
+}
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
@@ -9,6 +9,7 @@
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 
 #include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_im2col_gemm.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -73,6 +74,112 @@ struct ReferenceConvBwdData : public device::BaseOperator
     {
         using Argument = ReferenceConvBwdData::Argument;
 
+        // Lowers each group to the GEMM
+        //   in[N * Di * Hi * Wi, C] = im2col(out)[N * Di * Hi * Wi, Z * Y * X * K] *
+        //                             wei[Z * Y * X * K, C]
+        // where im2col(out) gathers, for each input pixel and filter tap, the output pixel it
+        // contributed to, or zero if there is none. The columns are ordered (z, y, x, k) like the
+        // loops of RunDirect(), so each input is accumulated in the same order and the result is
+        // bit-identical to RunDirect(), unless the input is too small for the threads and
+        // batched_blocked_gemm() splits the reduction. The groups run in parallel.
+        static void RunIm2ColGemm(const Argument& arg)
+        {
+            using detail::get_conv_spatial_lengths;
+            using detail::get_conv_spatial_params;
+            using detail::get_conv_tensor_offset;
+
+            const auto& in_strides  = arg.input_.GetStrides();
+            const auto& wei_strides = arg.weight_.GetStrides();
+            const auto& out_strides = arg.output_.GetStrides();
+
+            const std::size_t G = arg.input_.GetLengths()[0];
+            const std::size_t N = arg.input_.GetLengths()[1];
+            const std::size_t C = arg.input_.GetLengths()[2];
+            const std::size_t K = arg.weight_.GetLengths()[1];
+
+            const auto out_lengths = get_conv_spatial_lengths<NDimSpatial>(arg.output_.mDesc);
+            const auto strides     = get_conv_spatial_params<NDimSpatial>(arg.conv_strides_);
+            const auto dilations   = get_conv_spatial_params<NDimSpatial>(arg.conv_dilations_);
+            const auto left_pads   = get_conv_spatial_params<NDimSpatial>(arg.in_left_pads_);
+
+            // rows are (n, input pixel), columns are (filter tap, k)
+            const auto rows = detail::make_conv_im2col_indices<NDimSpatial>(
+                N, get_conv_spatial_lengths<NDimSpatial>(arg.input_.mDesc), true);
+            const auto cols = detail::make_conv_im2col_indices<NDimSpatial>(
+                K, get_conv_spatial_lengths<NDimSpatial>(arg.weight_.mDesc), false);
+
+            std::vector<float> wei_g_q_c(G * cols.size() * C);
+
+            // the weights are small, apply the elementwise op to them once
+            auto f_wei = [&](auto g, auto c) {
+                for(std::size_t q = 0; q < cols.size(); ++q)
+                {
+                    const auto& col = cols[q];
+
+                    const std::size_t wei_offset = get_conv_tensor_offset<NDimSpatial>(
+                        wei_strides, g, col.idx_, c, col.spatial_);
+
+                    float v_wei = 0;
+
+                    arg.wei_element_op_(v_wei,
+                                        ck::type_convert<float>(arg.weight_.mData[wei_offset]));
+
+                    wei_g_q_c[(g * cols.size() + q) * C + c] = v_wei;
+                }
+            };
+
+            make_ParallelTensorFunctor(f_wei, G, C)(std::thread::hardware_concurrency());
+
+            auto a_load = [&](std::size_t g, std::size_t m, std::size_t q) {
+                const auto& row = rows[m];
+                const auto& col = cols[q];
+
+                std::array<long_index_t, NDimSpatial> wo;
+
+                for(index_t d = 0; d < NDimSpatial; ++d)
+                {
+                    const long_index_t w_tmp =
+                        row.spatial_[d] + left_pads[d] - col.spatial_[d] * dilations[d];
+
+                    if(w_tmp % strides[d] != 0)
+                        return 0.f;
+
+                    wo[d] = w_tmp / strides[d];
+
+                    if(wo[d] < 0 || wo[d] >= out_lengths[d])
+                        return 0.f;
+                }
+
+                const std::size_t out_offset =
+                    get_conv_tensor_offset<NDimSpatial>(out_strides, g, row.idx_, col.idx_, wo);
+
+                float v_out = 0;
+
+                arg.out_element_op_(v_out, ck::type_convert<float>(arg.output_.mData[out_offset]));
+
+                return v_out;
+            };
+
+            auto b_load = [&](std::size_t g, std::size_t q, std::size_t c) {
+                return wei_g_q_c[(g * cols.size() + q) * C + c];
+            };
+
+            auto c_store = [&](std::size_t g, std::size_t m, std::size_t c, float v_acc) {
+                const auto& row = rows[m];
+
+                const std::size_t in_offset = get_conv_tensor_offset<NDimSpatial>(
+                    in_strides, g, row.idx_, c, row.spatial_);
+
+                float v_in;
+
+                arg.in_element_op_(v_in, v_acc);
+
+                arg.input_.mData[in_offset] = ck::type_convert<InDataType>(v_in);
+            };
+
+            batched_blocked_gemm<float>(G, rows.size(), C, cols.size(), a_load, b_load, c_store);
+        }
+
         float Run(const Argument& arg)
         {
             if(!(arg.input_.GetNumOfDimension() == NDimSpatial + 3 &&
@@ -82,6 +189,21 @@ struct ReferenceConvBwdData : public device::BaseOperator
                 throw std::runtime_error("wrong! inconsistent dimension");
             }
 
+            RunIm2ColGemm(arg);
+
+            return 0;
+        }
+
+        // direct convolution, one input element at a time
+        float RunDirect(const Argument& arg)
+        {
+            if(!(arg.input_.GetNumOfDimension() == NDimSpatial + 3 &&
+                 arg.weight_.GetNumOfDimension() == NDimSpatial + 3 &&
+                 arg.output_.GetNumOfDimension() == NDimSpatial + 3))
+            {
+                throw std::runtime_error("wrong! inconsistent dimension");
+            }
+
             if constexpr(NDimSpatial == 1)
             {
                 auto f_ncw = [&](auto g, auto n, auto c, auto wi) {
@@ -9,6 +9,7 @@
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 
 #include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_im2col_gemm.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -75,6 +76,93 @@ struct ReferenceConvBwdWeight : public device::BaseOperator
     {
         using Argument = ReferenceConvBwdWeight::Argument;
 
+        // Lowers each group to the GEMM
+        //   wei[K, C * Z * Y * X] = out[K, N * Do * Ho * Wo] *
+        //                           im2col(in)[N * Do * Ho * Wo, C * Z * Y * X]
+        // The reduction runs over (n, output pixel) in the order of the loops of RunDirect(), so
+        // each weight is accumulated in the same order and the result is bit-identical to
+        // RunDirect(), unless the weights are too few for the threads and batched_blocked_gemm()
+        // splits that long reduction. The groups run in parallel.
+        static void RunIm2ColGemm(const Argument& arg)
+        {
+            using detail::get_conv_spatial_lengths;
+            using detail::get_conv_spatial_params;
+            using detail::get_conv_tensor_offset;
+
+            const auto& in_strides  = arg.input_.GetStrides();
+            const auto& wei_strides = arg.weight_.GetStrides();
+            const auto& out_strides = arg.output_.GetStrides();
+
+            const std::size_t G = arg.weight_.GetLengths()[0];
+            const std::size_t K = arg.weight_.GetLengths()[1];
+            const std::size_t C = arg.weight_.GetLengths()[2];
+            const std::size_t N = arg.output_.GetLengths()[1];
+
+            const auto in_lengths = get_conv_spatial_lengths<NDimSpatial>(arg.input_.mDesc);
+            const auto strides    = get_conv_spatial_params<NDimSpatial>(arg.conv_strides_);
+            const auto dilations  = get_conv_spatial_params<NDimSpatial>(arg.conv_dilations_);
+            const auto left_pads  = get_conv_spatial_params<NDimSpatial>(arg.in_left_pads_);
+
+            // reduction index is (n, output pixel), columns are (c, filter tap)
+            const auto pixels = detail::make_conv_im2col_indices<NDimSpatial>(
+                N, get_conv_spatial_lengths<NDimSpatial>(arg.output_.mDesc), true);
+            const auto cols = detail::make_conv_im2col_indices<NDimSpatial>(
+                C, get_conv_spatial_lengths<NDimSpatial>(arg.weight_.mDesc), true);
+
+            auto a_load = [&](std::size_t g, std::size_t k, std::size_t p) {
+                const auto& pixel = pixels[p];
+
+                const std::size_t out_offset = get_conv_tensor_offset<NDimSpatial>(
+                    out_strides, g, pixel.idx_, k, pixel.spatial_);
+
+                ComputeTypeA v_out;
+
+                arg.out_element_op_(v_out, ck::type_convert<float>(arg.output_.mData[out_offset]));
+
+                return type_convert<float>(v_out);
+            };
+
+            auto b_load = [&](std::size_t g, std::size_t p, std::size_t q) {
+                const auto& pixel = pixels[p];
+                const auto& col   = cols[q];
+
+                std::array<long_index_t, NDimSpatial> wi;
+
+                for(index_t d = 0; d < NDimSpatial; ++d)
+                {
+                    wi[d] = pixel.spatial_[d] * strides[d] + col.spatial_[d] * dilations[d] -
+                            left_pads[d];
+
+                    if(wi[d] < 0 || wi[d] >= in_lengths[d])
+                        return 0.f;
+                }
+
+                const std::size_t in_offset = get_conv_tensor_offset<NDimSpatial>(
+                    in_strides, g, pixel.idx_, col.idx_, wi);
+
+                ComputeTypeB v_in;
+
+                arg.in_element_op_(v_in, ck::type_convert<float>(arg.input_.mData[in_offset]));
+
+                return type_convert<float>(v_in);
+            };
+
+            auto c_store = [&](std::size_t g, std::size_t k, std::size_t q, float v_acc) {
+                const auto& col = cols[q];
+
+                const std::size_t wei_offset = get_conv_tensor_offset<NDimSpatial>(
+                    wei_strides, g, k, col.idx_, col.spatial_);
+
+                float v_wei;
+
+                arg.wei_element_op_(v_wei, v_acc);
+
+                arg.weight_.mData[wei_offset] = ck::type_convert<WeiDataType>(v_wei);
+            };
+
+            batched_blocked_gemm<float>(G, K, cols.size(), pixels.size(), a_load, b_load, c_store);
+        }
+
         float Run(const Argument& arg)
         {
             if(!(arg.input_.GetNumOfDimension() == NDimSpatial + 3 &&
@@ -84,6 +172,21 @@ struct ReferenceConvBwdWeight : public device::BaseOperator
                 throw std::runtime_error("wrong! inconsistent dimension");
             }
 
+            RunIm2ColGemm(arg);
+
+            return 0;
+        }
+
+        // direct convolution, one weight element at a time
+        float RunDirect(const Argument& arg)
+        {
+            if(!(arg.input_.GetNumOfDimension() == NDimSpatial + 3 &&
+                 arg.weight_.GetNumOfDimension() == NDimSpatial + 3 &&
+                 arg.output_.GetNumOfDimension() == NDimSpatial + 3))
+            {
+                throw std::runtime_error("wrong! inconsistent dimension");
+            }
+
             if constexpr(NDimSpatial == 1)
             {
                 auto f_kcx = [&](auto g, auto k, auto c, auto x) {
@@ -6,6 +6,7 @@
 #include <cmath>
 #include <cstdlib>
 #include <numeric>
+#include <tuple>
 #include <type_traits>
 #include <vector>
 
@@ -20,6 +21,7 @@
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/convolution_parameter.hpp"
 #include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_im2col_gemm.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -117,6 +119,141 @@ struct ReferenceConvFwd : public device::BaseOperator
     {
         using Argument = ReferenceConvFwd::Argument;
 
+        // Lowers each group to the GEMM
+        //   out[N * Do * Ho * Wo, K] = im2col(in)[N * Do * Ho * Wo, C * Z * Y * X] *
+        //                              wei[C * Z * Y * X, K]
+        // The im2col matrix is only ever packed tile by tile inside batched_blocked_gemm(). Its
+        // columns are ordered (c, z, y, x) like the loops of RunDirect() rather than (z, y, x, c)
+        // like ReferenceImageToColumn, so each output is accumulated in the same order and the
+        // result is bit-identical to RunDirect(), unless the output is too small for the threads
+        // and batched_blocked_gemm() splits the reduction. The groups run in parallel.
+        static void RunIm2ColGemm(const Argument& arg)
+        {
+            using detail::get_conv_spatial_lengths;
+            using detail::get_conv_spatial_params;
+            using detail::get_conv_tensor_offset;
+
+            const auto& in_strides  = arg.input_.GetStrides();
+            const auto& wei_strides = arg.weight_.GetStrides();
+            const auto& out_strides = arg.output_.GetStrides();
+
+            const std::size_t G = arg.output_.GetLengths()[0];
+            const std::size_t N = arg.output_.GetLengths()[1];
+            const std::size_t K = arg.output_.GetLengths()[2];
+            const std::size_t C = arg.weight_.GetLengths()[2];
+
+            const auto in_lengths = get_conv_spatial_lengths<NDimSpatial>(arg.input_.mDesc);
+            const auto strides    = get_conv_spatial_params<NDimSpatial>(arg.conv_strides_);
+            const auto dilations  = get_conv_spatial_params<NDimSpatial>(arg.conv_dilations_);
+            const auto left_pads  = get_conv_spatial_params<NDimSpatial>(arg.in_left_pads_);
+
+            // rows are (n, output pixel), columns are (c, filter tap)
+            const auto rows = detail::make_conv_im2col_indices<NDimSpatial>(
+                N, get_conv_spatial_lengths<NDimSpatial>(arg.output_.mDesc), true);
+            const auto cols = detail::make_conv_im2col_indices<NDimSpatial>(
+                C, get_conv_spatial_lengths<NDimSpatial>(arg.weight_.mDesc), true);
+
+            std::vector<float> wei_g_q_k(G * cols.size() * K);
+
+            // the weights are small, apply the elementwise op to them once
+            auto f_wei = [&](auto g, auto k) {
+                for(std::size_t q = 0; q < cols.size(); ++q)
+                {
+                    const auto& col = cols[q];
+
+                    const std::size_t wei_offset = get_conv_tensor_offset<NDimSpatial>(
+                        wei_strides, g, k, col.idx_, col.spatial_);
+
+                    WeiDataType v_wei;
+
+                    std::apply(
+                        [&](auto... x) {
+                            ExecuteElementwiseOp(arg.wei_element_op_,
+                                                 arg.elementwise_b_tensors_,
+                                                 Number<NumBElementwiseTensor>{},
+                                                 v_wei,
+                                                 arg.weight_.mData[wei_offset],
+                                                 g,
+                                                 k,
+                                                 col.idx_,
+                                                 x...);
+                        },
+                        col.spatial_);
+
+                    wei_g_q_k[(g * cols.size() + q) * K + k] = ck::type_convert<float>(v_wei);
+                }
+            };
+
+            make_ParallelTensorFunctor(f_wei, G, K)(std::thread::hardware_concurrency());
+
+            auto a_load = [&](std::size_t g, std::size_t m, std::size_t q) {
+                const auto& row = rows[m];
+                const auto& col = cols[q];
+
+                std::array<long_index_t, NDimSpatial> wi;
+
+                for(index_t d = 0; d < NDimSpatial; ++d)
+                {
+                    wi[d] = row.spatial_[d] * strides[d] + col.spatial_[d] * dilations[d] -
+                            left_pads[d];
+
+                    if(wi[d] < 0 || wi[d] >= in_lengths[d])
+                        return 0.f;
+                }
+
+                const std::size_t in_offset =
+                    get_conv_tensor_offset<NDimSpatial>(in_strides, g, row.idx_, col.idx_, wi);
+
+                InDataType v_in;
+
+                std::apply(
+                    [&](auto... x) {
+                        ExecuteElementwiseOp(arg.in_element_op_,
+                                             arg.elementwise_a_tensors_,
+                                             Number<NumAElementwiseTensor>{},
+                                             v_in,
+                                             arg.input_.mData[in_offset],
+                                             g,
+                                             row.idx_,
+                                             col.idx_,
+                                             x...);
+                    },
+                    wi);
+
+                return ck::type_convert<float>(v_in);
+            };
+
+            auto b_load = [&](std::size_t g, std::size_t q, std::size_t k) {
+                return wei_g_q_k[(g * cols.size() + q) * K + k];
+            };
+
+            auto c_store = [&](std::size_t g, std::size_t m, std::size_t k, float v_acc) {
+                const auto& row = rows[m];
+
+                const std::size_t out_offset = get_conv_tensor_offset<NDimSpatial>(
+                    out_strides, g, row.idx_, k, row.spatial_);
+
+                OutDataType v_acc_converted = ck::type_convert<OutDataType>(v_acc);
+                OutDataType& v_out          = arg.output_.mData[out_offset];
+
+                std::apply(
+                    [&](auto... x) {
+                        ExecuteElementwiseOp(arg.out_element_op_,
+                                             arg.elementwise_d_tensors_,
+                                             Number<NumDElementwiseTensor>{},
+                                             v_out,
+                                             v_acc_converted,
+                                             g,
+                                             row.idx_,
+                                             k,
+                                             x...);
+                    },
+                    row.spatial_);
+            };
+
+            batched_blocked_gemm<float>(G, rows.size(), K, cols.size(), a_load, b_load, c_store);
+        }
+
         float Run(const Argument& arg)
         {
             if(!(arg.input_.GetNumOfDimension() == NDimSpatial + 3 &&
@@ -126,6 +263,21 @@ struct ReferenceConvFwd : public device::BaseOperator
                 throw std::runtime_error("wrong! inconsistent dimension");
             }
 
+            RunIm2ColGemm(arg);
+
+            return 0;
+        }
+
+        // direct convolution, one output element at a time
+        float RunDirect(const Argument& arg)
+        {
+            if(!(arg.input_.GetNumOfDimension() == NDimSpatial + 3 &&
+                 arg.weight_.GetNumOfDimension() == NDimSpatial + 3 &&
+                 arg.output_.GetNumOfDimension() == NDimSpatial + 3))
+            {
+                throw std::runtime_error("wrong! inconsistent dimension");
+            }
+
             if constexpr(NDimSpatial == 1)
             {
                 auto func = [&](auto g, auto n, auto k, auto wo) {
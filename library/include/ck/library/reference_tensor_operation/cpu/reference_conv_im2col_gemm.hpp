@@ -0,0 +1,110 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include "ck/ck.hpp"
+
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_blocked_gemm.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+// Helpers to lower the reference convolutions to blocked_gemm() over an implicit im2col matrix.
+//
+// As in ReferenceImageToColumn, a row or column of the im2col matrix pairs a non-spatial index
+// (N, C or K) with a spatial index (output pixel, input pixel or filter tap). The matrix is never
+// materialized: the convolutions resolve an element from its row and column in the loaders of
+// blocked_gemm(), so only the packed tiles exist at any time. Out-of-image (padding) elements read
+// as zero.
+namespace detail {
+
+template <index_t NDimSpatial>
+struct ConvIm2ColIndex
+{
+    std::size_t idx_;
+    std::array<long_index_t, NDimSpatial> spatial_;
+};
+
+// spatial part of a [G, N/K, C/K, spatial...] tensor descriptor
+template <index_t NDimSpatial>
+std::array<long_index_t, NDimSpatial> get_conv_spatial_lengths(const HostTensorDescriptor& desc)
+{
+    std::array<long_index_t, NDimSpatial> lengths;
+
+    for(index_t d = 0; d < NDimSpatial; ++d)
+        lengths[d] = static_cast<long_index_t>(desc.GetLengths()[3 + d]);
+
+    return lengths;
+}
+
+template <index_t NDimSpatial>
+std::array<long_index_t, NDimSpatial> get_conv_spatial_params(const std::vector<index_t>& params)
+{
+    std::array<long_index_t, NDimSpatial> values;
+
+    for(index_t d = 0; d < NDimSpatial; ++d)
+        values[d] = static_cast<long_index_t>(params[d]);
+
+    return values;
+}
+
+// All (idx, spatial index) pairs for idx in [0, length), in row-major order with idx as the
+// outermost dimension, or as the innermost one if idx_major is false
+template <index_t NDimSpatial>
+std::vector<ConvIm2ColIndex<NDimSpatial>>
+make_conv_im2col_indices(std::size_t length,
+                         const std::array<long_index_t, NDimSpatial>& spatial_lengths,
+                         bool idx_major)
+{
+    std::size_t spatial_size = 1;
+
+    for(index_t d = 0; d < NDimSpatial; ++d)
+        spatial_size *= static_cast<std::size_t>(spatial_lengths[d]);
+
+    std::vector<ConvIm2ColIndex<NDimSpatial>> indices(length * spatial_size);
+
+    for(std::size_t i = 0; i < indices.size(); ++i)
+    {
+        auto& index = indices[i];
+
+        std::size_t spatial_offset = idx_major ? i % spatial_size : i / length;
+
+        index.idx_ = idx_major ? i / spatial_size : i % length;
+
+        for(index_t d = NDimSpatial - 1; d >= 0; --d)
+        {
+            index.spatial_[d] = static_cast<long_index_t>(spatial_offset % spatial_lengths[d]);
+            spatial_offset /= spatial_lengths[d];
+        }
+    }
+
+    return indices;
+}
+
+// offset of element (g, i0, i1, spatial...) of a [G, N/K, C/K, spatial...] tensor
+template <index_t NDimSpatial>
+inline std::size_t get_conv_tensor_offset(const std::vector<std::size_t>& strides,
+                                          std::size_t g,
+                                          std::size_t i0,
+                                          std::size_t i1,
+                                          const std::array<long_index_t, NDimSpatial>& spatial)
+{
+    std::size_t offset = g * strides[0] + i0 * strides[1] + i1 * strides[2];
+
+    for(index_t d = 0; d < NDimSpatial; ++d)
+        offset += static_cast<std::size_t>(spatial[d]) * strides[3 + d];
+
+    return offset;
+}
+
+} // namespace detail
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "ck/tensor_operation/gpu/element/unary_element_wise_operation.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_thread_pool.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+// op(y(idx), xs(idx)...) for every index of y: the element-wise epilogue of the references of fused
+// operations, e.g. the activation after a reference GEMM or convolution. The tensors are Tensor or
+// TensorView of the lengths of y, the xs may be broadcast through strides of 0.
+//
+// The tensors are processed a row at a time along the dimension in which y is contiguous, e.g. K of
+// an NHWK output, with the host span overload of op when it has one and the rows of all the xs are
+// contiguous too. The rows are spread over the host thread pool.
+template <typename ElementwiseOperation, typename YTensor, typename... XTensors>
+void reference_element_wise(const ElementwiseOperation& op, YTensor&& y, const XTensors&... xs)
+{
+    const auto& lengths        = y.mDesc.GetLengths();
+    const auto& strides        = y.mDesc.GetStrides();
+    const std::size_t num_dim  = lengths.size();
+    const std::size_t num_elem = y.mDesc.GetElementSize();
+
+    if(num_elem == 0)
+    {
+        return;
+    }
+
+    // a scalar has no dimension to take rows along
+    if(num_dim == 0)
+    {
+        const std::vector<std::size_t> idx;
+
+        op(y(idx), xs(idx)...);
+        return;
+    }
+
+    // the dimension of the rows, the innermost one if y is contiguous in none
+    std::size_t row_dim = num_dim - 1;
+
+    for(std::size_t d = 0; d < num_dim; ++d)
+    {
+        if(strides[d] == 1 && lengths[d] > 1)
+        {
+            row_dim = d;
+        }
+    }
+
+    const std::size_t row_length = lengths[row_dim];
+    const std::size_t num_row    = num_elem / row_length;
+
+    const bool contiguous =
+        strides[row_dim] == 1 && ((xs.mDesc.GetStrides()[row_dim] == 1) && ...);
+
+    auto f_rows = [&](std::size_t row_begin, std::size_t row_end) {
+        std::vector<std::size_t> idx(num_dim, 0);
+
+        for(std::size_t row = row_begin; row < row_end; ++row)
+        {
+            // index of the first element of the row
+            std::size_t i = row;
+
+            for(std::size_t d = num_dim; d-- > 0;)
+            {
+                if(d != row_dim)
+                {
+                    idx[d] = i % lengths[d];
+                    i /= lengths[d];
+                }
+            }
+
+            idx[row_dim] = 0;
+
+            if(contiguous)
+            {
+                element_wise::apply_host_span(op, row_length, &y(idx), &xs(idx)...);
+                continue;
+            }
+
+            for(std::size_t j = 0; j < row_length; ++j)
+            {
+                idx[row_dim] = j;
+
+                op(y(idx), xs(idx)...);
+            }
+        }
+    };
+
+    ck::utils::host_parallel_for(num_row, f_rows);
+}
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
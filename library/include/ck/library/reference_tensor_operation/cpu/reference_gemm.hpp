@@ -9,6 +9,8 @@
 #include "ck/tensor_operation/gpu/element/unary_element_wise_operation.hpp"
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_view.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_blocked_gemm.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -28,9 +30,9 @@ struct ReferenceGemm : public device::BaseOperator
     // Argument
     struct Argument : public device::BaseArgument
     {
-        Argument(const Tensor<ADataType>& a_m_k,
-                 const Tensor<BDataType>& b_k_n,
-                 Tensor<CDataType>& c_m_n,
+        Argument(TensorView<const ADataType> a_m_k,
+                 TensorView<const BDataType> b_k_n,
+                 TensorView<CDataType> c_m_n,
                  AElementwiseOperation a_element_op,
                  BElementwiseOperation b_element_op,
                  CElementwiseOperation c_element_op)
@@ -43,9 +45,9 @@ struct ReferenceGemm : public device::BaseOperator
         {
         }
 
-        const Tensor<ADataType>& a_m_k_;
-        const Tensor<BDataType>& b_k_n_;
-        Tensor<CDataType>& c_m_n_;
+        TensorView<const ADataType> a_m_k_;
+        TensorView<const BDataType> b_k_n_;
+        TensorView<CDataType> c_m_n_;
 
         AElementwiseOperation a_element_op_;
         BElementwiseOperation b_element_op_;
@@ -57,8 +59,86 @@ struct ReferenceGemm : public device::BaseOperator
     {
         using Argument = ReferenceGemm::Argument;
 
+        // ConvertBF16RTN is treated as PassThrough by the reference calculation
+        template <typename ElementwiseOperation>
+        static constexpr bool is_pass_through_v =
+            is_same_v<ElementwiseOperation, ck::tensor_operation::element_wise::PassThrough> ||
+            is_same_v<ElementwiseOperation, ck::tensor_operation::element_wise::ConvertBF16RTN>;
+
+        static constexpr bool UseBlockedGemm = is_pass_through_v<AElementwiseOperation> &&
+                                               is_pass_through_v<BElementwiseOperation> &&
+                                               is_blocked_gemm_acc_type_v<AccDataType>;
+
+        static bool IsPlainMatrix(const HostTensorDescriptor& desc)
+        {
+            return desc.GetNumOfDimension() == 2 &&
+                   (desc.GetStrides()[0] == 1 || desc.GetStrides()[1] == 1);
+        }
+
+        static void RunBlocked(const Argument& arg)
+        {
+            const auto& a_strides = arg.a_m_k_.mDesc.GetStrides();
+            const auto& b_strides = arg.b_k_n_.mDesc.GetStrides();
+
+            const ADataType* p_a = arg.a_m_k_.mData;
+            const BDataType* p_b = arg.b_k_n_.mData;
+
+            auto a_load = [&](std::size_t m, std::size_t k) {
+                ComputeTypeA v_a;
+                ck::tensor_operation::element_wise::PassThrough{}(
+                    v_a, p_a[m * a_strides[0] + k * a_strides[1]]);
+                return ck::type_convert<AccDataType>(v_a);
+            };
+
+            auto b_load = [&](std::size_t k, std::size_t n) {
+                ComputeTypeB v_b;
+                ck::tensor_operation::element_wise::PassThrough{}(
+                    v_b, p_b[k * b_strides[0] + n * b_strides[1]]);
+                return ck::type_convert<AccDataType>(v_b);
+            };
+
+            const auto& c_strides = arg.c_m_n_.mDesc.GetStrides();
+
+            // the output rows, with the host span overload of the C operation if it has one
+            auto c_store =
+                [&](std::size_t m, std::size_t n, const AccDataType* p_acc, std::size_t count) {
+                    CDataType* p_c = arg.c_m_n_.mData + m * c_strides[0] + n * c_strides[1];
+
+                    if(c_strides[1] == 1)
+                    {
+                        element_wise::apply_host_span(arg.c_element_op_, count, p_c, p_acc);
+                        return;
+                    }
+
+                    for(std::size_t j = 0; j < count; ++j)
+                    {
+                        CDataType v_c;
+
+                        arg.c_element_op_(v_c, p_acc[j]);
+
+                        p_c[j * c_strides[1]] = v_c;
+                    }
+                };
+
+            blocked_gemm<AccDataType>(arg.c_m_n_.mDesc.GetLengths()[0],
+                                      arg.c_m_n_.mDesc.GetLengths()[1],
+                                      arg.a_m_k_.mDesc.GetLengths()[1],
+                                      a_load,
+                                      b_load,
+                                      c_store);
+        }
+
         float Run(const Argument& arg)
         {
+            if constexpr(UseBlockedGemm)
+            {
+                if(IsPlainMatrix(arg.a_m_k_.mDesc) && IsPlainMatrix(arg.b_k_n_.mDesc))
+                {
+                    RunBlocked(arg);
+                    return 0;
+                }
+            }
+
             auto f_mk_kn_mn = [&](auto m, auto n) {
                 const int K = arg.a_m_k_.mDesc.GetLengths()[1];
 
@@ -123,9 +203,9 @@ struct ReferenceGemm : public device::BaseOperator
 
     bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
 
-    static auto MakeArgument(const Tensor<ADataType>& a_m_k,
-                             const Tensor<BDataType>& b_k_n,
-                             Tensor<CDataType>& c_m_n,
+    static auto MakeArgument(TensorView<const ADataType> a_m_k,
+                             TensorView<const BDataType> b_k_n,
+                             TensorView<CDataType> c_m_n,
                              AElementwiseOperation a_element_op,
                              BElementwiseOperation b_element_op,
                              CElementwiseOperation c_element_op)
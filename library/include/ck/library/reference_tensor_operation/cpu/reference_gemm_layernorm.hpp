@@ -6,6 +6,7 @@
 #include <iostream>
 #include <sstream>
 #include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_welford.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -41,41 +42,33 @@ struct ReferenceGemmLayernorm : public device::BaseOperator
         assert(acc.mDesc.GetLengths()[1] == gamma.mDesc.GetLengths()[0] &&
                acc.mDesc.GetLengths()[1] == beta.mDesc.GetLengths()[0]);
 
-        size_t M = acc.mDesc.GetLengths()[0];
-        size_t N = acc.mDesc.GetLengths()[1];
+        const std::size_t M = acc.mDesc.GetLengths()[0];
+        const std::size_t N = acc.mDesc.GetLengths()[1];
 
-        Tensor<ComputeDataType> avg_acc_sq({M});
-        Tensor<ComputeDataType> avg_acc({M});
-        Tensor<ComputeDataType> acc_layernorm(acc);
+        const ComputeDataType eps = ck::type_convert<ComputeDataType>(epsilon);
 
         // reduce N dim
-        for(size_t i = 0; i < M; i++)
-        {
-            ComputeDataType sum_acc_sq = 0;
-            ComputeDataType sum_acc    = 0;
-            for(size_t j = 0; j < N; j++)
-            {
-                sum_acc_sq += acc_layernorm(i, j) * acc_layernorm(i, j);
-                sum_acc += acc_layernorm(i, j);
-            }
-            avg_acc_sq(i) = sum_acc_sq / N;
-            avg_acc(i)    = sum_acc / N;
-        }
+        const auto welford = welford_reduce_rows<ComputeDataType>(
+            M, N, [&](auto m, auto n_begin, auto n_end, auto& row_welford) {
+                for(std::size_t n = n_begin; n < n_end; ++n)
+                    row_welford.Update(acc(m, n));
+            });
 
-        // normalize
-        acc_layernorm.ForEach([&](auto& self, auto idx) {
-            self(idx[0], idx[1]) =
-                (self(idx[0], idx[1]) - avg_acc(idx[0])) /
-                sqrt(avg_acc_sq(idx[0]) - avg_acc(idx[0]) * avg_acc(idx[0]) + epsilon);
-        });
+        // normalize, affine and cast
+        parallel_for_row_chunks(M, N, [&](auto m, auto n_begin, auto n_end) {
+            const ComputeDataType mean    = welford[m].GetMean();
+            const ComputeDataType inv_std =
+                static_cast<ComputeDataType>(1) / ck::math::sqrt(welford[m].GetVariance() + eps);
 
-        // affine
-        acc_layernorm.ForEach([&](auto& self, auto idx) {
-            self(idx[0], idx[1]) = self(idx[0], idx[1]) * gamma(idx[1]) + beta(idx[1]);
-        });
+            for(std::size_t n = n_begin; n < n_end; ++n)
+            {
+                const ComputeDataType gamma_n = ck::type_convert<ComputeDataType>(gamma(n));
+                const ComputeDataType beta_n  = ck::type_convert<ComputeDataType>(beta(n));
 
-        // cast
-        result = acc_layernorm.template CopyAsType<OutDataType>();
+                result(m, n) =
+                    ck::type_convert<OutDataType>((acc(m, n) - mean) * inv_std * gamma_n + beta_n);
+            }
+        });
     }
 
     // Argument
@@ -146,25 +139,30 @@ struct ReferenceGemmLayernorm : public device::BaseOperator
             // gemm
             ref_invoker.Run(ref_argument);
 
-            // activation(acc + bias)
-            acc_m_n.ForEach([&](auto& self, auto idx) {
-                AccDataType out;
-                arg.acc_element_op_(out, acc_m_n(idx[0], idx[1]) + arg.c0_n_bias_(idx[1]));
-                self(idx[0], idx[1]) = out;
-            });
+            // activation(acc + bias) + add from other layers
+            auto f_epilogue = [&](auto m) {
+                for(std::size_t n = 0; n < acc_m_n.mDesc.GetLengths()[1]; ++n)
+                {
+                    AccDataType out;
+                    arg.acc_element_op_(out, acc_m_n(m, n) + arg.c0_n_bias_(n));
+                    acc_m_n(m, n) = out + arg.c0_m_n_add_(m, n);
+                }
+            };
 
-            // add from other layers
-            acc_m_n.ForEach([&](auto& self, auto idx) {
-                self(idx[0], idx[1]) += arg.c0_m_n_add_(idx[0], idx[1]);
-            });
+            make_ParallelTensorFunctor(f_epilogue, acc_m_n.mDesc.GetLengths()[0])(
+                std::thread::hardware_concurrency());
 
             // layernorm
             RunLayernorm(arg.c_m_n_, acc_m_n, arg.c0_n_gamma_, arg.c0_n_beta_);
 
             // elementwise op
-            arg.c_m_n_.ForEach([&](auto& self, auto idx) {
-                arg.c_element_op_(self(idx[0], idx[1]), self(idx[0], idx[1]));
-            });
+            auto f_element_op = [&](auto m) {
+                for(std::size_t n = 0; n < arg.c_m_n_.mDesc.GetLengths()[1]; ++n)
+                    arg.c_element_op_(arg.c_m_n_(m, n), arg.c_m_n_(m, n));
+            };
+
+            make_ParallelTensorFunctor(f_element_op, arg.c_m_n_.mDesc.GetLengths()[0])(
+                std::thread::hardware_concurrency());
 
             return 0;
         }
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <iostream>
 #include <sstream>
 #include <vector>
@@ -11,6 +12,8 @@
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/utility/host_common_util.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_welford.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -53,7 +56,7 @@ struct ReferenceGroupnorm : public device::BaseOperator
         {
         }
 
-        const Tensor<XDataType> x_;
+        const Tensor<XDataType>& x_;
         const Tensor<XDataType> gamma_;
         const Tensor<XDataType> beta_;
         Tensor<YDataType>& y_;
@@ -69,84 +72,85 @@ struct ReferenceGroupnorm : public device::BaseOperator
     {
         float Run(const Argument& arg)
         {
-            int N = arg.lengths_[0];
-            int H = arg.lengths_[1];
-            int W = arg.lengths_[2];
-            int G = arg.lengths_[3];
-            int C = arg.lengths_[4];
+            using ck::host_common::get_index_from_linear_offset;
+            using ck::host_common::get_offset_from_index;
+            using ck::host_common::step_index;
 
-            Tensor<ComputeDataType> mean({N, G});
-            Tensor<ComputeDataType> var({N, G});
+            const std::size_t N = arg.lengths_[0];
+            const std::size_t G = arg.lengths_[3];
 
-            // Compute mean & var in [H, W, C] by Welford Algorithm
-            // TODO - parallel for each HWC
-            // TODO - address calculation
-            for(int n = 0; n < N; ++n)
-            {
-                for(int g = 0; g < G; ++g)
-                {
-                    ComputeDataType mean_val = type_convert<ComputeDataType>(0.0f);
-                    ComputeDataType var_val  = type_convert<ComputeDataType>(0.0f);
-                    int32_t curr_count       = 0;
-
-                    for(int h = 0; h < H; ++h)
-                    {
-                        for(int w = 0; w < W; ++w)
-                        {
-                            for(int c = 0; c < C; ++c)
-                            {
-                                curr_count++;
-                                ComputeDataType x =
-                                    type_convert<ComputeDataType>(arg.x_(n, h, w, g, c));
-                                ComputeDataType delta = x - mean_val;
-                                mean_val += delta / curr_count;
-                                ComputeDataType delta2 = x - mean_val;
-                                var_val += delta * delta2;
-                            }
-                        }
-                    }
-
-                    mean(n, g) = mean_val;
-                    var(n, g)  = var_val / curr_count;
-
-                    arg.save_mean_(n, g) = ck::type_convert<SaveMeanInvStdDataType>(mean(n, g));
+            // rows are [N, G], a row is reduced over [H, W, C]
+            const std::array<index_t, 3> reduce_lengths{
+                arg.lengths_[1], arg.lengths_[2], arg.lengths_[4]};
 
-                    ComputeDataType divisor =
-                        static_cast<ComputeDataType>(1) / ck::math::sqrt(var(n, g) + arg.epsilon_);
-                    arg.save_inv_std_(n, g) = ck::type_convert<SaveMeanInvStdDataType>(divisor);
+            const std::size_t reduce_length = ck::host_common::get_index_count<3>(reduce_lengths);
+
+            const auto& x_strides = arg.x_.GetStrides();
+            const auto& y_strides = arg.y_.GetStrides();
+
+            const std::array<index_t, 3> x_reduce_strides{static_cast<index_t>(x_strides[1]),
+                                                          static_cast<index_t>(x_strides[2]),
+                                                          static_cast<index_t>(x_strides[4])};
+            const std::array<index_t, 3> y_reduce_strides{static_cast<index_t>(y_strides[1]),
+                                                          static_cast<index_t>(y_strides[2]),
+                                                          static_cast<index_t>(y_strides[4])};
+
+            auto for_each_reduce_index = [&](std::size_t i_begin, std::size_t i_end, auto f) {
+                auto index = get_index_from_linear_offset<3>(reduce_lengths, i_begin);
+
+                for(std::size_t i = i_begin; i < i_end; ++i)
+                {
+                    f(index);
+                    step_index<3>(reduce_lengths, index);
                 }
-            }
+            };
+
+            // Compute mean & var in [H, W, C] by Welford Algorithm
+            const auto welford = welford_reduce_rows<ComputeDataType>(
+                N * G, reduce_length, [&](auto row, auto i_begin, auto i_end, auto& w) {
+                    const std::size_t n = row / G;
+                    const std::size_t g = row % G;
+
+                    for_each_reduce_index(i_begin, i_end, [&](const auto& index) {
+                        auto x_offset = n * x_strides[0] + g * x_strides[3] +
+                                        get_offset_from_index<3>(x_reduce_strides, index);
+
+                        w.Update(type_convert<ComputeDataType>(arg.x_.mData[x_offset]));
+                    });
+                });
 
             // Normalization
-            for(int n = 0; n < N; ++n)
-            {
-                for(int h = 0; h < H; ++h)
+            parallel_for_row_chunks(N * G, reduce_length, [&](auto row, auto i_begin, auto i_end) {
+                const std::size_t n = row / G;
+                const std::size_t g = row % G;
+
+                ComputeDataType mean_val = welford[row].GetMean();
+                ComputeDataType var_val  = welford[row].GetVariance();
+
+                for_each_reduce_index(i_begin, i_end, [&](const auto& index) {
+                    auto x_offset = n * x_strides[0] + g * x_strides[3] +
+                                    get_offset_from_index<3>(x_reduce_strides, index);
+                    auto y_offset = n * y_strides[0] + g * y_strides[3] +
+                                    get_offset_from_index<3>(y_reduce_strides, index);
+
+                    ComputeDataType x     = type_convert<ComputeDataType>(arg.x_.mData[x_offset]);
+                    ComputeDataType gamma = type_convert<ComputeDataType>(arg.gamma_(g, index[2]));
+                    ComputeDataType beta  = type_convert<ComputeDataType>(arg.beta_(g, index[2]));
+                    ComputeDataType y =
+                        gamma * (x - mean_val) / ck::math::sqrt(arg.epsilon_ + var_val) + beta;
+                    arg.y_elementwise_op_(y, y);
+                    arg.y_.mData[y_offset] = type_convert<YDataType>(y);
+                });
+
+                if(i_begin == 0)
                 {
-                    for(int w = 0; w < W; ++w)
-                    {
-                        for(int g = 0; g < G; ++g)
-                        {
-                            for(int c = 0; c < C; ++c)
-                            {
-                                ComputeDataType x =
-                                    type_convert<ComputeDataType>(arg.x_(n, h, w, g, c));
-                                ComputeDataType gamma =
-                                    type_convert<ComputeDataType>(arg.gamma_(g, c));
-                                ComputeDataType beta =
-                                    type_convert<ComputeDataType>(arg.beta_(g, c));
-                                ComputeDataType mean_val =
-                                    type_convert<ComputeDataType>(mean(n, g));
-                                ComputeDataType var_val = type_convert<ComputeDataType>(var(n, g));
-                                ComputeDataType y       = gamma * (x - mean_val) /
-                                                        ck::math::sqrt(arg.epsilon_ + var_val) +
-                                                    beta;
-                                arg.y_elementwise_op_(y, y);
-                                arg.y_(n, h, w, g, c) = type_convert<YDataType>(y);
-                            }
-                        }
-                    }
+                    ComputeDataType divisor =
+                        static_cast<ComputeDataType>(1) / ck::math::sqrt(var_val + arg.epsilon_);
+
+                    arg.save_mean_(n, g)    = ck::type_convert<SaveMeanInvStdDataType>(mean_val);
+                    arg.save_inv_std_(n, g) = ck::type_convert<SaveMeanInvStdDataType>(divisor);
                 }
-            }
+            });
 
             return 0;
         }
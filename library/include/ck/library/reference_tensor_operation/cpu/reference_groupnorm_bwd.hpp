@@ -11,6 +11,7 @@
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/utility/host_thread_pool.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -89,84 +90,126 @@ struct ReferenceGroupnormBwd : public device::BaseOperator
     // Invoker
     struct Invoker : public device::BaseInvoker
     {
+        // number of [G, C] columns reduced together by one task
+        static constexpr std::size_t ColumnBlockSize = 64;
+
         float Run(const Argument& arg)
         {
-            int N = arg.lengths_[0];
-            int H = arg.lengths_[1];
-            int W = arg.lengths_[2];
-            int G = arg.lengths_[3];
-            int C = arg.lengths_[4];
-
-            // Calculate dgamma and dbeta
-            for(int g = 0; g < G; ++g)
-                for(int c = 0; c < C; ++c)
-                {
-                    ComputeDataType dgamma = 0;
-                    ComputeDataType dbeta  = 0;
+            const std::size_t N = arg.lengths_[0];
+            const std::size_t H = arg.lengths_[1];
+            const std::size_t W = arg.lengths_[2];
+            const std::size_t G = arg.lengths_[3];
+            const std::size_t C = arg.lengths_[4];
+
+            const auto& dy_strides = arg.dy_nhwgc_.GetStrides();
+            const auto& x_strides  = arg.x_nhwgc_.GetStrides();
+            const auto& dx_strides = arg.dx_nhwgc_.GetStrides();
+
+            auto get_offset = [](const auto& strides,
+                                 std::size_t n,
+                                 std::size_t h,
+                                 std::size_t w,
+                                 std::size_t g,
+                                 std::size_t c) {
+                return n * strides[0] + h * strides[1] + w * strides[2] + g * strides[3] +
+                       c * strides[4];
+            };
+
+            auto get_dy = [&](std::size_t n,
+                              std::size_t h,
+                              std::size_t w,
+                              std::size_t g,
+                              std::size_t c) {
+                return ck::type_convert<ComputeDataType>(
+                    arg.dy_nhwgc_.mData[get_offset(dy_strides, n, h, w, g, c)]);
+            };
+
+            auto get_x = [&](std::size_t n,
+                             std::size_t h,
+                             std::size_t w,
+                             std::size_t g,
+                             std::size_t c) {
+                return ck::type_convert<ComputeDataType>(
+                    arg.x_nhwgc_.mData[get_offset(x_strides, n, h, w, g, c)]);
+            };
 
-                    for(int n = 0; n < N; ++n)
-                        for(int h = 0; h < H; ++h)
-                            for(int w = 0; w < W; ++w)
+            // Calculate dgamma and dbeta, for a block of [G, C] columns at a time so that rows are
+            // read contiguously. Every column is still accumulated over [N, H, W] in order.
+            auto f_dgamma_dbeta = [&](std::size_t gc_begin, std::size_t gc_end) {
+                std::vector<ComputeDataType> dgamma(gc_end - gc_begin, 0);
+                std::vector<ComputeDataType> dbeta(gc_end - gc_begin, 0);
+
+                for(std::size_t n = 0; n < N; ++n)
+                    for(std::size_t h = 0; h < H; ++h)
+                        for(std::size_t w = 0; w < W; ++w)
+                            for(std::size_t gc = gc_begin; gc < gc_end; ++gc)
                             {
-                                ComputeDataType dy =
-                                    ck::type_convert<ComputeDataType>(arg.dy_nhwgc_(n, h, w, g, c));
-                                ComputeDataType x =
-                                    ck::type_convert<ComputeDataType>(arg.x_nhwgc_(n, h, w, g, c));
+                                const std::size_t g = gc / C;
+                                const std::size_t c = gc % C;
+
+                                ComputeDataType dy = get_dy(n, h, w, g, c);
+                                ComputeDataType x  = get_x(n, h, w, g, c);
                                 ComputeDataType mean =
                                     ck::type_convert<ComputeDataType>(arg.mean_ng_(n, g));
                                 ComputeDataType rstd =
                                     ck::type_convert<ComputeDataType>(arg.inv_std_ng_(n, g));
-                                dgamma += dy * rstd * (x - mean);
-                                dbeta += dy;
+                                dgamma[gc - gc_begin] += dy * rstd * (x - mean);
+                                dbeta[gc - gc_begin] += dy;
                             }
-                    arg.dgamma_gc_(g, c) = ck::type_convert<DGammaDataType>(dgamma);
-                    arg.dbeta_gc_(g, c)  = ck::type_convert<DBetaDataType>(dbeta);
+
+                for(std::size_t gc = gc_begin; gc < gc_end; ++gc)
+                {
+                    const std::size_t g = gc / C;
+                    const std::size_t c = gc % C;
+
+                    arg.dgamma_gc_(g, c) = ck::type_convert<DGammaDataType>(dgamma[gc - gc_begin]);
+                    arg.dbeta_gc_(g, c)  = ck::type_convert<DBetaDataType>(dbeta[gc - gc_begin]);
                 }
+            };
+
+            ck::utils::host_parallel_for(G * C, f_dgamma_dbeta, 0, ColumnBlockSize);
 
             // Calculate dx
-            int reduce_size = H * W * C;
-            for(int n = 0; n < N; ++n)
-                for(int g = 0; g < G; ++g)
-                {
-                    ComputeDataType ds = 0;
-                    ComputeDataType db = 0;
+            std::size_t reduce_size = H * W * C;
 
-                    ComputeDataType mean = ck::type_convert<ComputeDataType>(arg.mean_ng_(n, g));
-                    ComputeDataType rstd = ck::type_convert<ComputeDataType>(arg.inv_std_ng_(n, g));
+            auto f_dx = [&](auto n, auto g) {
+                ComputeDataType ds = 0;
+                ComputeDataType db = 0;
 
-                    for(int h = 0; h < H; ++h)
-                        for(int w = 0; w < W; ++w)
-                            for(int c = 0; c < C; ++c)
-                            {
-                                ComputeDataType dy =
-                                    ck::type_convert<ComputeDataType>(arg.dy_nhwgc_(n, h, w, g, c));
-                                ComputeDataType x =
-                                    ck::type_convert<ComputeDataType>(arg.x_nhwgc_(n, h, w, g, c));
-                                ComputeDataType gamma =
-                                    ck::type_convert<ComputeDataType>(arg.gamma_gc_(g, c));
-
-                                ds += dy * gamma * x;
-                                db += dy * gamma;
-                            }
+                ComputeDataType mean = ck::type_convert<ComputeDataType>(arg.mean_ng_(n, g));
+                ComputeDataType rstd = ck::type_convert<ComputeDataType>(arg.inv_std_ng_(n, g));
 
-                    for(int h = 0; h < H; ++h)
-                        for(int w = 0; w < W; ++w)
-                            for(int c = 0; c < C; ++c)
-                            {
-                                ComputeDataType dy =
-                                    ck::type_convert<ComputeDataType>(arg.dy_nhwgc_(n, h, w, g, c));
-                                ComputeDataType x =
-                                    ck::type_convert<ComputeDataType>(arg.x_nhwgc_(n, h, w, g, c));
-                                ComputeDataType gamma =
-                                    ck::type_convert<ComputeDataType>(arg.gamma_gc_(g, c));
-
-                                ComputeDataType b =
-                                    (db * mean - ds) * rstd * rstd * rstd / reduce_size;
-                                ComputeDataType c1 = -b * mean - db * rstd / reduce_size;
-                                arg.dx_nhwgc_(n, h, w, g, c) =
-                                    ck::type_convert<DXDataType>(dy * gamma * rstd + b * x + c1);
-                            }
-                }
+                for(std::size_t h = 0; h < H; ++h)
+                    for(std::size_t w = 0; w < W; ++w)
+                        for(std::size_t c = 0; c < C; ++c)
+                        {
+                            ComputeDataType dy = get_dy(n, h, w, g, c);
+                            ComputeDataType x  = get_x(n, h, w, g, c);
+                            ComputeDataType gamma =
+                                ck::type_convert<ComputeDataType>(arg.gamma_gc_(g, c));
+
+                            ds += dy * gamma * x;
+                            db += dy * gamma;
+                        }
+
+                for(std::size_t h = 0; h < H; ++h)
+                    for(std::size_t w = 0; w < W; ++w)
+                        for(std::size_t c = 0; c < C; ++c)
+                        {
+                            ComputeDataType dy = get_dy(n, h, w, g, c);
+                            ComputeDataType x  = get_x(n, h, w, g, c);
+                            ComputeDataType gamma =
+                                ck::type_convert<ComputeDataType>(arg.gamma_gc_(g, c));
+
+                            ComputeDataType b =
+                                (db * mean - ds) * rstd * rstd * rstd / reduce_size;
+                            ComputeDataType c1 = -b * mean - db * rstd / reduce_size;
+                            arg.dx_nhwgc_.mData[get_offset(dx_strides, n, h, w, g, c)] =
+                                ck::type_convert<DXDataType>(dy * gamma * rstd + b * x + c1);
+                        }
+            };
+
+            make_ParallelTensorFunctor(f_dx, N, G)(std::thread::hardware_concurrency());
 
             return 0;
         }
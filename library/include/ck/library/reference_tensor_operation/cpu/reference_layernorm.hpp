@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <iostream>
 #include <sstream>
 #include <vector>
@@ -11,6 +12,8 @@
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/utility/host_common_util.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_welford.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -57,7 +60,7 @@ struct ReferenceLayernorm : public device::BaseOperator
         {
         }
 
-        const Tensor<XDataType> x_m_n_;
+        const Tensor<XDataType>& x_m_n_;
         const Tensor<XDataType> gamma_n_;
         const Tensor<XDataType> beta_n_;
         Tensor<YDataType>& y_m_n_;
@@ -74,101 +77,122 @@ struct ReferenceLayernorm : public device::BaseOperator
     {
         float Run2D(const Argument& arg)
         {
-            int M = arg.lengths_[0];
-            int N = arg.lengths_[1];
+            const std::size_t M = arg.lengths_[0];
+            const std::size_t N = arg.lengths_[1];
 
-            Tensor<ComputeDataType> mean({M});
-            Tensor<ComputeDataType> var({M});
+            const auto& x_strides = arg.x_m_n_.GetStrides();
+            const auto& y_strides = arg.y_m_n_.GetStrides();
 
-            for(int m = 0; m < M; ++m)
-            {
-                mean(m) = 0;
-                var(m)  = 0;
+            auto get_x = [&](std::size_t m, std::size_t n) {
+                return ck::type_convert<ComputeDataType>(
+                    arg.x_m_n_.mData[m * x_strides[0] + n * x_strides[1]]);
+            };
 
-                for(int n = 0; n < N; ++n)
-                {
-                    auto x_val = ck::type_convert<ComputeDataType>(arg.x_m_n_(m, n));
-                    mean(m) += x_val;
-                    var(m) += x_val * x_val;
-                }
-
-                mean(m) = mean(m) / N;
-                var(m)  = (var(m) / N) - (mean(m) * mean(m));
-            }
+            const auto welford = welford_reduce_rows<ComputeDataType>(
+                M, N, [&](auto m, auto n_begin, auto n_end, auto& w) {
+                    for(std::size_t n = n_begin; n < n_end; ++n)
+                        w.Update(get_x(m, n));
+                });
 
-            for(int m = 0; m < M; ++m)
-            {
-                ComputeDataType divisor =
-                    static_cast<ComputeDataType>(1) / ck::math::sqrt(var(m) + arg.epsilon_);
+            parallel_for_row_chunks(M, N, [&](auto m, auto n_begin, auto n_end) {
+                ComputeDataType mean    = welford[m].GetMean();
+                ComputeDataType divisor = static_cast<ComputeDataType>(1) /
+                                          ck::math::sqrt(welford[m].GetVariance() + arg.epsilon_);
 
-                for(int n = 0; n < N; ++n)
+                for(std::size_t n = n_begin; n < n_end; ++n)
                 {
-                    auto x_val     = ck::type_convert<ComputeDataType>(arg.x_m_n_(m, n));
+                    auto x_val     = get_x(m, n);
                     auto gamma_val = ck::type_convert<ComputeDataType>(arg.gamma_n_(n));
                     auto beta_val  = ck::type_convert<ComputeDataType>(arg.beta_n_(n));
-                    auto y_val     = (x_val - mean(m)) * divisor;
+                    auto y_val     = (x_val - mean) * divisor;
                     y_val          = (y_val * gamma_val) + beta_val;
                     arg.y_elementwise_op_(y_val, y_val);
-                    arg.y_m_n_(m, n) = ck::type_convert<YDataType>(y_val);
+                    arg.y_m_n_.mData[m * y_strides[0] + n * y_strides[1]] =
+                        ck::type_convert<YDataType>(y_val);
+                }
+
+                if(n_begin == 0)
+                {
+                    arg.save_mean_m_(m)    = ck::type_convert<SaveMeanInvStdDataType>(mean);
+                    arg.save_inv_std_m_(m) = ck::type_convert<SaveMeanInvStdDataType>(divisor);
                 }
-                arg.save_mean_m_(m)    = ck::type_convert<SaveMeanInvStdDataType>(mean(m));
-                arg.save_inv_std_m_(m) = ck::type_convert<SaveMeanInvStdDataType>(divisor);
-            }
+            });
 
             return 0;
         }
 
         float Run4D(const Argument& arg)
         {
-            int N = arg.lengths_[0];
-            int H = arg.lengths_[1];
-            int W = arg.lengths_[2];
-            int C = arg.lengths_[3];
-
-            Tensor<ComputeDataType> mean({N});
-            Tensor<ComputeDataType> var({N});
-
-            int reduce_length = H * W * C;
-
-            for(int n = 0; n < N; ++n)
-            {
-                mean(n) = 0;
-                var(n)  = 0;
-
-                for(int h = 0; h < H; ++h)
-                    for(int w = 0; w < W; ++w)
-                        for(int c = 0; c < C; ++c)
-                        {
-                            auto x_val = ck::type_convert<ComputeDataType>(arg.x_m_n_(n, h, w, c));
-                            mean(n) += x_val;
-                            var(n) += x_val * x_val;
-                        }
-
-                mean(n) = mean(n) / reduce_length;
-                var(n)  = (var(n) / reduce_length) - (mean(n) * mean(n));
-            }
-
-            for(int n = 0; n < N; ++n)
-            {
-                ComputeDataType divisor =
-                    static_cast<ComputeDataType>(1) / ck::math::sqrt(var(n) + arg.epsilon_);
-
-                for(int h = 0; h < H; ++h)
-                    for(int w = 0; w < W; ++w)
-                        for(int c = 0; c < C; ++c)
-                        {
-                            auto x_val = ck::type_convert<ComputeDataType>(arg.x_m_n_(n, h, w, c));
-                            auto gamma_val =
-                                ck::type_convert<ComputeDataType>(arg.gamma_n_(h, w, c));
-                            auto beta_val = ck::type_convert<ComputeDataType>(arg.beta_n_(h, w, c));
-                            auto y_val    = (x_val - mean(n)) * divisor;
-                            y_val         = (y_val * gamma_val) + beta_val;
-                            arg.y_elementwise_op_(y_val, y_val);
-                            arg.y_m_n_(n, h, w, c) = ck::type_convert<YDataType>(y_val);
-                        }
-                arg.save_mean_m_(n)    = ck::type_convert<SaveMeanInvStdDataType>(mean(n));
-                arg.save_inv_std_m_(n) = ck::type_convert<SaveMeanInvStdDataType>(divisor);
-            }
+            using ck::host_common::get_index_from_linear_offset;
+            using ck::host_common::get_offset_from_index;
+            using ck::host_common::step_index;
+
+            const std::size_t N = arg.lengths_[0];
+
+            const std::array<index_t, 3> reduce_lengths{
+                arg.lengths_[1], arg.lengths_[2], arg.lengths_[3]};
+
+            const std::size_t reduce_length = ck::host_common::get_index_count<3>(reduce_lengths);
+
+            const auto& x_strides = arg.x_m_n_.GetStrides();
+            const auto& y_strides = arg.y_m_n_.GetStrides();
+
+            const std::array<index_t, 3> x_reduce_strides{static_cast<index_t>(x_strides[1]),
+                                                          static_cast<index_t>(x_strides[2]),
+                                                          static_cast<index_t>(x_strides[3])};
+            const std::array<index_t, 3> y_reduce_strides{static_cast<index_t>(y_strides[1]),
+                                                          static_cast<index_t>(y_strides[2]),
+                                                          static_cast<index_t>(y_strides[3])};
+
+            // the [H, W, C] index of element i of a row, iterated in row-major order
+            auto for_each_reduce_index = [&](std::size_t i_begin, std::size_t i_end, auto f) {
+                auto index = get_index_from_linear_offset<3>(reduce_lengths, i_begin);
+
+                for(std::size_t i = i_begin; i < i_end; ++i)
+                {
+                    f(index);
+                    step_index<3>(reduce_lengths, index);
+                }
+            };
+
+            const auto welford = welford_reduce_rows<ComputeDataType>(
+                N, reduce_length, [&](auto n, auto i_begin, auto i_end, auto& w) {
+                    for_each_reduce_index(i_begin, i_end, [&](const auto& index) {
+                        auto x_offset =
+                            n * x_strides[0] + get_offset_from_index<3>(x_reduce_strides, index);
+
+                        w.Update(ck::type_convert<ComputeDataType>(arg.x_m_n_.mData[x_offset]));
+                    });
+                });
+
+            parallel_for_row_chunks(N, reduce_length, [&](auto n, auto i_begin, auto i_end) {
+                ComputeDataType mean    = welford[n].GetMean();
+                ComputeDataType divisor = static_cast<ComputeDataType>(1) /
+                                          ck::math::sqrt(welford[n].GetVariance() + arg.epsilon_);
+
+                for_each_reduce_index(i_begin, i_end, [&](const auto& index) {
+                    auto x_offset =
+                        n * x_strides[0] + get_offset_from_index<3>(x_reduce_strides, index);
+                    auto y_offset =
+                        n * y_strides[0] + get_offset_from_index<3>(y_reduce_strides, index);
+
+                    auto x_val     = ck::type_convert<ComputeDataType>(arg.x_m_n_.mData[x_offset]);
+                    auto gamma_val = ck::type_convert<ComputeDataType>(
+                        arg.gamma_n_(index[0], index[1], index[2]));
+                    auto beta_val = ck::type_convert<ComputeDataType>(
+                        arg.beta_n_(index[0], index[1], index[2]));
+                    auto y_val = (x_val - mean) * divisor;
+                    y_val      = (y_val * gamma_val) + beta_val;
+                    arg.y_elementwise_op_(y_val, y_val);
+                    arg.y_m_n_.mData[y_offset] = ck::type_convert<YDataType>(y_val);
+                });
+
+                if(i_begin == 0)
+                {
+                    arg.save_mean_m_(n)    = ck::type_convert<SaveMeanInvStdDataType>(mean);
+                    arg.save_inv_std_m_(n) = ck::type_convert<SaveMeanInvStdDataType>(divisor);
+                }
+            });
 
             return 0;
         }
@@ -11,6 +11,7 @@
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/utility/host_thread_pool.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -88,61 +89,90 @@ struct ReferenceLayernormBwd : public device::BaseOperator
     // Invoker
     struct Invoker : public device::BaseInvoker
     {
+        // number of columns reduced together by one task
+        static constexpr std::size_t ColumnBlockSize = 64;
+
         float Run(const Argument& arg)
         {
-            int M = arg.lengths_[0];
-            int N = arg.lengths_[1];
-
-            // Calculate dgamma and dbeta
-            for(int n = 0; n < N; ++n)
-            {
-                ComputeDataType dgamma = 0;
-                ComputeDataType dbeta  = 0;
-
-                for(int m = 0; m < M; ++m)
+            const std::size_t M = arg.lengths_[0];
+            const std::size_t N = arg.lengths_[1];
+
+            const auto& dy_strides = arg.dy_m_n_.GetStrides();
+            const auto& x_strides  = arg.x_m_n_.GetStrides();
+            const auto& dx_strides = arg.dx_m_n_.GetStrides();
+
+            auto get_dy = [&](std::size_t m, std::size_t n) {
+                return ck::type_convert<ComputeDataType>(
+                    arg.dy_m_n_.mData[m * dy_strides[0] + n * dy_strides[1]]);
+            };
+
+            auto get_x = [&](std::size_t m, std::size_t n) {
+                return ck::type_convert<ComputeDataType>(
+                    arg.x_m_n_.mData[m * x_strides[0] + n * x_strides[1]]);
+            };
+
+            // Calculate dgamma and dbeta, for a block of columns at a time so that rows are read
+            // contiguously. Every column is still accumulated over m in order.
+            auto f_dgamma_dbeta = [&](std::size_t n_begin, std::size_t n_end) {
+                std::vector<ComputeDataType> dgamma(n_end - n_begin, 0);
+                std::vector<ComputeDataType> dbeta(n_end - n_begin, 0);
+
+                for(std::size_t m = 0; m < M; ++m)
                 {
-                    ComputeDataType dy   = ck::type_convert<ComputeDataType>(arg.dy_m_n_(m, n));
-                    ComputeDataType x    = ck::type_convert<ComputeDataType>(arg.x_m_n_(m, n));
                     ComputeDataType mean = ck::type_convert<ComputeDataType>(arg.mean_m_(m));
                     ComputeDataType rstd = ck::type_convert<ComputeDataType>(arg.inv_std_m_(m));
-                    dgamma += dy * rstd * (x - mean);
-                    dbeta += dy;
+
+                    for(std::size_t n = n_begin; n < n_end; ++n)
+                    {
+                        ComputeDataType dy = get_dy(m, n);
+                        ComputeDataType x  = get_x(m, n);
+                        dgamma[n - n_begin] += dy * rstd * (x - mean);
+                        dbeta[n - n_begin] += dy;
+                    }
                 }
-                arg.dgamma_n_(n) = ck::type_convert<DGammaDataType>(dgamma);
-                arg.dbeta_n_(n)  = ck::type_convert<DBetaDataType>(dbeta);
-            }
+
+                for(std::size_t n = n_begin; n < n_end; ++n)
+                {
+                    arg.dgamma_n_(n) = ck::type_convert<DGammaDataType>(dgamma[n - n_begin]);
+                    arg.dbeta_n_(n)  = ck::type_convert<DBetaDataType>(dbeta[n - n_begin]);
+                }
+            };
+
+            ck::utils::host_parallel_for(N, f_dgamma_dbeta, 0, ColumnBlockSize);
 
             // Calculate dx
-            for(int m = 0; m < M; ++m)
-            {
+            auto f_dx = [&](auto m) {
                 ComputeDataType ds = 0;
                 ComputeDataType db = 0;
 
                 ComputeDataType mean = ck::type_convert<ComputeDataType>(arg.mean_m_(m));
                 ComputeDataType rstd = ck::type_convert<ComputeDataType>(arg.inv_std_m_(m));
 
-                for(int n = 0; n < N; ++n)
+                for(std::size_t n = 0; n < N; ++n)
                 {
-                    ComputeDataType dy    = ck::type_convert<ComputeDataType>(arg.dy_m_n_(m, n));
-                    ComputeDataType x     = ck::type_convert<ComputeDataType>(arg.x_m_n_(m, n));
+                    ComputeDataType dy    = get_dy(m, n);
+                    ComputeDataType x     = get_x(m, n);
                     ComputeDataType gamma = ck::type_convert<ComputeDataType>(arg.gamma_n_(n));
 
                     ds += dy * gamma * x;
                     db += dy * gamma;
                 }
 
-                for(int n = 0; n < N; ++n)
+                for(std::size_t n = 0; n < N; ++n)
                 {
-                    ComputeDataType dy    = ck::type_convert<ComputeDataType>(arg.dy_m_n_(m, n));
-                    ComputeDataType x     = ck::type_convert<ComputeDataType>(arg.x_m_n_(m, n));
+                    ComputeDataType dy    = get_dy(m, n);
+                    ComputeDataType x     = get_x(m, n);
                     ComputeDataType gamma = ck::type_convert<ComputeDataType>(arg.gamma_n_(n));
 
                     ComputeDataType b = (db * mean - ds) * rstd * rstd * rstd / N;
                     ComputeDataType c = -b * mean - db * rstd / N;
 
-                    arg.dx_m_n_(m, n) = ck::type_convert<DXDataType>(dy * gamma * rstd + b * x + c);
+                    arg.dx_m_n_.mData[m * dx_strides[0] + n * dx_strides[1]] =
+                        ck::type_convert<DXDataType>(dy * gamma * rstd + b * x + c);
                 }
-            }
+            };
+
+            make_ParallelTensorFunctor(f_dx, M)(std::thread::hardware_concurrency());
 
             return 0;
         }
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 #include <vector>
@@ -10,6 +11,7 @@
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/utility/host_thread_pool.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -43,30 +45,114 @@ struct ReferenceMaxPoolBwd : public device::BaseOperator
     // Invoker
     struct Invoker : public device::BaseInvoker
     {
+        // dout and din are both cut into NumBlock contiguous blocks. The dout elements are first
+        // grouped by the din block they scatter to, in their order in dout, then each din block
+        // adds up its own group. No two threads write the same din element, and every element
+        // sums its gradients in the order of dout, so din does not depend on the number of
+        // threads, and overlapping windows need no atomics.
+        static constexpr std::size_t NumBlock = 64;
+
         float Run(const Argument& arg)
         {
-            int din_length  = arg.din_.GetElementSpaceSize();
-            int dout_length = arg.dout_.GetElementSpaceSize();
-            std::vector<ConputeDataType> buf(din_length, 0);
+            const std::size_t din_length  = arg.din_.GetElementSpaceSize();
+            const std::size_t dout_length = arg.dout_.GetElementSpaceSize();
+
+            const std::size_t din_block_size  = (din_length + NumBlock - 1) / NumBlock;
+            const std::size_t dout_block_size = (dout_length + NumBlock - 1) / NumBlock;
+
+            auto get_din_block = [&](std::size_t i) -> std::size_t {
+                const auto index = static_cast<ck::long_index_t>(arg.indices_.mData[i]);
+
+                if(index < 0 || static_cast<std::size_t>(index) >= din_length)
+                    return NumBlock;
+
+                return static_cast<std::size_t>(index) / din_block_size;
+            };
+
+            auto for_each_dout_block = [&](auto f) {
+                ck::utils::host_parallel_for(
+                    NumBlock,
+                    [&](std::size_t block_begin, std::size_t block_end) {
+                        for(std::size_t block = block_begin; block < block_end; ++block)
+                        {
+                            f(block,
+                              std::min(block * dout_block_size, dout_length),
+                              std::min((block + 1) * dout_block_size, dout_length));
+                        }
+                    },
+                    0,
+                    1);
+            };
+
+            // number of elements of every dout block scattering to every din block
+            std::vector<std::size_t> counts(NumBlock * NumBlock, 0);
+
+            for_each_dout_block([&](std::size_t dout_block, std::size_t begin, std::size_t end) {
+                for(std::size_t i = begin; i < end; ++i)
+                {
+                    if(const std::size_t din_block = get_din_block(i); din_block < NumBlock)
+                        ++counts[dout_block * NumBlock + din_block];
+                }
+            });
 
-            for(int i = 0; i < dout_length; ++i)
+            // position of the elements of a dout block in the group of a din block
+            std::vector<std::size_t> positions(NumBlock * NumBlock);
+            std::vector<std::size_t> group_begin(NumBlock + 1, 0);
+
+            for(std::size_t din_block = 0, position = 0; din_block < NumBlock; ++din_block)
             {
-                int index = arg.indices_.mData[i];
-                if(index >= 0 && index < din_length)
+                for(std::size_t dout_block = 0; dout_block < NumBlock; ++dout_block)
+                {
+                    positions[dout_block * NumBlock + din_block] = position;
+                    position += counts[dout_block * NumBlock + din_block];
+                }
+
+                group_begin[din_block + 1] = position;
+            }
+
+            std::vector<std::size_t> groups(group_begin[NumBlock]);
+
+            for_each_dout_block([&](std::size_t dout_block, std::size_t begin, std::size_t end) {
+                for(std::size_t i = begin; i < end; ++i)
                 {
-                    if constexpr(is_same_v<ConputeDataType, bhalf_t>)
+                    if(const std::size_t din_block = get_din_block(i); din_block < NumBlock)
+                        groups[positions[dout_block * NumBlock + din_block]++] = i;
+                }
+            });
+
+            auto f_din_blocks = [&](std::size_t block_begin, std::size_t block_end) {
+                std::vector<ConputeDataType> buf(din_block_size);
+
+                for(std::size_t block = block_begin; block < block_end; ++block)
+                {
+                    const std::size_t begin = std::min(block * din_block_size, din_length);
+                    const std::size_t end   = std::min((block + 1) * din_block_size, din_length);
+
+                    std::fill(buf.begin(), buf.end(), 0);
+
+                    for(std::size_t g = group_begin[block]; g < group_begin[block + 1]; ++g)
                     {
-                        float buf_val = ck::type_convert<float>(buf[index]);
-                        buf_val += ck::type_convert<float>(arg.dout_.mData[i]);
-                        buf[index] = ck::type_convert<ConputeDataType>(buf_val);
+                        const std::size_t i = groups[g];
+
+                        auto& acc = buf[static_cast<std::size_t>(arg.indices_.mData[i]) - begin];
+
+                        if constexpr(is_same_v<ConputeDataType, bhalf_t>)
+                        {
+                            float buf_val = ck::type_convert<float>(acc);
+                            buf_val += ck::type_convert<float>(arg.dout_.mData[i]);
+                            acc = ck::type_convert<ConputeDataType>(buf_val);
+                        }
+                        else
+                            acc += ck::type_convert<ConputeDataType>(arg.dout_.mData[i]);
                     }
-                    else
-                        buf[index] += ck::type_convert<ConputeDataType>(arg.dout_.mData[i]);
+
+                    for(std::size_t i = begin; i < end; ++i)
+                        arg.din_.mData[i] = ck::type_convert<DInDataType>(buf[i - begin]);
                 }
-            }
+            };
+
+            ck::utils::host_parallel_for(NumBlock, f_din_blocks, 0, 1);
 
-            for(int i = 0; i < din_length; ++i)
-                arg.din_.mData[i] = ck::type_convert<DInDataType>(buf[i]);
             return 0;
         }
 
@@ -72,8 +72,6 @@ struct ReferenceReduce : public device::DeviceReduce<InDataType,
               in_elementwise_op_(in_elementwise_op),
               acc_elementwise_op_(acc_elementwise_op)
         {
-            using ck::host_common::get_index_set;
-
             if(std::any_of(
                    reduceDims.begin(), reduceDims.end(), [](int d) { return d < 0 || d >= Rank; }))
                 throw std::runtime_error("Invalid reduce dimensions!");
@@ -123,11 +121,6 @@ struct ReferenceReduce : public device::DeviceReduce<InDataType,
                 i++;
             };
 
-            if constexpr(NumInvariantDim > 0)
-                invariant_index_set_ = get_index_set<NumInvariantDim>(invariant_lengths_);
-
-            reduce_index_set_ = get_index_set<NumReduceDim>(reduce_lengths_);
-
             alpha_ = type_convert<AccDataType>(alpha);
             beta_  = type_convert<AccDataType>(beta);
         };
@@ -151,9 +144,6 @@ struct ReferenceReduce : public device::DeviceReduce<InDataType,
 
         AccDataType alpha_;
         AccDataType beta_;
-
-        std::vector<std::array<index_t, NumInvariantDim>> invariant_index_set_;
-        std::vector<std::array<index_t, NumReduceDim>> reduce_index_set_;
     };
 
     struct Invoker : public device::BaseInvoker
@@ -165,8 +155,9 @@ struct ReferenceReduce : public device::DeviceReduce<InDataType,
             using ck::float_equal_one;
             using ck::float_equal_zero;
             using ck::type_convert;
-            using ck::host_common::get_index_set;
+            using ck::host_common::for_each_index_offset;
             using ck::host_common::get_offset_from_index;
+            using ck::host_common::parallel_for_each_index;
 
             if constexpr(OutputIndex)
             {
@@ -180,19 +171,18 @@ struct ReferenceReduce : public device::DeviceReduce<InDataType,
                     AccDataType accuVal = ReduceOperation::template GetIdentityValue<AccDataType>();
                     IndexDataType accuIndex = 0;
 
-                    for(std::size_t i = 0; i < arg.reduce_index_set_.size(); i++)
-                    {
-                        auto in_offset = get_offset_from_index<NumReduceDim>(
-                            arg.in_reduce_strides_, arg.reduce_index_set_[i]);
-
-                        auto currVal = type_convert<AccDataType>(arg.in_host_[in_offset]);
+                    for_each_index_offset<NumReduceDim>(
+                        arg.reduce_lengths_,
+                        [&](std::size_t i, std::size_t in_offset) {
+                            auto currVal = type_convert<AccDataType>(arg.in_host_[in_offset]);
 
-                        arg.in_elementwise_op_(currVal, currVal);
+                            arg.in_elementwise_op_(currVal, currVal);
 
-                        auto currIndex = static_cast<IndexDataType>(i);
+                            auto currIndex = static_cast<IndexDataType>(i);
 
-                        Accumulation::Calculate(accuVal, currVal, accuIndex, currIndex);
-                    };
+                            Accumulation::Calculate(accuVal, currVal, accuIndex, currIndex);
+                        },
+                        arg.in_reduce_strides_);
 
                     arg.acc_elementwise_op_(accuVal, accuVal);
 
@@ -216,20 +206,19 @@ struct ReferenceReduce : public device::DeviceReduce<InDataType,
                         auto in_invariant_offset = get_offset_from_index<NumInvariantDim>(
                             arg.in_invariant_strides_, invariant_index);
 
-                        for(std::size_t i = 0; i < arg.reduce_index_set_.size(); i++)
-                        {
-                            auto in_reduce_offset = get_offset_from_index<NumReduceDim>(
-                                arg.in_reduce_strides_, arg.reduce_index_set_[i]);
-
-                            auto currVal = type_convert<AccDataType>(
-                                arg.in_host_[in_invariant_offset + in_reduce_offset]);
+                        for_each_index_offset<NumReduceDim>(
+                            arg.reduce_lengths_,
+                            [&](std::size_t i, std::size_t in_reduce_offset) {
+                                auto currVal = type_convert<AccDataType>(
+                                    arg.in_host_[in_invariant_offset + in_reduce_offset]);
 
-                            arg.in_elementwise_op_(currVal, currVal);
+                                arg.in_elementwise_op_(currVal, currVal);
 
-                            auto currIndex = static_cast<IndexDataType>(i);
+                                auto currIndex = static_cast<IndexDataType>(i);
 
-                            Accumulation::Calculate(accuVal, currVal, accuIndex, currIndex);
-                        };
+                                Accumulation::Calculate(accuVal, currVal, accuIndex, currIndex);
+                            },
+                            arg.in_reduce_strides_);
 
                         arg.acc_elementwise_op_(accuVal, accuVal);
 
@@ -247,28 +236,8 @@ struct ReferenceReduce : public device::DeviceReduce<InDataType,
                         arg.out_index_host_[dst_offset] = accuIndex;
                     };
 
-                    std::size_t num_thread = std::thread::hardware_concurrency();
-
-                    std::size_t work_per_thread =
-                        (arg.invariant_index_set_.size() + num_thread - 1) / num_thread;
-
-                    std::vector<joinable_thread> threads(num_thread);
-
-                    for(std::size_t it = 0; it < num_thread; ++it)
-                    {
-                        std::size_t i_begin = it * work_per_thread;
-                        std::size_t i_end =
-                            std::min((it + 1) * work_per_thread, arg.invariant_index_set_.size());
-
-                        auto f = [=] {
-                            for(std::size_t i = i_begin; i < i_end; i++)
-                            {
-                                thread_reduce_func(arg.invariant_index_set_[i]);
-                            }
-                        };
-
-                        threads[it] = joinable_thread(f);
-                    }
+                    parallel_for_each_index<NumInvariantDim>(arg.invariant_lengths_,
+                                                             thread_reduce_func);
                 };
             }
             else
@@ -280,17 +249,16 @@ struct ReferenceReduce : public device::DeviceReduce<InDataType,
                 {
                     AccDataType accuVal = ReduceOperation::template GetIdentityValue<AccDataType>();
 
-                    for(const auto& reduce_index : arg.reduce_index_set_)
-                    {
-                        auto in_offset = get_offset_from_index<NumReduceDim>(arg.in_reduce_strides_,
-                                                                             reduce_index);
-
-                        auto currVal = type_convert<AccDataType>(arg.in_host_[in_offset]);
+                    for_each_index_offset<NumReduceDim>(
+                        arg.reduce_lengths_,
+                        [&](std::size_t, std::size_t in_offset) {
+                            auto currVal = type_convert<AccDataType>(arg.in_host_[in_offset]);
 
-                        arg.in_elementwise_op_(currVal, currVal);
+                            arg.in_elementwise_op_(currVal, currVal);
 
-                        Accumulation::Calculate(accuVal, currVal);
-                    };
+                            Accumulation::Calculate(accuVal, currVal);
+                        },
+                        arg.in_reduce_strides_);
 
                     arg.acc_elementwise_op_(accuVal, accuVal);
 
@@ -312,18 +280,17 @@ struct ReferenceReduce : public device::DeviceReduce<InDataType,
                         auto in_invariant_offset = get_offset_from_index<NumInvariantDim>(
                             arg.in_invariant_strides_, invariant_index);
 
-                        for(const auto& reduce_index : arg.reduce_index_set_)
-                        {
-                            auto in_reduce_offset = get_offset_from_index<NumReduceDim>(
-                                arg.in_reduce_strides_, reduce_index);
+                        for_each_index_offset<NumReduceDim>(
+                            arg.reduce_lengths_,
+                            [&](std::size_t, std::size_t in_reduce_offset) {
+                                auto currVal = type_convert<AccDataType>(
+                                    arg.in_host_[in_invariant_offset + in_reduce_offset]);
 
-                            auto currVal = type_convert<AccDataType>(
-                                arg.in_host_[in_invariant_offset + in_reduce_offset]);
+                                arg.in_elementwise_op_(currVal, currVal);
 
-                            arg.in_elementwise_op_(currVal, currVal);
-
-                            Accumulation::Calculate(accuVal, currVal);
-                        };
+                                Accumulation::Calculate(accuVal, currVal);
+                            },
+                            arg.in_reduce_strides_);
 
                         arg.acc_elementwise_op_(accuVal, accuVal);
 
@@ -340,28 +307,8 @@ struct ReferenceReduce : public device::DeviceReduce<InDataType,
                         arg.out_host_[dst_offset] = type_convert<OutDataType>(accuVal);
                     };
 
-                    std::size_t num_thread = std::thread::hardware_concurrency();
-
-                    std::size_t work_per_thread =
-                        (arg.invariant_index_set_.size() + num_thread - 1) / num_thread;
-
-                    std::vector<joinable_thread> threads(num_thread);
-
-                    for(std::size_t it = 0; it < num_thread; ++it)
-                    {
-                        std::size_t i_begin = it * work_per_thread;
-                        std::size_t i_end =
-                            std::min((it + 1) * work_per_thread, arg.invariant_index_set_.size());
-
-                        auto f = [=] {
-                            for(std::size_t i = i_begin; i < i_end; i++)
-                            {
-                                thread_reduce_func(arg.invariant_index_set_[i]);
-                            }
-                        };
-
-                        threads[it] = joinable_thread(f);
-                    }
+                    parallel_for_each_index<NumInvariantDim>(arg.invariant_lengths_,
+                                                             thread_reduce_func);
                 };
             };
 
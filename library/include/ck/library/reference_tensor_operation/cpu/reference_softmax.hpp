@@ -3,10 +3,12 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <vector>
-#include <algorithm>
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/library/utility/host_tensor.hpp"
@@ -56,75 +58,118 @@ struct ReferenceSoftmax : public device::BaseOperator
     // Invoker
     struct Invoker : public device::BaseInvoker
     {
+        // Each softmax instance (one index of the scalar dims) is processed by one thread with an
+        // online max/sum pass over the reduce dims followed by a pass writing the outputs. The
+        // reduce dims are walked with precomputed strides, so nothing is allocated per element.
         float Run(const Argument& arg)
         {
-            std::vector<size_t> scalar_lengths;
-            for(index_t dim : arg.sm_scalar_dims_)
+            const auto& lengths     = arg.in_.mDesc.GetLengths();
+            const auto& in_strides  = arg.in_.mDesc.GetStrides();
+            const auto& out_strides = arg.out_.mDesc.GetStrides();
+
+            std::vector<index_t> reduce_dims(arg.sm_reduce_dims_);
+            std::sort(reduce_dims.begin(), reduce_dims.end());
+
+            const std::size_t num_reduce_dim = reduce_dims.size();
+
+            std::vector<std::size_t> reduce_lengths(num_reduce_dim);
+            std::vector<std::size_t> reduce_in_strides(num_reduce_dim);
+            std::vector<std::size_t> reduce_out_strides(num_reduce_dim);
+
+            std::size_t reduce_size = 1;
+            for(std::size_t i = 0; i < num_reduce_dim; ++i)
             {
-                scalar_lengths.push_back(arg.in_.mDesc.GetLengths()[dim]);
+                reduce_lengths[i]     = lengths[reduce_dims[i]];
+                reduce_in_strides[i]  = in_strides[reduce_dims[i]];
+                reduce_out_strides[i] = out_strides[reduce_dims[i]];
+                reduce_size *= reduce_lengths[i];
             }
-            // max and sum reduction with final reduced values of dim=0 is a scalar so give it
-            // appropriate lengths of {1}
-            if(arg.sm_scalar_dims_.size() == 0)
+
+            std::size_t num_row = 1;
+            for(index_t dim : arg.sm_scalar_dims_)
             {
-                scalar_lengths.push_back(1);
+                num_row *= lengths[dim];
             }
 
-            Tensor<AccDataType> reduce_max(scalar_lengths);
-            reduce_max.GenerateTensorValue(
-                GeneratorTensor_1<AccDataType>{std::numeric_limits<AccDataType>::lowest()});
-            Tensor<AccDataType> reduce_sum(scalar_lengths);
-            reduce_sum.GenerateTensorValue(GeneratorTensor_1<AccDataType>{0});
-
-            // when final reduced values is of dim=0, the index will be transformed into empty
-            // std::vector which is actually a valid input for Tensor::operator(std::vector) and
-            // internally accesses 0'th element
-            auto to_sm_scalar_idx = [&](auto idx) {
-                std::vector<size_t> sm_scalar_idx;
-                for(index_t dim : arg.sm_scalar_dims_)
+            if(reduce_size == 0)
+                return 0;
+
+            auto f_rows = [&](std::size_t row_begin, std::size_t row_end) {
+                std::vector<std::size_t> reduce_idx(num_reduce_dim);
+
+                // visits every element of one softmax instance, f(in_offset, out_offset)
+                auto for_each_in_row = [&](std::size_t in_base, std::size_t out_base, auto&& f) {
+                    std::fill(reduce_idx.begin(), reduce_idx.end(), 0);
+
+                    std::size_t in_offset  = in_base;
+                    std::size_t out_offset = out_base;
+
+                    for(std::size_t i = 0; i < reduce_size; ++i)
+                    {
+                        f(in_offset, out_offset);
+
+                        for(std::size_t d = num_reduce_dim; d-- > 0;)
+                        {
+                            in_offset += reduce_in_strides[d];
+                            out_offset += reduce_out_strides[d];
+
+                            if(++reduce_idx[d] < reduce_lengths[d])
+                                break;
+
+                            in_offset -= reduce_lengths[d] * reduce_in_strides[d];
+                            out_offset -= reduce_lengths[d] * reduce_out_strides[d];
+                            reduce_idx[d] = 0;
+                        }
+                    }
+                };
+
+                for(std::size_t row = row_begin; row < row_end; ++row)
                 {
-                    sm_scalar_idx.push_back(idx[dim]);
+                    std::size_t in_base  = 0;
+                    std::size_t out_base = 0;
+
+                    for(std::size_t i = arg.sm_scalar_dims_.size(), r = row; i-- > 0;)
+                    {
+                        const index_t dim = arg.sm_scalar_dims_[i];
+
+                        in_base += (r % lengths[dim]) * in_strides[dim];
+                        out_base += (r % lengths[dim]) * out_strides[dim];
+                        r /= lengths[dim];
+                    }
+
+                    // max(x) and sum(exp(x - max(x))) in one pass
+                    AccDataType reduce_max = std::numeric_limits<AccDataType>::lowest();
+                    AccDataType reduce_sum = 0;
+
+                    for_each_in_row(in_base, out_base, [&](std::size_t in_offset, std::size_t) {
+                        const AccDataType x =
+                            ck::type_convert<AccDataType>(arg.in_.mData[in_offset]);
+
+                        if(x > reduce_max)
+                        {
+                            reduce_sum = reduce_sum * std::exp(reduce_max - x);
+                            reduce_max = x;
+                        }
+
+                        reduce_sum += std::exp(x - reduce_max);
+                    });
+
+                    for_each_in_row(
+                        in_base, out_base, [&](std::size_t in_offset, std::size_t out_offset) {
+                            const AccDataType x =
+                                ck::type_convert<AccDataType>(arg.in_.mData[in_offset]);
+                            const AccDataType y =
+                                ck::type_convert<AccDataType>(arg.out_.mData[out_offset]);
+
+                            AccDataType temp_result =
+                                arg.alpha_ * std::exp(x - reduce_max) / reduce_sum + arg.beta_ * y;
+
+                            arg.out_.mData[out_offset] = ck::type_convert<OutDataType>(temp_result);
+                        });
                 }
-                return sm_scalar_idx;
             };
 
-            arg.in_.ForEach([&](auto& self, auto idx) {
-                reduce_max(to_sm_scalar_idx(idx)) = std::max(
-                    reduce_max(to_sm_scalar_idx(idx)), ck::type_convert<AccDataType>(self(idx)));
-            });
-
-            // LogRangeAsType<float>(std::cout << "reduce_max: ", reduce_max.mData, ",") <<
-            // std::endl;
-
-            Tensor<AccDataType> in_stable(arg.in_.mDesc);
-            in_stable.ForEach([&](auto& self, auto idx) {
-                // numerator = exp(x - max(x))
-                self(idx) = std::exp(ck::type_convert<AccDataType>(arg.in_(idx)) -
-                                     reduce_max(to_sm_scalar_idx(idx)));
-            });
-
-            // LogRangeAsType<float>(std::cout << "in_stable: ", in_stable.mData, ",") << std::endl;
-
-            in_stable.ForEach([&](auto& self, auto idx) {
-                // denominator = sum(exp(x - max(x)))
-                reduce_sum(to_sm_scalar_idx(idx)) += self(idx);
-            });
-
-            // LogRangeAsType<float>(std::cout << "reduce_sum: ", reduce_sum.mData, ",") <<
-            // std::endl;
-
-            arg.out_.ForEach([&](auto& self, auto idx) {
-                AccDataType temp_result =
-                    arg.alpha_ * in_stable(idx) / reduce_sum(to_sm_scalar_idx(idx)) +
-                    arg.beta_ * self(idx);
-                self(idx) = ck::type_convert<OutDataType>(temp_result);
-            });
-
-            // LogRangeAsType<float>(std::cout << "out: ", arg.out_.mData, ",") << std::endl;
-            // reduction along reduce dims
-            // LogRangeAsType<float>(std::cout << "reduce_max: ", reduce_max.mData, ",") <<
-            // std::endl; LogRangeAsType<float>(std::cout << "reduce_sum: ", reduce_sum.mData, ",")
-            // << std::endl;
+            ck::utils::host_parallel_for(num_row, f_rows);
 
             return 0;
         }
@@ -0,0 +1,184 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_view.hpp"
+#include "ck/library/utility/host_thread_pool.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+// out[i, :] = layernorm(sum_j emb_j[index_j[i], :]) * gamma + beta for NumEmbeddings tables, like
+// DeviceSparseEmbeddingsForwardLayernorm with the AddAdd... element operation.
+//
+// The tables, indices, gamma and beta are held as views, so building an argument never copies the
+// embedding tables, which can be much larger than the output.
+template <typename EmbType,
+          typename IndexType,
+          typename GammaDataType,
+          typename BetaDataType,
+          typename AccDataType,
+          typename OutType,
+          ck::index_t NumEmbeddings>
+struct ReferenceSparseEmbeddingsForwardLayernorm : public device::BaseOperator
+{
+    struct Argument : public device::BaseArgument
+    {
+        Argument(TensorView<OutType> output,
+                 const std::array<TensorView<const EmbType>, NumEmbeddings>& embs,
+                 const std::array<TensorView<const IndexType>, NumEmbeddings>& indexs,
+                 TensorView<const GammaDataType> gamma,
+                 TensorView<const BetaDataType> beta,
+                 ck::index_t NumRows,
+                 ck::index_t EmbeddingDim,
+                 ck::index_t IndexLength,
+                 AccDataType epsilon)
+            : output_(output),
+              embs_(embs),
+              indexs_(indexs),
+              gamma_(gamma),
+              beta_(beta),
+              NumRows_(NumRows),
+              EmbeddingDim_(EmbeddingDim),
+              IndexLength_(IndexLength),
+              epsilon_(epsilon)
+        {
+        }
+
+        TensorView<OutType> output_;
+        std::array<TensorView<const EmbType>, NumEmbeddings> embs_;
+        std::array<TensorView<const IndexType>, NumEmbeddings> indexs_;
+        TensorView<const GammaDataType> gamma_;
+        TensorView<const BetaDataType> beta_;
+        ck::index_t NumRows_;
+        ck::index_t EmbeddingDim_;
+        ck::index_t IndexLength_;
+        AccDataType epsilon_;
+    };
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        // Each output row is gathered, summed and normalized by one thread in a row-sized buffer,
+        // so the sums of all rows are never materialized.
+        float Run(const Argument& arg)
+        {
+            const ck::index_t D = arg.EmbeddingDim_;
+            const ck::index_t E = arg.NumRows_;
+
+            for(const auto& index : arg.indexs_)
+            {
+                for(const IndexType i : index)
+                {
+                    if(!(i < E))
+                        throw std::runtime_error("wrong! out of range");
+                }
+            }
+
+            auto f_rows = [&](std::size_t row_begin, std::size_t row_end) {
+                std::vector<AccDataType> x(D);
+
+                for(std::size_t row = row_begin; row < row_end; ++row)
+                {
+                    std::array<IndexType, NumEmbeddings> emb_rows;
+
+                    for(ck::index_t j = 0; j < NumEmbeddings; ++j)
+                        emb_rows[j] = arg.indexs_[j](row);
+
+                    AccDataType mean = 0;
+                    AccDataType var  = 0;
+
+                    for(ck::index_t d = 0; d < D; ++d)
+                    {
+                        auto sum = ck::type_convert<AccDataType>(arg.embs_[0](emb_rows[0], d));
+
+                        for(ck::index_t j = 1; j < NumEmbeddings; ++j)
+                            sum += ck::type_convert<AccDataType>(arg.embs_[j](emb_rows[j], d));
+
+                        x[d] = sum;
+                        mean += sum;
+                        var += sum * sum;
+                    }
+
+                    mean = mean / D;
+                    var  = (var / D) - (mean * mean);
+
+                    for(ck::index_t d = 0; d < D; ++d)
+                    {
+                        auto y_val = (x[d] - mean) / std::sqrt(var + arg.epsilon_);
+                        y_val = (y_val * ck::type_convert<AccDataType>(arg.gamma_(d))) +
+                                ck::type_convert<AccDataType>(arg.beta_(d));
+
+                        arg.output_(row, d) = ck::type_convert<OutType>(y_val);
+                    }
+                }
+            };
+
+            ck::utils::host_parallel_for(arg.IndexLength_, f_rows);
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /* stream_config */ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    // at least one table, gathered by integer indices
+    static constexpr bool IsValidCompilationParameter()
+    {
+        return NumEmbeddings > 0 && std::is_integral_v<IndexType>;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
+
+    static auto MakeArgument(TensorView<OutType> output,
+                             const std::array<TensorView<const EmbType>, NumEmbeddings>& embs,
+                             const std::array<TensorView<const IndexType>, NumEmbeddings>& indexs,
+                             TensorView<const GammaDataType> gamma,
+                             TensorView<const BetaDataType> beta,
+                             ck::index_t NumRows,
+                             ck::index_t EmbeddingDim,
+                             ck::index_t IndexLength,
+                             AccDataType epsilon)
+    {
+        return Argument(
+            output, embs, indexs, gamma, beta, NumRows, EmbeddingDim, IndexLength, epsilon);
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferenceSparseEmbeddingsForwardLayernorm<" << NumEmbeddings << ">"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
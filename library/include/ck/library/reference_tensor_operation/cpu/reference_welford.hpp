@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "ck/ck.hpp"
+
+#include "ck/library/utility/host_thread_pool.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+// Host counterpart of ThreadwiseWelford::Update() and BlockwiseWelford::Merge(): the same update
+// and merge formulas, and a NaN input poisons mean and variance. var_ holds the sum of squared
+// deviations, GetVariance() divides it by the count.
+template <typename T>
+struct HostWelford
+{
+    void Update(T x)
+    {
+        ++count_;
+
+        if(x != x)
+        {
+            mean_ = x;
+            var_  = x;
+        }
+        else
+        {
+            T delta = x - mean_;
+            mean_ += delta / count_;
+            T delta2 = x - mean_;
+            var_ += delta * delta2;
+        }
+    }
+
+    void Merge(const HostWelford& other)
+    {
+        int64_t count        = count_ + other.count_;
+        T count_b_over_count = count == 0 ? T(0) : static_cast<T>(other.count_) / count;
+        T delta              = other.mean_ - mean_;
+        mean_ += delta * count_b_over_count;
+        var_ += other.var_ + delta * delta * count_ * count_b_over_count;
+        count_ = count;
+    }
+
+    T GetMean() const { return mean_; }
+
+    T GetVariance() const { return count_ == 0 ? T(0) : var_ / count_; }
+
+    T mean_        = 0;
+    T var_         = 0;
+    int64_t count_ = 0;
+};
+
+// Rows are processed in chunks of this many consecutive elements, like the K slices of one thread
+// of the device normalization kernels. It does not depend on the number of host threads, so the
+// results do not either.
+inline constexpr std::size_t NormalizationRowChunkSize = 4096;
+
+inline std::size_t get_num_row_chunks(std::size_t row_length)
+{
+    return std::max<std::size_t>(
+        (row_length + NormalizationRowChunkSize - 1) / NormalizationRowChunkSize, 1);
+}
+
+// calls f(row, i_begin, i_end) for every chunk of every row, in parallel
+template <typename F>
+void parallel_for_row_chunks(std::size_t num_row, std::size_t row_length, F&& f)
+{
+    const std::size_t num_chunk = get_num_row_chunks(row_length);
+
+    ck::utils::host_parallel_for(num_row * num_chunk, [&](std::size_t begin, std::size_t end) {
+        for(std::size_t i = begin; i < end; ++i)
+        {
+            const std::size_t row     = i / num_chunk;
+            const std::size_t i_begin = (i % num_chunk) * NormalizationRowChunkSize;
+            const std::size_t i_end   = std::min(i_begin + NormalizationRowChunkSize, row_length);
+
+            f(row, i_begin, i_end);
+        }
+    });
+}
+
+// Mean and variance of every row. update(row, i_begin, i_end, welford) feeds elements
+// [i_begin, i_end) of the row to welford.Update(); the chunks are reduced in parallel and then
+// merged in order.
+template <typename T, typename F>
+std::vector<HostWelford<T>>
+welford_reduce_rows(std::size_t num_row, std::size_t row_length, F&& update)
+{
+    const std::size_t num_chunk = get_num_row_chunks(row_length);
+
+    std::vector<HostWelford<T>> chunks(num_row * num_chunk);
+
+    parallel_for_row_chunks(num_row, row_length, [&](auto row, auto i_begin, auto i_end) {
+        update(row, i_begin, i_end, chunks[row * num_chunk + i_begin / NormalizationRowChunkSize]);
+    });
+
+    std::vector<HostWelford<T>> rows(num_row);
+
+    for(std::size_t row = 0; row < num_row; ++row)
+        for(std::size_t chunk = 0; chunk < num_chunk; ++chunk)
+            rows[row].Merge(chunks[row * num_chunk + chunk]);
+
+    return rows;
+}
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,289 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <memory>
+#include <sstream>
+
+#include "ck/host_utility/host_kernel_launch.hpp"
+#include "ck/tensor_operation/gpu/device/device_gemm.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/library/utility/host_thread_pool.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_blocked_gemm.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// DeviceGemm running on the host: A, B and C are host pointers. The GEMM is blocked into
+// MPerBlock x NPerBlock tiles of C spread over the host thread pool, each computed KPerBlock at a
+// time with an MPerThread x NPerThread register tile. When the tiles are too few to occupy the
+// threads, e.g. a small M x N with a large K, the reduction over K is split as well, see
+// batched_blocked_gemm().
+template <typename ALayout,
+          typename BLayout,
+          typename CLayout,
+          typename ADataType,
+          typename BDataType,
+          typename CDataType,
+          typename AccDataType,
+          typename AElementwiseOperation,
+          typename BElementwiseOperation,
+          typename CElementwiseOperation,
+          index_t MPerBlock,
+          index_t NPerBlock,
+          index_t KPerBlock,
+          index_t MPerThread,
+          index_t NPerThread>
+struct DeviceGemmCpu : public DeviceGemm<ALayout,
+                                         BLayout,
+                                         CLayout,
+                                         ADataType,
+                                         BDataType,
+                                         CDataType,
+                                         AElementwiseOperation,
+                                         BElementwiseOperation,
+                                         CElementwiseOperation>
+{
+    static_assert(host::is_blocked_gemm_acc_type_v<AccDataType>, "unsupported AccDataType");
+
+    struct TileConfig
+    {
+        static constexpr std::size_t MR = MPerThread;
+        static constexpr std::size_t NR = NPerThread;
+        static constexpr std::size_t MC = MPerBlock;
+        static constexpr std::size_t NC = NPerBlock;
+        static constexpr std::size_t KC = KPerBlock;
+    };
+
+    // offset of element (row, col) of a matrix of the layout with leading dimension stride
+    template <typename Layout>
+    static std::size_t GetOffset(std::size_t row, std::size_t col, index_t stride)
+    {
+        if constexpr(is_same_v<Layout, tensor_layout::gemm::RowMajor>)
+            return row * stride + col;
+        else
+            return col * stride + row;
+    }
+
+    // Argument
+    struct Argument : public BaseArgument
+    {
+        Argument(const ADataType* p_a,
+                 const BDataType* p_b,
+                 CDataType* p_c,
+                 index_t M,
+                 index_t N,
+                 index_t K,
+                 index_t StrideA,
+                 index_t StrideB,
+                 index_t StrideC,
+                 AElementwiseOperation a_element_op,
+                 BElementwiseOperation b_element_op,
+                 CElementwiseOperation c_element_op)
+            : p_a_{p_a},
+              p_b_{p_b},
+              p_c_{p_c},
+              M_{M},
+              N_{N},
+              K_{K},
+              StrideA_{StrideA},
+              StrideB_{StrideB},
+              StrideC_{StrideC},
+              a_element_op_{a_element_op},
+              b_element_op_{b_element_op},
+              c_element_op_{c_element_op}
+        {
+        }
+
+        const ADataType* p_a_;
+        const BDataType* p_b_;
+        CDataType* p_c_;
+        index_t M_;
+        index_t N_;
+        index_t K_;
+        index_t StrideA_;
+        index_t StrideB_;
+        index_t StrideC_;
+        AElementwiseOperation a_element_op_;
+        BElementwiseOperation b_element_op_;
+        CElementwiseOperation c_element_op_;
+    };
+
+    // Invoker
+    struct Invoker : public BaseInvoker
+    {
+        float Run(const Argument& arg, const StreamConfig& stream_config = StreamConfig{})
+        {
+            static_assert(IsValidCompilationParameter(), "wrong! invalid tile lengths");
+
+            auto a_load = [&](std::size_t, std::size_t m, std::size_t k) {
+                ADataType v_a;
+                arg.a_element_op_(v_a, arg.p_a_[GetOffset<ALayout>(m, k, arg.StrideA_)]);
+                return ck::type_convert<AccDataType>(v_a);
+            };
+
+            auto b_load = [&](std::size_t, std::size_t k, std::size_t n) {
+                BDataType v_b;
+                arg.b_element_op_(v_b, arg.p_b_[GetOffset<BLayout>(k, n, arg.StrideB_)]);
+                return ck::type_convert<AccDataType>(v_b);
+            };
+
+            auto c_store = [&](std::size_t, std::size_t m, std::size_t n, AccDataType v_acc) {
+                CDataType v_c;
+                arg.c_element_op_(v_c, v_acc);
+                arg.p_c_[GetOffset<CLayout>(m, n, arg.StrideC_)] = v_c;
+            };
+
+            return launch_and_time_host_kernel(stream_config, [&] {
+                host::batched_blocked_gemm<AccDataType, TileConfig>(
+                    1,
+                    arg.M_,
+                    arg.N_,
+                    arg.K_,
+                    a_load,
+                    b_load,
+                    c_store,
+                    ck::utils::get_host_num_threads());
+            });
+        }
+
+        // polymorphic
+        float Run(const BaseArgument* p_arg,
+                  const StreamConfig& stream_config = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg), stream_config);
+        }
+    };
+
+    // the register tile divides the block tile
+    static constexpr bool IsValidCompilationParameter()
+    {
+        return MPerThread > 0 && NPerThread > 0 && KPerBlock > 0 && MPerBlock > 0 &&
+               NPerBlock > 0 && MPerBlock % MPerThread == 0 && NPerBlock % NPerThread == 0;
+    }
+
+    static bool IsSupportedArgument(const Argument& arg)
+    {
+        if(arg.M_ < 0 || arg.N_ < 0 || arg.K_ < 0)
+            return false;
+
+        // the leading dimension covers a whole row (RowMajor) or column (ColumnMajor)
+        auto is_valid_stride = [](auto layout, index_t stride, index_t rows, index_t cols) {
+            if constexpr(is_same_v<decltype(layout), tensor_layout::gemm::RowMajor>)
+                return stride >= cols;
+            else
+                return stride >= rows;
+        };
+
+        return is_valid_stride(ALayout{}, arg.StrideA_, arg.M_, arg.K_) &&
+               is_valid_stride(BLayout{}, arg.StrideB_, arg.K_, arg.N_) &&
+               is_valid_stride(CLayout{}, arg.StrideC_, arg.M_, arg.N_);
+    }
+
+    // polymorphic
+    bool IsSupportedArgument(const BaseArgument* p_arg) override
+    {
+        return IsSupportedArgument(*dynamic_cast<const Argument*>(p_arg));
+    }
+
+    static auto MakeArgument(const ADataType* p_a,
+                             const BDataType* p_b,
+                             CDataType* p_c,
+                             index_t M,
+                             index_t N,
+                             index_t K,
+                             index_t StrideA,
+                             index_t StrideB,
+                             index_t StrideC,
+                             AElementwiseOperation a_element_op,
+                             BElementwiseOperation b_element_op,
+                             CElementwiseOperation c_element_op)
+    {
+        return Argument{p_a,
+                        p_b,
+                        p_c,
+                        M,
+                        N,
+                        K,
+                        StrideA,
+                        StrideB,
+                        StrideC,
+                        a_element_op,
+                        b_element_op,
+                        c_element_op};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    // polymorphic
+    std::unique_ptr<BaseArgument> MakeArgumentPointer(const void* p_a,
+                                                      const void* p_b,
+                                                      void* p_c,
+                                                      index_t M,
+                                                      index_t N,
+                                                      index_t K,
+                                                      index_t StrideA,
+                                                      index_t StrideB,
+                                                      index_t StrideC,
+                                                      AElementwiseOperation a_element_op,
+                                                      BElementwiseOperation b_element_op,
+                                                      CElementwiseOperation c_element_op) override
+    {
+        return std::make_unique<Argument>(static_cast<const ADataType*>(p_a),
+                                          static_cast<const BDataType*>(p_b),
+                                          static_cast<CDataType*>(p_c),
+                                          M,
+                                          N,
+                                          K,
+                                          StrideA,
+                                          StrideB,
+                                          StrideC,
+                                          a_element_op,
+                                          b_element_op,
+                                          c_element_op);
+    }
+
+    // polymorphic
+    std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    // polymorphic
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "DeviceGemmCpu"
+            << "<"
+            << MPerBlock << ", "
+            << NPerBlock << ", "
+            << KPerBlock << ", "
+            << MPerThread << ", "
+            << NPerThread
+            << ">";
+        // clang-format on
+
+        return str.str();
+    }
+
+    DeviceOperatorDescriptor GetDescriptor() const override
+    {
+        DeviceOperatorDescriptor desc{"DeviceGemmCpu"};
+
+        desc.Add("MPerBlock", MPerBlock)
+            .Add("NPerBlock", NPerBlock)
+            .Add("KPerBlock", KPerBlock)
+            .Add("MPerThread", MPerThread)
+            .Add("NPerThread", NPerThread);
+
+        return desc;
+    }
+};
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,452 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <sstream>
+
+#include "ck/host_utility/host_kernel_launch.hpp"
+#include "ck/tensor_operation/gpu/device/device_grouped_conv_fwd_multiple_abd.hpp"
+#include "ck/library/utility/host_thread_pool.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_blocked_gemm.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// DeviceGroupedConvFwdMultipleABD without D tensors running on the host: input, weight and output
+// are host pointers, in any layout described by their strides.
+//
+// Each group is computed as an implicit GEMM
+//   E[n * Wo..., k] = sum_{x..., c} A[n, (wo * stride + x * dilation - pad)..., c] * B[k, x..., c]
+// with the input patches gathered while packing the A tiles, so no im2col buffer is materialized.
+// The GEMMs of all the groups are blocked as in DeviceGemmCpu, and their tiles share the threads.
+template <index_t NDimSpatial,
+          typename ALayout,
+          typename BLayout,
+          typename ELayout,
+          typename ADataType,
+          typename BDataType,
+          typename EDataType,
+          typename AccDataType,
+          typename AElementwiseOperation,
+          typename BElementwiseOperation,
+          typename CDEElementwiseOperation,
+          index_t MPerBlock,
+          index_t NPerBlock,
+          index_t KPerBlock,
+          index_t MPerThread,
+          index_t NPerThread,
+          typename ComputeType = ADataType>
+struct DeviceGroupedConvFwdCpu : public DeviceGroupedConvFwdMultipleABD<NDimSpatial,
+                                                                        ALayout,
+                                                                        BLayout,
+                                                                        ck::Tuple<>,
+                                                                        ELayout,
+                                                                        ADataType,
+                                                                        BDataType,
+                                                                        ck::Tuple<>,
+                                                                        EDataType,
+                                                                        AElementwiseOperation,
+                                                                        BElementwiseOperation,
+                                                                        CDEElementwiseOperation,
+                                                                        ComputeType>
+{
+    using Base = DeviceGroupedConvFwdMultipleABD<NDimSpatial,
+                                                 ALayout,
+                                                 BLayout,
+                                                 ck::Tuple<>,
+                                                 ELayout,
+                                                 ADataType,
+                                                 BDataType,
+                                                 ck::Tuple<>,
+                                                 EDataType,
+                                                 AElementwiseOperation,
+                                                 BElementwiseOperation,
+                                                 CDEElementwiseOperation,
+                                                 ComputeType>;
+
+    static_assert(!Base::isMultiA && !Base::isMultiB, "wrong! multiple A or B are not supported");
+    static_assert(host::is_blocked_gemm_acc_type_v<AccDataType>, "unsupported AccDataType");
+
+    static constexpr index_t NDim = NDimSpatial + 3;
+
+    using Lengths = std::array<index_t, NDim>;
+    using Strides = std::array<index_t, NDim>;
+    using Params  = std::array<index_t, NDimSpatial>;
+
+    struct TileConfig
+    {
+        static constexpr std::size_t MR = MPerThread;
+        static constexpr std::size_t NR = NPerThread;
+        static constexpr std::size_t MC = MPerBlock;
+        static constexpr std::size_t NC = NPerBlock;
+        static constexpr std::size_t KC = KPerBlock;
+    };
+
+    // Argument
+    struct Argument : public BaseArgument
+    {
+        Argument(const ADataType* p_a,
+                 const BDataType* p_b,
+                 EDataType* p_e,
+                 const Lengths& a_g_n_c_wis_lengths,
+                 const Strides& a_g_n_c_wis_strides,
+                 const Lengths& b_g_k_c_xs_lengths,
+                 const Strides& b_g_k_c_xs_strides,
+                 const Lengths& e_g_n_k_wos_lengths,
+                 const Strides& e_g_n_k_wos_strides,
+                 const Params& conv_filter_strides,
+                 const Params& conv_filter_dilations,
+                 const Params& input_left_pads,
+                 const Params& input_right_pads,
+                 const AElementwiseOperation& a_element_op,
+                 const BElementwiseOperation& b_element_op,
+                 const CDEElementwiseOperation& cde_element_op)
+            : p_a_{p_a},
+              p_b_{p_b},
+              p_e_{p_e},
+              a_g_n_c_wis_lengths_{a_g_n_c_wis_lengths},
+              a_g_n_c_wis_strides_{a_g_n_c_wis_strides},
+              b_g_k_c_xs_lengths_{b_g_k_c_xs_lengths},
+              b_g_k_c_xs_strides_{b_g_k_c_xs_strides},
+              e_g_n_k_wos_lengths_{e_g_n_k_wos_lengths},
+              e_g_n_k_wos_strides_{e_g_n_k_wos_strides},
+              conv_filter_strides_{conv_filter_strides},
+              conv_filter_dilations_{conv_filter_dilations},
+              input_left_pads_{input_left_pads},
+              input_right_pads_{input_right_pads},
+              a_element_op_{a_element_op},
+              b_element_op_{b_element_op},
+              cde_element_op_{cde_element_op}
+        {
+        }
+
+        const ADataType* p_a_;
+        const BDataType* p_b_;
+        EDataType* p_e_;
+        Lengths a_g_n_c_wis_lengths_;
+        Strides a_g_n_c_wis_strides_;
+        Lengths b_g_k_c_xs_lengths_;
+        Strides b_g_k_c_xs_strides_;
+        Lengths e_g_n_k_wos_lengths_;
+        Strides e_g_n_k_wos_strides_;
+        Params conv_filter_strides_;
+        Params conv_filter_dilations_;
+        Params input_left_pads_;
+        Params input_right_pads_;
+        AElementwiseOperation a_element_op_;
+        BElementwiseOperation b_element_op_;
+        CDEElementwiseOperation cde_element_op_;
+    };
+
+    // Invoker
+    struct Invoker : public BaseInvoker
+    {
+        float Run(const Argument& arg, const StreamConfig& stream_config = StreamConfig{})
+        {
+            static_assert(IsValidCompilationParameter(), "wrong! invalid tile lengths");
+
+            const auto& a_lengths = arg.a_g_n_c_wis_lengths_;
+            const auto& a_strides = arg.a_g_n_c_wis_strides_;
+            const auto& b_lengths = arg.b_g_k_c_xs_lengths_;
+            const auto& b_strides = arg.b_g_k_c_xs_strides_;
+            const auto& e_lengths = arg.e_g_n_k_wos_lengths_;
+            const auto& e_strides = arg.e_g_n_k_wos_strides_;
+
+            const std::size_t G = a_lengths[0];
+            const std::size_t N = a_lengths[1];
+            const std::size_t C = a_lengths[2];
+            const std::size_t K = b_lengths[1];
+
+            std::size_t num_output_pixel = 1;
+            std::size_t filter_size      = 1;
+
+            for(index_t i = 0; i < NDimSpatial; ++i)
+            {
+                num_output_pixel *= e_lengths[3 + i];
+                filter_size *= b_lengths[3 + i];
+            }
+
+            // GEMM M is (n, wo...), GEMM K is (x..., c), the last index being the fastest
+            auto get_a_offset = [&](std::size_t g, std::size_t m, std::size_t kk, bool& valid) {
+                std::size_t offset = g * a_strides[0] + (kk % C) * a_strides[2];
+
+                kk /= C;
+                valid = true;
+
+                for(index_t i = NDimSpatial; i-- > 0;)
+                {
+                    const auto wo = static_cast<long_index_t>(m % e_lengths[3 + i]);
+                    const auto x  = static_cast<long_index_t>(kk % b_lengths[3 + i]);
+
+                    const long_index_t wi = wo * arg.conv_filter_strides_[i] +
+                                            x * arg.conv_filter_dilations_[i] -
+                                            arg.input_left_pads_[i];
+
+                    if(wi < 0 || wi >= a_lengths[3 + i])
+                        valid = false;
+                    else
+                        offset += wi * a_strides[3 + i];
+
+                    m /= e_lengths[3 + i];
+                    kk /= b_lengths[3 + i];
+                }
+
+                return offset + m * a_strides[1];
+            };
+
+            auto get_b_offset = [&](std::size_t g, std::size_t kk, std::size_t k) {
+                std::size_t offset = g * b_strides[0] + k * b_strides[1] + (kk % C) * b_strides[2];
+
+                kk /= C;
+
+                for(index_t i = NDimSpatial; i-- > 0;)
+                {
+                    offset += (kk % b_lengths[3 + i]) * b_strides[3 + i];
+                    kk /= b_lengths[3 + i];
+                }
+
+                return offset;
+            };
+
+            auto get_e_offset = [&](std::size_t g, std::size_t m, std::size_t k) {
+                std::size_t offset = g * e_strides[0] + k * e_strides[2];
+
+                for(index_t i = NDimSpatial; i-- > 0;)
+                {
+                    offset += (m % e_lengths[3 + i]) * e_strides[3 + i];
+                    m /= e_lengths[3 + i];
+                }
+
+                return offset + m * e_strides[1];
+            };
+
+            auto a_load = [&](std::size_t g, std::size_t m, std::size_t kk) {
+                bool valid;
+                const std::size_t offset = get_a_offset(g, m, kk, valid);
+
+                if(!valid)
+                    return AccDataType{0};
+
+                ComputeType v_a;
+                arg.a_element_op_(v_a, arg.p_a_[offset]);
+                return ck::type_convert<AccDataType>(v_a);
+            };
+
+            auto b_load = [&](std::size_t g, std::size_t kk, std::size_t k) {
+                ComputeType v_b;
+                arg.b_element_op_(v_b, arg.p_b_[get_b_offset(g, kk, k)]);
+                return ck::type_convert<AccDataType>(v_b);
+            };
+
+            auto e_store = [&](std::size_t g, std::size_t m, std::size_t k, AccDataType v_acc) {
+                EDataType v_e;
+                arg.cde_element_op_(v_e, v_acc);
+                arg.p_e_[get_e_offset(g, m, k)] = v_e;
+            };
+
+            auto run_conv = [&]() {
+                host::batched_blocked_gemm<AccDataType, TileConfig>(
+                    G,
+                    N * num_output_pixel,
+                    K,
+                    C * filter_size,
+                    a_load,
+                    b_load,
+                    e_store,
+                    ck::utils::get_host_num_threads());
+            };
+
+            return launch_and_time_host_kernel(stream_config, run_conv);
+        }
+
+        // polymorphic
+        float Run(const BaseArgument* p_arg,
+                  const StreamConfig& stream_config = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg), stream_config);
+        }
+    };
+
+    // the register tile divides the block tile
+    static constexpr bool IsValidCompilationParameter()
+    {
+        return MPerThread > 0 && NPerThread > 0 && KPerBlock > 0 && MPerBlock > 0 &&
+               NPerBlock > 0 && MPerBlock % MPerThread == 0 && NPerBlock % NPerThread == 0;
+    }
+
+    static bool IsSupportedArgument(const Argument& arg)
+    {
+        const auto& a_lengths = arg.a_g_n_c_wis_lengths_;
+        const auto& b_lengths = arg.b_g_k_c_xs_lengths_;
+        const auto& e_lengths = arg.e_g_n_k_wos_lengths_;
+
+        // G, N, C and K
+        if(a_lengths[0] != b_lengths[0] || a_lengths[0] != e_lengths[0] ||
+           a_lengths[1] != e_lengths[1] || a_lengths[2] != b_lengths[2] ||
+           b_lengths[1] != e_lengths[2])
+        {
+            return false;
+        }
+
+        for(index_t i = 0; i < NDim; ++i)
+        {
+            if(a_lengths[i] < 0 || b_lengths[i] < 0 || e_lengths[i] < 0 ||
+               arg.a_g_n_c_wis_strides_[i] < 0 || arg.b_g_k_c_xs_strides_[i] < 0 ||
+               arg.e_g_n_k_wos_strides_[i] < 0)
+            {
+                return false;
+            }
+        }
+
+        for(index_t i = 0; i < NDimSpatial; ++i)
+        {
+            const index_t stride   = arg.conv_filter_strides_[i];
+            const index_t dilation = arg.conv_filter_dilations_[i];
+
+            if(stride <= 0 || dilation <= 0 || arg.input_left_pads_[i] < 0 ||
+               arg.input_right_pads_[i] < 0)
+            {
+                return false;
+            }
+
+            const index_t x_eff = (b_lengths[3 + i] - 1) * dilation + 1;
+            const index_t wi_padded =
+                a_lengths[3 + i] + arg.input_left_pads_[i] + arg.input_right_pads_[i];
+
+            if(wi_padded < x_eff || e_lengths[3 + i] != (wi_padded - x_eff) / stride + 1)
+                return false;
+        }
+
+        return true;
+    }
+
+    // polymorphic
+    bool IsSupportedArgument(const BaseArgument* p_arg) override
+    {
+        return IsSupportedArgument(*dynamic_cast<const Argument*>(p_arg));
+    }
+
+    static auto MakeArgument(const void* p_a,
+                             const void* p_b,
+                             void* p_e,
+                             const Lengths& a_g_n_c_wis_lengths,
+                             const Strides& a_g_n_c_wis_strides,
+                             const Lengths& b_g_k_c_xs_lengths,
+                             const Strides& b_g_k_c_xs_strides,
+                             const Lengths& e_g_n_k_wos_lengths,
+                             const Strides& e_g_n_k_wos_strides,
+                             const Params& conv_filter_strides,
+                             const Params& conv_filter_dilations,
+                             const Params& input_left_pads,
+                             const Params& input_right_pads,
+                             const AElementwiseOperation& a_element_op,
+                             const BElementwiseOperation& b_element_op,
+                             const CDEElementwiseOperation& cde_element_op)
+    {
+        return Argument{static_cast<const ADataType*>(p_a),
+                        static_cast<const BDataType*>(p_b),
+                        static_cast<EDataType*>(p_e),
+                        a_g_n_c_wis_lengths,
+                        a_g_n_c_wis_strides,
+                        b_g_k_c_xs_lengths,
+                        b_g_k_c_xs_strides,
+                        e_g_n_k_wos_lengths,
+                        e_g_n_k_wos_strides,
+                        conv_filter_strides,
+                        conv_filter_dilations,
+                        input_left_pads,
+                        input_right_pads,
+                        a_element_op,
+                        b_element_op,
+                        cde_element_op};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    // polymorphic
+    std::unique_ptr<BaseArgument> MakeArgumentPointer(
+        const void* p_a,
+        const void* p_b,
+        const std::array<const void*, 0>& /* p_ds */,
+        void* p_e,
+        const Lengths& a_g_n_c_wis_lengths,
+        const Strides& a_g_n_c_wis_strides,
+        const Lengths& b_g_k_c_xs_lengths,
+        const Strides& b_g_k_c_xs_strides,
+        const std::array<Lengths, 0>& /* ds_g_n_k_wos_lengths */,
+        const std::array<Strides, 0>& /* ds_g_n_k_wos_strides */,
+        const Lengths& e_g_n_k_wos_lengths,
+        const Strides& e_g_n_k_wos_strides,
+        const Params& conv_filter_strides,
+        const Params& conv_filter_dilations,
+        const Params& input_left_pads,
+        const Params& input_right_pads,
+        const AElementwiseOperation& a_element_op,
+        const BElementwiseOperation& b_element_op,
+        const CDEElementwiseOperation& cde_element_op) override
+    {
+        return std::make_unique<Argument>(MakeArgument(p_a,
+                                                       p_b,
+                                                       p_e,
+                                                       a_g_n_c_wis_lengths,
+                                                       a_g_n_c_wis_strides,
+                                                       b_g_k_c_xs_lengths,
+                                                       b_g_k_c_xs_strides,
+                                                       e_g_n_k_wos_lengths,
+                                                       e_g_n_k_wos_strides,
+                                                       conv_filter_strides,
+                                                       conv_filter_dilations,
+                                                       input_left_pads,
+                                                       input_right_pads,
+                                                       a_element_op,
+                                                       b_element_op,
+                                                       cde_element_op));
+    }
+
+    // polymorphic
+    std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    // polymorphic
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "DeviceGroupedConvFwdCpu"
+            << "<"
+            << MPerBlock << ", "
+            << NPerBlock << ", "
+            << KPerBlock << ", "
+            << MPerThread << ", "
+            << NPerThread
+            << ">";
+        // clang-format on
+
+        return str.str();
+    }
+
+    DeviceOperatorDescriptor GetDescriptor() const override
+    {
+        DeviceOperatorDescriptor desc{"DeviceGroupedConvFwdCpu"};
+
+        desc.Add("NDimSpatial", NDimSpatial)
+            .Add("MPerBlock", MPerBlock)
+            .Add("NPerBlock", NPerBlock)
+            .Add("KPerBlock", KPerBlock)
+            .Add("MPerThread", MPerThread)
+            .Add("NPerThread", NPerThread);
+
+        return desc;
+    }
+};
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/device/device_gemm.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/tensor_operation_instance/add_device_operation_instance.hpp"
+#include "ck/library/tensor_operation_instance/device_operation_instance_factory.hpp"
+#include "ck/library/tensor_operation_instance/cpu/device_gemm_cpu.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+// accumulation type of the CPU backend instances for operands of type DataType
+template <typename DataType>
+using cpu_acc_data_t = std::conditional_t<
+    is_same_v<DataType, double>,
+    double,
+    std::conditional_t<is_same_v<DataType, int8_t>, int32_t, float>>;
+
+template <typename ALayout,
+          typename BLayout,
+          typename CLayout,
+          typename AData,
+          typename BData,
+          typename CData,
+          typename AOp,
+          typename BOp,
+          typename COp,
+          typename AccData = cpu_acc_data_t<AData>>
+using device_gemm_cpu_instances = std::tuple<
+    // clang-format off
+        //##############| ALayout| BLayout| CLayout| AData| BData| CData| AccData|   A|   B|   C|     M|     N|     K|      M|      N|
+        //##############|        |        |        |  Type|  Type|  Type|    Type|  Op|  Op|  Op|   Per|   Per|   Per|    Per|    Per|
+        //##############|        |        |        |      |      |      |        |    |    |    | Block| Block| Block| Thread| Thread|
+        DeviceGemmCpu<    ALayout, BLayout, CLayout, AData, BData, CData, AccData, AOp, BOp, COp,    64,   256,   256,      4,      8>,
+        DeviceGemmCpu<    ALayout, BLayout, CLayout, AData, BData, CData, AccData, AOp, BOp, COp,   128,   128,   256,      8,      8>,
+        DeviceGemmCpu<    ALayout, BLayout, CLayout, AData, BData, CData, AccData, AOp, BOp, COp,    96,   256,   256,      6,     16>,
+        DeviceGemmCpu<    ALayout, BLayout, CLayout, AData, BData, CData, AccData, AOp, BOp, COp,    32,   512,   128,      4,     16>
+    // clang-format on
+    >;
+
+// CPU backend instances of any DeviceGemm: any layout, data types and element operations
+template <typename ALayout,
+          typename BLayout,
+          typename CLayout,
+          typename ADataType,
+          typename BDataType,
+          typename CDataType,
+          typename AElementwiseOperation,
+          typename BElementwiseOperation,
+          typename CElementwiseOperation>
+struct DeviceOperationInstanceFactory<
+    ck::tensor_operation::device::DeviceGemm<ALayout,
+                                             BLayout,
+                                             CLayout,
+                                             ADataType,
+                                             BDataType,
+                                             CDataType,
+                                             AElementwiseOperation,
+                                             BElementwiseOperation,
+                                             CElementwiseOperation>,
+    CpuBackend>
+{
+    using DeviceOp = DeviceGemm<ALayout,
+                                BLayout,
+                                CLayout,
+                                ADataType,
+                                BDataType,
+                                CDataType,
+                                AElementwiseOperation,
+                                BElementwiseOperation,
+                                CElementwiseOperation>;
+
+    static auto GetInstances()
+    {
+        std::vector<std::unique_ptr<DeviceOp>> op_ptrs;
+
+        add_device_operation_instances(op_ptrs,
+                                       device_gemm_cpu_instances<ALayout,
+                                                                 BLayout,
+                                                                 CLayout,
+                                                                 ADataType,
+                                                                 BDataType,
+                                                                 CDataType,
+                                                                 AElementwiseOperation,
+                                                                 BElementwiseOperation,
+                                                                 CElementwiseOperation>{});
+
+        return op_ptrs;
+    }
+};
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
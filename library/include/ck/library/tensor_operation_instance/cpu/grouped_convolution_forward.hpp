@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/device/device_grouped_conv_fwd_multiple_abd.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/tensor_operation_instance/add_device_operation_instance.hpp"
+#include "ck/library/tensor_operation_instance/device_operation_instance_factory.hpp"
+#include "ck/library/tensor_operation_instance/cpu/device_grouped_conv_fwd_cpu.hpp"
+#include "ck/library/tensor_operation_instance/cpu/gemm.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+template <index_t NDimSpatial,
+          typename InLayout,
+          typename WeiLayout,
+          typename OutLayout,
+          typename InData,
+          typename WeiData,
+          typename OutData,
+          typename InOp,
+          typename WeiOp,
+          typename OutOp,
+          typename Compute,
+          typename AccData = cpu_acc_data_t<InData>>
+using device_grouped_conv_fwd_cpu_instances = std::tuple<
+    // clang-format off
+        //########################|        NDim|       In|       Wei|       Out|     In|     Wei|     Out|     Acc|   In|   Wei|   Out|     M|     N|     K|      M|      N| Compute|
+        //########################|     Spatial|   Layout|    Layout|    Layout|   Data|    Data|    Data|    Data|   Op|    Op|    Op|   Per|   Per|   Per|    Per|    Per|        |
+        //########################|            |         |          |          |       |        |        |        |     |      |      | Block| Block| Block| Thread| Thread|        |
+        DeviceGroupedConvFwdCpu<    NDimSpatial, InLayout, WeiLayout, OutLayout, InData, WeiData, OutData, AccData, InOp, WeiOp, OutOp,    64,   256,   256,      4,      8, Compute>,
+        DeviceGroupedConvFwdCpu<    NDimSpatial, InLayout, WeiLayout, OutLayout, InData, WeiData, OutData, AccData, InOp, WeiOp, OutOp,   128,   128,   256,      8,      8, Compute>,
+        DeviceGroupedConvFwdCpu<    NDimSpatial, InLayout, WeiLayout, OutLayout, InData, WeiData, OutData, AccData, InOp, WeiOp, OutOp,    96,   256,   256,      6,     16, Compute>,
+        DeviceGroupedConvFwdCpu<    NDimSpatial, InLayout, WeiLayout, OutLayout, InData, WeiData, OutData, AccData, InOp, WeiOp, OutOp,    32,   512,   128,      4,     16, Compute>
+    // clang-format on
+    >;
+
+// CPU backend instances of any DeviceGroupedConvFwdMultipleABD with a single input and weight and
+// without D tensors: any layout, data types and element operations
+template <ck::index_t NumDimSpatial,
+          typename InLayout,
+          typename WeiLayout,
+          typename OutLayout,
+          typename InDataType,
+          typename WeiDataType,
+          typename OutDataType,
+          typename InElementwiseOperation,
+          typename WeiElementwiseOperation,
+          typename OutElementwiseOperation,
+          typename ComputeType>
+struct DeviceOperationInstanceFactory<
+    ck::tensor_operation::device::DeviceGroupedConvFwdMultipleABD<NumDimSpatial,
+                                                                  InLayout,
+                                                                  WeiLayout,
+                                                                  Empty_Tuple,
+                                                                  OutLayout,
+                                                                  InDataType,
+                                                                  WeiDataType,
+                                                                  Empty_Tuple,
+                                                                  OutDataType,
+                                                                  InElementwiseOperation,
+                                                                  WeiElementwiseOperation,
+                                                                  OutElementwiseOperation,
+                                                                  ComputeType>,
+    CpuBackend>
+{
+    using DeviceOp = DeviceGroupedConvFwdMultipleABD<NumDimSpatial,
+                                                     InLayout,
+                                                     WeiLayout,
+                                                     Empty_Tuple,
+                                                     OutLayout,
+                                                     InDataType,
+                                                     WeiDataType,
+                                                     Empty_Tuple,
+                                                     OutDataType,
+                                                     InElementwiseOperation,
+                                                     WeiElementwiseOperation,
+                                                     OutElementwiseOperation,
+                                                     ComputeType>;
+
+    static auto GetInstances()
+    {
+        std::vector<std::unique_ptr<DeviceOp>> op_ptrs;
+
+        if constexpr(!DeviceOp::isMultiA && !DeviceOp::isMultiB)
+        {
+            using Instances = device_grouped_conv_fwd_cpu_instances<NumDimSpatial,
+                                                                    InLayout,
+                                                                    WeiLayout,
+                                                                    OutLayout,
+                                                                    InDataType,
+                                                                    WeiDataType,
+                                                                    OutDataType,
+                                                                    InElementwiseOperation,
+                                                                    WeiElementwiseOperation,
+                                                                    OutElementwiseOperation,
+                                                                    ComputeType>;
+
+            add_device_operation_instances(op_ptrs, Instances{});
+        }
+
+        return op_ptrs;
+    }
+};
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
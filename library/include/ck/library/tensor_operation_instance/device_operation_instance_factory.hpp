@@ -129,6 +129,13 @@ template <typename Activation>
 using Add_Mul2_Activation_Mul_Clamp =
     ck::tensor_operation::element_wise::Add_Mul2_Activation_Mul_Clamp<Activation>;
 
+// Tag of the CPU backend: DeviceOperationInstanceFactory<DeviceOp, CpuBackend> lists operators
+// running on the host, behind the same DeviceOp interface, whose arguments take host pointers.
+// The default tag lists the GPU instances.
+struct CpuBackend
+{
+};
+
 template <typename DeviceOp, typename Tag = void>
 struct DeviceOperationInstanceFactory;
 
@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/tensor_operation_instance/device_operation_instance_factory.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+// what is known about an instance without making an argument for it
+struct DeviceOperationInstanceMetadata
+{
+    // index of the instance in DeviceOperationInstanceFactory<DeviceOp, Tag>::GetInstances()
+    std::size_t index_;
+    std::string type_string_;
+    DeviceOperatorDescriptor descriptor_;
+    // descriptor_.GetHash()
+    uint64_t hash_;
+};
+
+// Process-wide cache of the instances of DeviceOp and of their metadata, from the factory of Tag.
+//
+// DeviceOperationInstanceFactory<DeviceOp, Tag>::GetInstances() allocates a new object for every
+// instance on each call. The registry calls it once, the first time it is used, and then hands out
+// pointers to the same instance objects: looking instances up does not allocate anything but the
+// returned vector. Instances are stateless, so the pointers can be used from several threads, and
+// they stay valid until the end of the process.
+//
+// Typical use is to filter on the metadata first, and only make arguments for the instances that
+// pass:
+//
+//   auto& registry = DeviceOperationInstanceRegistry<DeviceOp>::GetInstance();
+//
+//   for(auto* op_ptr : registry.GetInstances([](const auto& metadata) {
+//           const auto* block_size = metadata.descriptor_.template Get<int64_t>("BlockSize");
+//           return block_size != nullptr && *block_size == 256;
+//       }))
+//   { ... }
+template <typename DeviceOp, typename Tag = void>
+class DeviceOperationInstanceRegistry
+{
+    public:
+    static DeviceOperationInstanceRegistry& GetInstance()
+    {
+        static DeviceOperationInstanceRegistry registry;
+        return registry;
+    }
+
+    DeviceOperationInstanceRegistry(const DeviceOperationInstanceRegistry&) = delete;
+    DeviceOperationInstanceRegistry& operator=(const DeviceOperationInstanceRegistry&) = delete;
+
+    std::size_t GetNumInstances() const { return instances_.size(); }
+
+    const std::vector<DeviceOperationInstanceMetadata>& GetMetadata() const { return metadata_; }
+
+    // all instances, in the order of GetInstances() of the factory
+    std::vector<DeviceOp*> GetInstances() const
+    {
+        return GetInstances([](const DeviceOperationInstanceMetadata&) { return true; });
+    }
+
+    // the instances whose metadata satisfy pred(const DeviceOperationInstanceMetadata&)
+    template <typename Predicate>
+    std::vector<DeviceOp*> GetInstances(Predicate&& pred) const
+    {
+        std::vector<DeviceOp*> op_ptrs;
+
+        for(const auto& metadata : metadata_)
+            if(pred(metadata))
+                op_ptrs.push_back(instances_[metadata.index_].get());
+
+        return op_ptrs;
+    }
+
+    DeviceOp* GetInstance(std::size_t index) const
+    {
+        return index < instances_.size() ? instances_[index].get() : nullptr;
+    }
+
+    // Instance with the given descriptor hash, or nullptr. Instances with equal descriptors are
+    // interchangeable, the first of them is returned.
+    DeviceOp* FindByHash(uint64_t hash) const
+    {
+        const auto it = hash_to_index_.find(hash);
+
+        return it == hash_to_index_.end() ? nullptr : instances_[it->second].get();
+    }
+
+    // instance with the given GetTypeString(), or nullptr
+    DeviceOp* FindByTypeString(const std::string& type_string) const
+    {
+        const auto it = type_string_to_index_.find(type_string);
+
+        return it == type_string_to_index_.end() ? nullptr : instances_[it->second].get();
+    }
+
+    private:
+    DeviceOperationInstanceRegistry()
+        : instances_(DeviceOperationInstanceFactory<DeviceOp, Tag>::GetInstances())
+    {
+        metadata_.reserve(instances_.size());
+
+        for(std::size_t i = 0; i < instances_.size(); ++i)
+        {
+            auto descriptor  = instances_[i]->GetDescriptor();
+            const auto hash  = descriptor.GetHash();
+            auto type_string = instances_[i]->GetTypeString();
+
+            hash_to_index_.emplace(hash, i);
+            type_string_to_index_.emplace(type_string, i);
+
+            metadata_.push_back({i, std::move(type_string), std::move(descriptor), hash});
+        }
+    }
+
+    std::vector<std::unique_ptr<DeviceOp>> instances_;
+    std::vector<DeviceOperationInstanceMetadata> metadata_;
+    std::unordered_map<uint64_t, std::size_t> hash_to_index_;
+    std::unordered_map<std::string, std::size_t> type_string_to_index_;
+};
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
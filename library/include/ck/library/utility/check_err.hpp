@@ -4,12 +4,18 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <iomanip>
 #include <iterator>
 #include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <string>
 #include <type_traits>
 #include <vector>
 
@@ -18,73 +24,383 @@
 #include "ck/utility/type.hpp"
 #include "ck/host_utility/io.hpp"
 
+#include "ck/library/utility/host_thread_pool.hpp"
 #include "ck/library/utility/ranges.hpp"
 
 namespace ck {
 namespace utils {
 
-template <typename Range, typename RefRange>
-typename std::enable_if<
-    std::is_same_v<ranges::range_value_t<Range>, ranges::range_value_t<RefRange>> &&
-        std::is_floating_point_v<ranges::range_value_t<Range>> &&
-        !std::is_same_v<ranges::range_value_t<Range>, half_t>,
-    bool>::type
-check_err(const Range& out,
-          const RefRange& ref,
-          const std::string& msg = "Error: Incorrect results!",
-          double rtol            = 1e-5,
-          double atol            = 3e-6)
+// Result of comparing an output range against a reference range, element by element.
+//
+// An element is an error if |out - ref| > atol + rtol * |ref|, or if either value is NaN or Inf.
+// The relative error is only taken over elements whose reference value is not zero. Integers are
+// compared exactly: |out - ref| is computed in 64-bit integers, against the tolerance rounded down.
+// ulp_histogram_ counts the elements whose out and ref values are d ulps apart (the absolute
+// difference for integer types), with bin 0 for d = 0 and bin b for 2^(b-1) <= d < 2^b; the last
+// bin is open-ended. Elements holding a NaN or Inf are not put in the histogram.
+struct ErrorSummary
 {
-    if(out.size() != ref.size())
+    static constexpr std::size_t NumUlpBins = 16;
+
+    std::size_t num_element_ = 0;
+    std::size_t num_error_   = 0;
+
+    double max_abs_err_ = 0;
+    double max_rel_err_ = 0;
+
+    std::size_t num_out_nan_ = 0;
+    std::size_t num_out_inf_ = 0;
+    std::size_t num_ref_nan_ = 0;
+    std::size_t num_ref_inf_ = 0;
+
+    // indices of the first errors, in ascending order
+    std::vector<std::size_t> error_indices_;
+
+    std::array<std::size_t, NumUlpBins> ulp_histogram_{};
+
+    bool Passed() const { return num_error_ == 0; }
+
+    double GetErrorPercent() const
     {
-        std::cerr << msg << " out.size() != ref.size(), :" << out.size() << " != " << ref.size()
-                  << std::endl;
-        return false;
+        return num_element_ == 0 ? 0. : 100. * static_cast<double>(num_error_) / num_element_;
     }
 
-    bool res{true};
-    int err_count  = 0;
-    double err     = 0;
-    double max_err = std::numeric_limits<double>::min();
-    for(std::size_t i = 0; i < ref.size(); ++i)
+    // Merges the summary of a disjoint part of the ranges. The parts may be merged in any order:
+    // the error indices are sorted and cut to the lowest max_error_index, the other fields are
+    // sums and maxima.
+    void Merge(const ErrorSummary& other, std::size_t max_error_index)
     {
-        const double o = *std::next(std::begin(out), i);
-        const double r = *std::next(std::begin(ref), i);
-        err            = std::abs(o - r);
-        if(err > atol + rtol * std::abs(r) || !std::isfinite(o) || !std::isfinite(r))
+        num_element_ += other.num_element_;
+        num_error_ += other.num_error_;
+
+        max_abs_err_ = std::max(max_abs_err_, other.max_abs_err_);
+        max_rel_err_ = std::max(max_rel_err_, other.max_rel_err_);
+
+        num_out_nan_ += other.num_out_nan_;
+        num_out_inf_ += other.num_out_inf_;
+        num_ref_nan_ += other.num_ref_nan_;
+        num_ref_inf_ += other.num_ref_inf_;
+
+        error_indices_.insert(
+            error_indices_.end(), other.error_indices_.begin(), other.error_indices_.end());
+        std::sort(error_indices_.begin(), error_indices_.end());
+        if(error_indices_.size() > max_error_index)
+            error_indices_.resize(max_error_index);
+
+        for(std::size_t b = 0; b < NumUlpBins; ++b)
+            ulp_histogram_[b] += other.ulp_histogram_[b];
+    }
+};
+
+inline std::ostream& operator<<(std::ostream& os, const ErrorSummary& summary)
+{
+    os << "number of elements: " << summary.num_element_ << ", number of errors: "
+       << summary.num_error_ << " (" << summary.GetErrorPercent()
+       << "%), max abs err: " << summary.max_abs_err_ << ", max rel err: " << summary.max_rel_err_
+       << std::endl;
+
+    os << "NaN in out/ref: " << summary.num_out_nan_ << "/" << summary.num_ref_nan_
+       << ", Inf in out/ref: " << summary.num_out_inf_ << "/" << summary.num_ref_inf_ << std::endl;
+
+    os << "ulp histogram:";
+    for(std::size_t b = 0; b < ErrorSummary::NumUlpBins; ++b)
+    {
+        if(summary.ulp_histogram_[b] == 0)
+            continue;
+
+        if(b == 0)
+            os << " [0]: ";
+        else if(b + 1 == ErrorSummary::NumUlpBins)
+            os << " [" << (uint64_t{1} << (b - 1)) << ", inf): ";
+        else
+            os << " [" << (uint64_t{1} << (b - 1)) << ", " << (uint64_t{1} << b) << "): ";
+
+        os << summary.ulp_histogram_[b];
+    }
+
+    return os << std::endl;
+}
+
+namespace detail {
+
+template <typename T>
+inline constexpr bool is_check_err_integral_v =
+    (std::is_integral_v<T> && !std::is_same_v<T, bhalf_t>)
+#ifdef CK_EXPERIMENTAL_BIT_INT_EXTENSION_INT4
+    || std::is_same_v<T, int4_t>
+#endif
+    ;
+
+template <typename T>
+inline double to_check_err_value(T x)
+{
+    if constexpr(std::is_floating_point_v<T> || is_check_err_integral_v<T>)
+        return static_cast<double>(x);
+    else
+        return static_cast<double>(type_convert<float>(x));
+}
+
+inline bool is_finite_value(double x) { return std::abs(x) <= std::numeric_limits<double>::max(); }
+
+// |x - y| of two integers, exact over the whole range of 64-bit types
+template <typename T>
+inline uint64_t get_integer_distance(T x, T y)
+{
+    if constexpr(std::is_integral_v<T> && std::is_unsigned_v<T>)
+    {
+        const uint64_t a = static_cast<uint64_t>(x);
+        const uint64_t b = static_cast<uint64_t>(y);
+
+        return a > b ? a - b : b - a;
+    }
+    else
+    {
+        const int64_t a = static_cast<int64_t>(x);
+        const int64_t b = static_cast<int64_t>(y);
+
+        return a > b ? static_cast<uint64_t>(a) - static_cast<uint64_t>(b)
+                     : static_cast<uint64_t>(b) - static_cast<uint64_t>(a);
+    }
+}
+
+// largest integer distance within the tolerance tol
+inline uint64_t get_integer_tolerance(double tol)
+{
+    if(!(tol > 0))
+        return 0;
+
+    // 2^64
+    if(tol >= 18446744073709551616.0)
+        return std::numeric_limits<uint64_t>::max();
+
+    return static_cast<uint64_t>(tol);
+}
+
+// distance between the two values in units in the last place of T
+template <typename T>
+inline uint64_t get_ulp_distance(T x, T y)
+{
+    if constexpr(is_check_err_integral_v<T>)
+    {
+        return get_integer_distance(x, y);
+    }
+    else if constexpr(sizeof(T) > sizeof(uint64_t))
+    {
+        return get_ulp_distance(static_cast<double>(x), static_cast<double>(y));
+    }
+    else
+    {
+        // floating point formats are sign-magnitude, map them onto ordered integers
+        using Bits = std::conditional_t<
+            sizeof(T) == 1,
+            uint8_t,
+            std::conditional_t<sizeof(T) == 2,
+                               uint16_t,
+                               std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>>>;
+
+        constexpr Bits sign_mask = Bits{1} << (8 * sizeof(Bits) - 1);
+
+        auto to_ordered = [](T v) {
+            Bits bits = 0;
+            std::memcpy(&bits, &v, sizeof(T));
+
+            const int64_t magnitude = static_cast<int64_t>(bits & ~sign_mask);
+
+            return (bits & sign_mask) ? -magnitude : magnitude;
+        };
+
+        const int64_t a = to_ordered(x);
+        const int64_t b = to_ordered(y);
+
+        return a > b ? static_cast<uint64_t>(a) - static_cast<uint64_t>(b)
+                     : static_cast<uint64_t>(b) - static_cast<uint64_t>(a);
+    }
+}
+
+inline std::size_t get_ulp_bin(uint64_t distance)
+{
+    if(distance == 0)
+        return 0;
+
+    const std::size_t bin = 64 - __builtin_clzll(distance);
+
+    return std::min(bin, ErrorSummary::NumUlpBins - 1);
+}
+
+template <typename T, typename OutIter, typename RefIter>
+ErrorSummary get_error_summary(OutIter out,
+                               RefIter ref,
+                               std::size_t n,
+                               double rtol,
+                               double atol,
+                               std::size_t max_error_index)
+{
+    // elements are compared in blocks: a branch-free pass which the compiler can vectorize counts
+    // the errors and exact matches, and a second pass fills in the details for
+    // the elements which are not exact matches
+    constexpr std::size_t BlockSize = 256;
+
+    ErrorSummary summary;
+    std::mutex summary_mutex;
+
+    auto f_chunk = [&](std::size_t begin, std::size_t end) {
+        ErrorSummary local;
+
+        for(std::size_t block_begin = begin; block_begin < end; block_begin += BlockSize)
         {
-            max_err = err > max_err ? err : max_err;
-            err_count++;
-            if(err_count < 5)
+            const std::size_t block_end = std::min(block_begin + BlockSize, end);
+
+            std::size_t num_error = 0;
+            std::size_t num_equal = 0;
+            double max_abs_err    = 0;
+
+            for(std::size_t i = block_begin; i < block_end; ++i)
+            {
+                if constexpr(is_check_err_integral_v<T>)
+                {
+                    // integers are compared exactly, not through double
+                    const uint64_t err = get_integer_distance<T>(out[i], ref[i]);
+
+                    num_error += err > get_integer_tolerance(
+                                           atol + rtol * std::abs(to_check_err_value(ref[i])));
+                    num_equal += err == 0;
+
+                    max_abs_err = std::max(max_abs_err, static_cast<double>(err));
+                }
+                else
+                {
+                    const double o = to_check_err_value(out[i]);
+                    const double r = to_check_err_value(ref[i]);
+
+                    const double err  = std::abs(o - r);
+                    const bool finite = is_finite_value(o) && is_finite_value(r);
+
+                    num_error += !(err <= atol + rtol * std::abs(r)) || !finite;
+                    num_equal += finite && o == r;
+
+                    max_abs_err = err > max_abs_err ? err : max_abs_err;
+                }
+            }
+
+            local.num_error_ += num_error;
+            local.max_abs_err_ = std::max(local.max_abs_err_, max_abs_err);
+            local.ulp_histogram_[0] += num_equal;
+
+            if(num_equal == block_end - block_begin)
+                continue;
+
+            for(std::size_t i = block_begin; i < block_end; ++i)
             {
-                std::cerr << msg << std::setw(12) << std::setprecision(7) << " out[" << i
-                          << "] != ref[" << i << "]: " << o << " != " << r << std::endl;
+                if constexpr(is_check_err_integral_v<T>)
+                {
+                    const uint64_t err = get_integer_distance<T>(out[i], ref[i]);
+
+                    if(err == 0)
+                        continue;
+
+                    const double r = to_check_err_value(ref[i]);
+
+                    if(num_error > 0 && local.error_indices_.size() < max_error_index &&
+                       err > get_integer_tolerance(atol + rtol * std::abs(r)))
+                        local.error_indices_.push_back(i);
+
+                    if(r != 0)
+                        local.max_rel_err_ =
+                            std::max(local.max_rel_err_, static_cast<double>(err) / std::abs(r));
+
+                    local.ulp_histogram_[get_ulp_bin(err)]++;
+
+                    continue;
+                }
+
+                const double o = to_check_err_value(out[i]);
+                const double r = to_check_err_value(ref[i]);
+
+                const bool finite = is_finite_value(o) && is_finite_value(r);
+
+                if(finite && o == r)
+                    continue;
+
+                const double err = std::abs(o - r);
+
+                if(num_error > 0 && local.error_indices_.size() < max_error_index &&
+                   (!(err <= atol + rtol * std::abs(r)) || !finite))
+                    local.error_indices_.push_back(i);
+
+                if(finite)
+                {
+                    if(r != 0)
+                        local.max_rel_err_ = std::max(local.max_rel_err_, err / std::abs(r));
+
+                    local.ulp_histogram_[get_ulp_bin(get_ulp_distance<T>(out[i], ref[i]))]++;
+                }
+                else
+                {
+                    local.num_out_nan_ += std::isnan(o);
+                    local.num_out_inf_ += std::isinf(o);
+                    local.num_ref_nan_ += std::isnan(r);
+                    local.num_ref_inf_ += std::isinf(r);
+                }
             }
-            res = false;
         }
+
+        local.num_element_ = end - begin;
+
+        // merged in the order the chunks finish, which Merge() does not depend on
+        std::lock_guard<std::mutex> lock(summary_mutex);
+        summary.Merge(local, max_error_index);
+    };
+
+    host_parallel_for(n, f_chunk, 0, std::size_t{1} << 16);
+
+    return summary;
+}
+
+template <typename Range, typename = void>
+struct has_data : std::false_type
+{
+};
+
+template <typename Range>
+struct has_data<Range, std::void_t<decltype(std::data(std::declval<const Range&>()))>>
+    : std::true_type
+{
+};
+
+// calls f with a pointer or a random access iterator to the elements of range, copying them first
+// if the range only offers sequential access
+template <typename Range, typename F>
+decltype(auto) with_random_access(const Range& range, F&& f)
+{
+    using Iter = decltype(std::begin(range));
+
+    if constexpr(has_data<Range>::value)
+    {
+        return f(std::data(range));
+    }
+    else if constexpr(std::is_base_of_v<std::random_access_iterator_tag,
+                                        typename std::iterator_traits<Iter>::iterator_category>)
+    {
+        return f(std::begin(range));
     }
-    if(!res)
+    else
     {
-        const float error_percent =
-            static_cast<float>(err_count) / static_cast<float>(out.size()) * 100.f;
-        std::cerr << "max err: " << max_err;
-        std::cerr << ", number of errors: " << err_count;
-        std::cerr << ", " << error_percent << "% wrong values" << std::endl;
+        const std::vector<ranges::range_value_t<Range>> copy(std::begin(range), std::end(range));
+
+        return f(copy.data());
     }
-    return res;
 }
 
 template <typename Range, typename RefRange>
-typename std::enable_if<
-    std::is_same_v<ranges::range_value_t<Range>, ranges::range_value_t<RefRange>> &&
-        std::is_same_v<ranges::range_value_t<Range>, bhalf_t>,
-    bool>::type
-check_err(const Range& out,
-          const RefRange& ref,
-          const std::string& msg = "Error: Incorrect results!",
-          double rtol            = 1e-3,
-          double atol            = 1e-3)
+bool check_err_impl(const Range& out,
+                    const RefRange& ref,
+                    const std::string& msg,
+                    double rtol,
+                    double atol,
+                    std::size_t max_error_print = 4)
 {
+    using T = ranges::range_value_t<Range>;
+
     if(out.size() != ref.size())
     {
         std::cerr << msg << " out.size() != ref.size(), :" << out.size() << " != " << ref.size()
@@ -92,43 +408,81 @@ check_err(const Range& out,
         return false;
     }
 
-    bool res{true};
-    int err_count = 0;
-    double err    = 0;
-    // TODO: This is a hack. We should have proper specialization for bhalf_t data type.
-    double max_err = std::numeric_limits<float>::min();
-    for(std::size_t i = 0; i < ref.size(); ++i)
-    {
-        const double o = type_convert<float>(*std::next(std::begin(out), i));
-        const double r = type_convert<float>(*std::next(std::begin(ref), i));
-        err            = std::abs(o - r);
-        if(err > atol + rtol * std::abs(r) || !std::isfinite(o) || !std::isfinite(r))
-        {
-            max_err = err > max_err ? err : max_err;
-            err_count++;
-            if(err_count < 5)
+    return with_random_access(out, [&](auto p_out) {
+        return with_random_access(ref, [&](auto p_ref) {
+            const auto summary =
+                get_error_summary<T>(p_out, p_ref, out.size(), rtol, atol, max_error_print);
+
+            if(summary.Passed())
+                return true;
+
+            for(const std::size_t i : summary.error_indices_)
             {
-                std::cerr << msg << std::setw(12) << std::setprecision(7) << " out[" << i
-                          << "] != ref[" << i << "]: " << o << " != " << r << std::endl;
+                if constexpr(is_check_err_integral_v<T>)
+                    std::cerr << msg << " out[" << i << "] != ref[" << i
+                              << "]: " << static_cast<int64_t>(p_out[i])
+                              << " != " << static_cast<int64_t>(p_ref[i]) << std::endl;
+                else
+                    std::cerr << msg << std::setw(12) << std::setprecision(7) << " out[" << i
+                              << "] != ref[" << i << "]: " << to_check_err_value(p_out[i])
+                              << " != " << to_check_err_value(p_ref[i]) << std::endl;
             }
-            res = false;
-        }
-    }
-    if(!res)
-    {
-        const float error_percent =
-            static_cast<float>(err_count) / static_cast<float>(out.size()) * 100.f;
-        std::cerr << "max err: " << max_err;
-        std::cerr << ", number of errors: " << err_count;
-        std::cerr << ", " << error_percent << "% wrong values" << std::endl;
-    }
-    return res;
+
+            std::cerr << "max err: " << summary.max_abs_err_;
+            std::cerr << ", number of errors: " << summary.num_error_;
+            std::cerr << ", " << summary.GetErrorPercent() << "% wrong values" << std::endl;
+
+            return false;
+        });
+    });
+}
+
+} // namespace detail
+
+// Compares out against ref in one parallel pass over the host thread pool, see ErrorSummary.
+// Contiguous and random access ranges are read in place, other ranges are copied first.
+// max_error_index bounds the number of error indices kept in the summary.
+template <typename Range, typename RefRange>
+std::enable_if_t<std::is_same_v<ranges::range_value_t<Range>, ranges::range_value_t<RefRange>>,
+                 ErrorSummary>
+get_error_summary(const Range& out,
+                  const RefRange& ref,
+                  double rtol                 = 1e-5,
+                  double atol                 = 3e-6,
+                  std::size_t max_error_index = 16)
+{
+    using T = ranges::range_value_t<Range>;
+
+    if(out.size() != ref.size())
+        throw std::runtime_error("get_error_summary: out.size() != ref.size()");
+
+    return detail::with_random_access(out, [&](auto p_out) {
+        return detail::with_random_access(ref, [&](auto p_ref) {
+            return detail::get_error_summary<T>(
+                p_out, p_ref, out.size(), rtol, atol, max_error_index);
+        });
+    });
 }
 
 template <typename Range, typename RefRange>
 typename std::enable_if<
     std::is_same_v<ranges::range_value_t<Range>, ranges::range_value_t<RefRange>> &&
-        std::is_same_v<ranges::range_value_t<Range>, half_t>,
+        std::is_floating_point_v<ranges::range_value_t<Range>> &&
+        !std::is_same_v<ranges::range_value_t<Range>, half_t>,
+    bool>::type
+check_err(const Range& out,
+          const RefRange& ref,
+          const std::string& msg = "Error: Incorrect results!",
+          double rtol            = 1e-5,
+          double atol            = 3e-6)
+{
+    return detail::check_err_impl(out, ref, msg, rtol, atol);
+}
+
+template <typename Range, typename RefRange>
+typename std::enable_if<
+    std::is_same_v<ranges::range_value_t<Range>, ranges::range_value_t<RefRange>> &&
+        std::is_same_v<ranges::range_value_t<Range>, bhalf_t>,
     bool>::type
 check_err(const Range& out,
           const RefRange& ref,
@@ -136,43 +490,21 @@ check_err(const Range& out,
           double rtol            = 1e-3,
           double atol            = 1e-3)
 {
-    if(out.size() != ref.size())
-    {
-        std::cerr << msg << " out.size() != ref.size(), :" << out.size() << " != " << ref.size()
-                  << std::endl;
-        return false;
-    }
+    return detail::check_err_impl(out, ref, msg, rtol, atol);
+}
 
-    bool res{true};
-    int err_count  = 0;
-    double err     = 0;
-    double max_err = std::numeric_limits<ranges::range_value_t<Range>>::min();
-    for(std::size_t i = 0; i < ref.size(); ++i)
-    {
-        const double o = type_convert<float>(*std::next(std::begin(out), i));
-        const double r = type_convert<float>(*std::next(std::begin(ref), i));
-        err            = std::abs(o - r);
-        if(err > atol + rtol * std::abs(r) || !std::isfinite(o) || !std::isfinite(r))
-        {
-            max_err = err > max_err ? err : max_err;
-            err_count++;
-            if(err_count < 5)
-            {
-                std::cerr << msg << std::setw(12) << std::setprecision(7) << " out[" << i
-                          << "] != ref[" << i << "]: " << o << " != " << r << std::endl;
-            }
-            res = false;
-        }
-    }
-    if(!res)
-    {
-        const float error_percent =
-            static_cast<float>(err_count) / static_cast<float>(out.size()) * 100.f;
-        std::cerr << "max err: " << max_err;
-        std::cerr << ", number of errors: " << err_count;
-        std::cerr << ", " << error_percent << "% wrong values" << std::endl;
-    }
-    return res;
+template <typename Range, typename RefRange>
+typename std::enable_if<
+    std::is_same_v<ranges::range_value_t<Range>, ranges::range_value_t<RefRange>> &&
+        std::is_same_v<ranges::range_value_t<Range>, half_t>,
+    bool>::type
+check_err(const Range& out,
+          const RefRange& ref,
+          const std::string& msg = "Error: Incorrect results!",
+          double rtol            = 1e-3,
+          double atol            = 1e-3)
+{
+    return detail::check_err_impl(out, ref, msg, rtol, atol);
 }
 
 template <typename Range, typename RefRange>
@@ -190,44 +522,7 @@ check_err(const Range& out,
           double                 = 0,
           double atol            = 0)
 {
-    if(out.size() != ref.size())
-    {
-        std::cerr << msg << " out.size() != ref.size(), :" << out.size() << " != " << ref.size()
-                  << std::endl;
-        return false;
-    }
-
-    bool res{true};
-    int err_count   = 0;
-    int64_t err     = 0;
-    int64_t max_err = std::numeric_limits<int64_t>::min();
-    for(std::size_t i = 0; i < ref.size(); ++i)
-    {
-        const int64_t o = *std::next(std::begin(out), i);
-        const int64_t r = *std::next(std::begin(ref), i);
-        err             = std::abs(o - r);
-
-        if(err > atol)
-        {
-            max_err = err > max_err ? err : max_err;
-            err_count++;
-            if(err_count < 5)
-            {
-                std::cerr << msg << " out[" << i << "] != ref[" << i << "]: " << o << " != " << r
-                          << std::endl;
-            }
-            res = false;
-        }
-    }
-    if(!res)
-    {
-        const float error_percent =
-            static_cast<float>(err_count) / static_cast<float>(out.size()) * 100.f;
-        std::cerr << "max err: " << max_err;
-        std::cerr << ", number of errors: " << err_count;
-        std::cerr << ", " << error_percent << "% wrong values" << std::endl;
-    }
-    return res;
+    return detail::check_err_impl(out, ref, msg, 0, atol);
 }
 
 template <typename Range, typename RefRange>
@@ -240,39 +535,7 @@ check_err(const Range& out,
           double rtol            = 1e-3,
           double atol            = 1e-3)
 {
-    if(out.size() != ref.size())
-    {
-        std::cerr << msg << " out.size() != ref.size(), :" << out.size() << " != " << ref.size()
-                  << std::endl;
-        return false;
-    }
-
-    bool res{true};
-    int err_count  = 0;
-    double err     = 0;
-    double max_err = std::numeric_limits<float>::min();
-    for(std::size_t i = 0; i < ref.size(); ++i)
-    {
-        const double o = type_convert<float>(*std::next(std::begin(out), i));
-        const double r = type_convert<float>(*std::next(std::begin(ref), i));
-        err            = std::abs(o - r);
-        if(err > atol + rtol * std::abs(r) || !std::isfinite(o) || !std::isfinite(r))
-        {
-            max_err = err > max_err ? err : max_err;
-            err_count++;
-            if(err_count < 5)
-            {
-                std::cerr << msg << std::setw(12) << std::setprecision(7) << " out[" << i
-                          << "] != ref[" << i << "]: " << o << " != " << r << std::endl;
-            }
-            res = false;
-        }
-    }
-    if(!res)
-    {
-        std::cerr << std::setw(12) << std::setprecision(7) << "max err: " << max_err << std::endl;
-    }
-    return res;
+    return detail::check_err_impl(out, ref, msg, rtol, atol);
 }
 
 template <typename Range, typename RefRange>
@@ -285,39 +548,7 @@ check_err(const Range& out,
           double rtol            = 1e-3,
           double atol            = 1e-3)
 {
-    if(out.size() != ref.size())
-    {
-        std::cerr << msg << " out.size() != ref.size(), :" << out.size() << " != " << ref.size()
-                  << std::endl;
-        return false;
-    }
-
-    bool res{true};
-    int err_count  = 0;
-    double err     = 0;
-    double max_err = std::numeric_limits<float>::min();
-    for(std::size_t i = 0; i < ref.size(); ++i)
-    {
-        const double o = type_convert<float>(*std::next(std::begin(out), i));
-        const double r = type_convert<float>(*std::next(std::begin(ref), i));
-        err            = std::abs(o - r);
-        if(err > atol + rtol * std::abs(r) || !std::isfinite(o) || !std::isfinite(r))
-        {
-            max_err = err > max_err ? err : max_err;
-            err_count++;
-            if(err_count < 5)
-            {
-                std::cerr << msg << std::setw(12) << std::setprecision(7) << " out[" << i
-                          << "] != ref[" << i << "]: " << o << " != " << r << std::endl;
-            }
-            res = false;
-        }
-    }
-    if(!res)
-    {
-        std::cerr << std::setw(12) << std::setprecision(7) << "max err: " << max_err << std::endl;
-    }
-    return res;
+    return detail::check_err_impl(out, ref, msg, rtol, atol);
 }
 
 } // namespace utils
@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <tuple>
+
+#include "ck/ck.hpp"
+#include "ck/utility/data_type.hpp"
+#include "ck/utility/type_convert.hpp"
+#include "ck/library/utility/host_thread_pool.hpp"
+
+namespace ck {
+
+// rounding of convert_n() to bf16, fp8 and bf8, the other conversions round as type_convert()
+enum struct ConvertRounding
+{
+    // as type_convert<Y>(x): truncation to bf16, and CK_USE_SR_F8_CONVERSION to fp8 and bf8
+    Default,
+    // as bf16_convert_rtn<Y>(x) and f8_convert_rne<Y>(x)
+    NearestEven,
+    // As f8_convert_sr<Y>(x), but the random bits of element i are prand_generator<X, 42>(i, x)
+    // instead of depending on the address of a copy of x, so results are reproducible. bf16 is
+    // rounded to nearest even.
+    Stochastic,
+};
+
+// Converts the n elements of p_x to p_y on the host thread pool, with the results of the scalar
+// conversion selected by rounding.
+//
+// Conversions between float, half_t, bhalf_t, f8_t and bf8_t are specialized in convert.cpp:
+// conversions from 8- and 16-bit types look up tables of all results of the scalar conversion,
+// float to fp8 and bf8 looks up the rounding of the upper 16 bits of the float, and float to half_t
+// uses F16C when the CPU has it. Other types, e.g. int8_t and int4_t, are converted element by
+// element with type_convert().
+template <typename Y, typename X>
+void convert_n(const X* p_x,
+               Y* p_y,
+               std::size_t n,
+               ConvertRounding rounding = ConvertRounding::Default)
+{
+    std::ignore = rounding;
+
+    auto f_range = [&](std::size_t begin, std::size_t end) {
+        for(std::size_t i = begin; i < end; ++i)
+            p_y[i] = type_convert<Y>(p_x[i]);
+    };
+
+    // large enough chunks to amortize the scheduling of the pool
+    ck::utils::host_parallel_for(n, f_range, 0, std::size_t{1} << 16);
+}
+
+template <>
+void convert_n<float, half_t>(const half_t* p_x, float* p_y, std::size_t n, ConvertRounding);
+
+template <>
+void convert_n<float, bhalf_t>(const bhalf_t* p_x, float* p_y, std::size_t n, ConvertRounding);
+
+template <>
+void convert_n<float, f8_t>(const f8_t* p_x, float* p_y, std::size_t n, ConvertRounding);
+
+template <>
+void convert_n<float, bf8_t>(const bf8_t* p_x, float* p_y, std::size_t n, ConvertRounding);
+
+template <>
+void convert_n<half_t, float>(const float* p_x, half_t* p_y, std::size_t n, ConvertRounding);
+
+template <>
+void convert_n<half_t, bhalf_t>(const bhalf_t* p_x, half_t* p_y, std::size_t n, ConvertRounding);
+
+template <>
+void convert_n<half_t, f8_t>(const f8_t* p_x, half_t* p_y, std::size_t n, ConvertRounding);
+
+template <>
+void convert_n<half_t, bf8_t>(const bf8_t* p_x, half_t* p_y, std::size_t n, ConvertRounding);
+
+template <>
+void convert_n<bhalf_t, float>(const float* p_x, bhalf_t* p_y, std::size_t n, ConvertRounding);
+
+template <>
+void convert_n<bhalf_t, half_t>(const half_t* p_x, bhalf_t* p_y, std::size_t n, ConvertRounding);
+
+template <>
+void convert_n<f8_t, float>(const float* p_x, f8_t* p_y, std::size_t n, ConvertRounding);
+
+template <>
+void convert_n<f8_t, half_t>(const half_t* p_x, f8_t* p_y, std::size_t n, ConvertRounding);
+
+template <>
+void convert_n<bf8_t, float>(const float* p_x, bf8_t* p_y, std::size_t n, ConvertRounding);
+
+template <>
+void convert_n<bf8_t, half_t>(const half_t* p_x, bf8_t* p_y, std::size_t n, ConvertRounding);
+
+} // namespace ck
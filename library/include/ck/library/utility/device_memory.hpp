@@ -34,6 +34,13 @@ struct DeviceMem
     void SetValue(T x) const;
     ~DeviceMem();
 
+    // While the cache is enabled, freed buffers are kept and given to later DeviceMem of a
+    // compatible size, at most twice smaller, instead of going through hipFree and hipMalloc. It
+    // is meant for processes running many problems, like the sweeps of ckProfiler. A kept buffer
+    // is handed out after a hipDeviceSynchronize, as hipFree would have waited for the work using
+    // it. Disabling the cache frees the buffers it keeps.
+    static void EnableCache(bool enable);
+
     void* mpDeviceBuf;
     std::size_t mMemSize;
 };
@@ -5,28 +5,66 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <iterator>
 #include <random>
 #include <type_traits>
 #include <utility>
 
 #include "ck/utility/data_type.hpp"
+#include "ck/utility/type_convert.hpp"
+
+#include "ck/library/utility/host_random.hpp"
+#include "ck/library/utility/host_thread_pool.hpp"
 
 namespace ck {
 namespace utils {
 
+namespace detail {
+
+// Assigns gen(i, u) to the i-th element of [first, last), where u is the i-th number of the random
+// stream seed. The values do not depend on how the range is split, so random access ranges are
+// filled in parallel.
+template <typename ForwardIter, typename Gen>
+void fill_random(ForwardIter first, ForwardIter last, uint64_t seed, Gen gen)
+{
+    using Category = typename std::iterator_traits<ForwardIter>::iterator_category;
+
+    if constexpr(std::is_base_of_v<std::random_access_iterator_tag, Category>)
+    {
+        const auto n = static_cast<std::size_t>(std::distance(first, last));
+
+        host_parallel_for(
+            n,
+            [&](std::size_t begin, std::size_t end) {
+                for_each_random_uint32(
+                    seed, begin, end, [&](uint64_t i, uint32_t u) { first[i] = gen(u); });
+            },
+            0,
+            4096);
+    }
+    else
+    {
+        for(uint64_t i = 0; first != last; ++first, ++i)
+            *first = gen(get_random_uint32(seed, i));
+    }
+}
+
+} // namespace detail
+
 template <typename T>
 struct FillUniformDistribution
 {
     float a_{-5.f};
     float b_{5.f};
+    uint64_t seed_{make_random_seed()};
 
     template <typename ForwardIter>
     void operator()(ForwardIter first, ForwardIter last) const
     {
-        std::mt19937 gen(11939);
-        std::uniform_real_distribution<float> dis(a_, b_);
-        std::generate(first, last, [&dis, &gen]() { return ck::type_convert<T>(dis(gen)); });
+        detail::fill_random(first, last, seed_, [a = a_, b = b_](uint32_t u) {
+            return ck::type_convert<T>(a + (b - a) * get_uniform_float(u));
+        });
     }
 
     template <typename ForwardRange>
@@ -64,14 +102,14 @@ struct FillUniformDistributionIntegerValue
 {
     float a_{-5.f};
     float b_{5.f};
+    uint64_t seed_{make_random_seed()};
 
     template <typename ForwardIter>
     void operator()(ForwardIter first, ForwardIter last) const
     {
-        std::mt19937 gen(11939);
-        std::uniform_real_distribution<float> dis(a_, b_);
-        std::generate(
-            first, last, [&dis, &gen]() { return ck::type_convert<T>(std::round(dis(gen))); });
+        detail::fill_random(first, last, seed_, [a = a_, b = b_](uint32_t u) {
+            return ck::type_convert<T>(std::round(a + (b - a) * get_uniform_float(u)));
+        });
     }
 
     template <typename ForwardRange>
@@ -9,8 +9,10 @@
 #include <fstream>
 #include <string>
 #include <algorithm>
+#include <tuple>
 
 #include "ck/ck.hpp"
+#include "ck/library/utility/host_thread_pool.hpp"
 
 namespace ck {
 
@@ -74,52 +76,108 @@ static inline std::vector<T> getTypeValuesFromString(const char* cstr_values)
     return (values);
 }
 
+// number of index tuples spanned by dim_lengths
 template <int NDim>
-static inline std::vector<std::array<index_t, NDim>>
-get_index_set(const std::array<index_t, NDim>& dim_lengths)
+static inline size_t get_index_count(const std::array<index_t, NDim>& dim_lengths)
 {
-    static_assert(NDim >= 1, "NDim >= 1 is required to use this function!");
+    size_t count = 1;
 
-    if constexpr(NDim == 1)
-    {
-        std::vector<std::array<index_t, NDim>> index_set;
+    for(int i = 0; i < NDim; i++)
+        count *= dim_lengths[i];
 
-        for(int i = 0; i < dim_lengths[0]; i++)
-        {
-            std::array<index_t, 1> index{i};
+    return (count);
+};
 
-            index_set.push_back(index);
-        };
+// the i-th index tuple of dim_lengths in row-major order
+template <int NDim>
+static inline std::array<index_t, NDim>
+get_index_from_linear_offset(const std::array<index_t, NDim>& dim_lengths, size_t i)
+{
+    std::array<index_t, NDim> index;
 
-        return index_set;
-    }
-    else
+    for(int d = NDim - 1; d >= 0; d--)
     {
-        std::vector<std::array<index_t, NDim>> index_set;
-        std::array<index_t, NDim - 1> partial_dim_lengths;
+        index[d] = static_cast<index_t>(i % dim_lengths[d]);
+        i /= dim_lengths[d];
+    };
 
-        std::copy(dim_lengths.begin() + 1, dim_lengths.end(), partial_dim_lengths.begin());
+    return (index);
+};
 
-        std::vector<std::array<index_t, NDim - 1>> partial_index_set;
+// advances index to the next tuple in row-major order
+template <int NDim>
+static inline void step_index(const std::array<index_t, NDim>& dim_lengths,
+                              std::array<index_t, NDim>& index)
+{
+    for(int d = NDim - 1; d > 0; d--)
+    {
+        if(++index[d] < dim_lengths[d])
+            return;
 
-        partial_index_set = get_index_set<NDim - 1>(partial_dim_lengths);
+        index[d] = 0;
+    };
 
-        for(index_t i = 0; i < dim_lengths[0]; i++)
-            for(const auto& partial_index : partial_index_set)
-            {
-                std::array<index_t, NDim> index;
+    index[0]++;
+};
 
-                index[0] = i;
+// Calls f(i, offsets...) for the i-th index tuple of dim_lengths in row-major order, where
+// offsets are the inner products of the tuple with each of strides. Offsets are updated
+// incrementally and the memory use is O(NDim).
+template <int NDim, typename F, typename... Strides>
+static inline void for_each_index_offset(const std::array<index_t, NDim>& dim_lengths,
+                                         F&& f,
+                                         const Strides&... strides)
+{
+    static_assert(NDim >= 1, "NDim >= 1 is required to use this function!");
+
+    constexpr size_t NumOffset = sizeof...(Strides);
+
+    const std::array<const std::array<index_t, NDim>*, NumOffset> p_strides{&strides...};
+
+    const size_t count = get_index_count<NDim>(dim_lengths);
+
+    std::array<index_t, NDim> index{};
+    std::array<size_t, NumOffset> offsets{};
+
+    for(size_t i = 0; i < count; i++)
+    {
+        std::apply([&](auto... offset) { f(i, offset...); }, offsets);
 
-                std::copy(partial_index.begin(), partial_index.end(), index.begin() + 1);
+        for(int d = NDim - 1; d >= 0; d--)
+        {
+            for(size_t t = 0; t < NumOffset; t++)
+                offsets[t] += (*p_strides[t])[d];
+
+            if(++index[d] < dim_lengths[d])
+                break;
 
-                index_set.push_back(index);
-            };
+            for(size_t t = 0; t < NumOffset; t++)
+                offsets[t] -= static_cast<size_t>(dim_lengths[d]) * (*p_strides[t])[d];
 
-        return index_set;
+            index[d] = 0;
+        };
     };
 };
 
+// calls f(index) for every index tuple of dim_lengths, spread over the host thread pool
+template <int NDim, typename F>
+static inline void parallel_for_each_index(const std::array<index_t, NDim>& dim_lengths, F&& f)
+{
+    static_assert(NDim >= 1, "NDim >= 1 is required to use this function!");
+
+    ck::utils::host_parallel_for(get_index_count<NDim>(dim_lengths),
+                                 [&](size_t i_begin, size_t i_end) {
+                                     auto index =
+                                         get_index_from_linear_offset<NDim>(dim_lengths, i_begin);
+
+                                     for(size_t i = i_begin; i < i_end; i++)
+                                     {
+                                         f(index);
+                                         step_index<NDim>(dim_lengths, index);
+                                     };
+                                 });
+};
+
 template <int NDim>
 static inline size_t get_offset_from_index(const std::array<index_t, NDim>& strides,
                                            const std::array<index_t, NDim>& index)
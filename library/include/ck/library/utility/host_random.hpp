@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace ck {
+namespace utils {
+
+// Philox4x32-10 counter-based random number generator (Salmon et al., "Parallel Random Numbers:
+// As Easy as 1, 2, 3", SC'11). Every counter is mapped to 4 random 32-bit numbers independently of
+// all other counters, so any part of a random sequence can be generated without the preceding
+// parts, by any thread.
+struct Philox4x32
+{
+    using Counter = std::array<uint32_t, 4>;
+    using Key     = std::array<uint32_t, 2>;
+
+    static constexpr int NumRound = 10;
+
+    static constexpr Counter Generate(Counter counter, Key key)
+    {
+        for(int r = 0; r < NumRound; ++r)
+        {
+            if(r > 0)
+            {
+                key[0] += 0x9E3779B9u;
+                key[1] += 0xBB67AE85u;
+            }
+
+            const uint64_t p0 = uint64_t{0xD2511F53u} * counter[0];
+            const uint64_t p1 = uint64_t{0xCD9E8D57u} * counter[2];
+
+            counter = {static_cast<uint32_t>(p1 >> 32) ^ counter[1] ^ key[0],
+                       static_cast<uint32_t>(p1),
+                       static_cast<uint32_t>(p0 >> 32) ^ counter[3] ^ key[1],
+                       static_cast<uint32_t>(p0)};
+        }
+
+        return counter;
+    }
+
+    static constexpr Key MakeKey(uint64_t seed)
+    {
+        return {static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)};
+    }
+};
+
+// Seed which the random streams of the host fills and tensor generators are derived from. It is
+// read from the environment variable CK_RANDOM_SEED if set, and is 11939 otherwise.
+uint64_t get_host_random_seed();
+
+// sets the host random seed and restarts the sequence of streams returned by make_random_seed()
+void set_host_random_seed(uint64_t seed);
+
+// Restarts the sequence of streams returned by make_random_seed(), keeping the host random seed, so
+// that the tensors generated next only depend on the seed and not on those generated before.
+void restart_random_streams();
+
+// Returns the seed of a new random stream. Successive calls give distinct streams, which only
+// depend on the host random seed and on the number of calls since it was set.
+uint64_t make_random_seed();
+
+// i-th number of the random stream seed
+inline uint32_t get_random_uint32(uint64_t seed, uint64_t i)
+{
+    const uint64_t c = i / 4;
+
+    return Philox4x32::Generate({static_cast<uint32_t>(c), static_cast<uint32_t>(c >> 32), 0, 0},
+                                Philox4x32::MakeKey(seed))[i % 4];
+}
+
+// Calls f(i, u) for every i in [begin, end), where u is the i-th number of the random stream
+// seed. Faster than calling get_random_uint32() for each i.
+template <typename F>
+void for_each_random_uint32(uint64_t seed, uint64_t begin, uint64_t end, F&& f)
+{
+    const auto key = Philox4x32::MakeKey(seed);
+
+    for(uint64_t i = begin; i < end;)
+    {
+        const uint64_t c = i / 4;
+
+        const auto u = Philox4x32::Generate(
+            {static_cast<uint32_t>(c), static_cast<uint32_t>(c >> 32), 0, 0}, key);
+
+        for(; i < end && i / 4 == c; ++i)
+            f(i, u[i % 4]);
+    }
+}
+
+// Number of the random stream seed attached to a tensor index. Indices with up to 4 dimensions
+// get distinct counters, further dimensions are mixed into the counter.
+template <typename... Is>
+uint32_t get_random_uint32_at(uint64_t seed, Is... is)
+{
+    const std::array<uint64_t, sizeof...(Is)> index{static_cast<uint64_t>(is)...};
+
+    Philox4x32::Counter counter{};
+
+    for(std::size_t d = 0; d < index.size(); ++d)
+    {
+        if(d < counter.size())
+            counter[d] = static_cast<uint32_t>(index[d]);
+        else
+            counter[d % 4] = counter[d % 4] * 0x9E3779B1u + static_cast<uint32_t>(index[d]);
+    }
+
+    return Philox4x32::Generate(counter, Philox4x32::MakeKey(seed))[0];
+}
+
+// maps a random 32-bit number to [0, 1)
+inline float get_uniform_float(uint32_t u) { return (u >> 8) * (1.f / 16777216.f); }
+
+// maps a random 32-bit number to [min_value, max_value)
+inline int get_uniform_int(uint32_t u, int min_value, int max_value)
+{
+    const auto range = static_cast<uint32_t>(static_cast<int64_t>(max_value) - min_value);
+
+    return static_cast<int>(static_cast<int64_t>(u % range) + min_value);
+}
+
+} // namespace utils
+} // namespace ck
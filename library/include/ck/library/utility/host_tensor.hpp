@@ -4,9 +4,11 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <iostream>
 #include <numeric>
+#include <stdexcept>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -16,6 +18,8 @@
 #include "ck/utility/type_convert.hpp"
 
 #include "ck/library/utility/algorithm.hpp"
+#include "ck/library/utility/convert.hpp"
+#include "ck/library/utility/host_thread_pool.hpp"
 #include "ck/library/utility/ranges.hpp"
 
 template <typename Range>
@@ -120,6 +124,9 @@ struct HostTensorDescriptor
     std::size_t GetElementSize() const;
     std::size_t GetElementSpaceSize() const;
 
+    // whether the elements are contiguous and in row-major order
+    bool IsPacked() const;
+
     const std::vector<std::size_t>& GetLengths() const;
     const std::vector<std::size_t>& GetStrides() const;
 
@@ -131,11 +138,24 @@ struct HostTensorDescriptor
         return std::inner_product(iss.begin(), iss.end(), mStrides.begin(), std::size_t{0});
     }
 
-    std::size_t GetOffsetFromMultiIndex(std::vector<std::size_t> iss) const
+    std::size_t GetOffsetFromMultiIndex(const std::vector<std::size_t>& iss) const
     {
         return std::inner_product(iss.begin(), iss.end(), mStrides.begin(), std::size_t{0});
     }
 
+    template <std::size_t Rank>
+    std::size_t GetOffsetFromMultiIndex(const std::array<std::size_t, Rank>& idx) const
+    {
+        assert(Rank == this->GetNumOfDimension());
+
+        std::size_t offset = 0;
+
+        for(std::size_t d = 0; d < Rank; ++d)
+            offset += idx[d] * mStrides[d];
+
+        return offset;
+    }
+
     friend std::ostream& operator<<(std::ostream& os, const HostTensorDescriptor& desc);
 
     private:
@@ -159,6 +179,149 @@ HostTensorDescriptor transpose_host_tensor_descriptor_given_new2old(const HostTe
     return HostTensorDescriptor(new_lengths, new_strides);
 }
 
+// Descriptor with a compile-time rank: lengths and strides live in std::arrays, so it never
+// allocates, offsets are computed with fully unrolled loops, and it can be built and used in
+// constant expressions. It converts to and from HostTensorDescriptor, for the dynamic-rank API.
+template <std::size_t Rank>
+struct HostTensorDescriptorN
+{
+    using Index = std::array<std::size_t, Rank>;
+
+    constexpr HostTensorDescriptorN() = default;
+
+    // packed, row-major
+    constexpr HostTensorDescriptorN(const Index& lens)
+        : mLens(lens), mStrides(CalculatePackedStrides(lens)), mIsPacked(true)
+    {
+    }
+
+    constexpr HostTensorDescriptorN(const Index& lens, const Index& strides)
+        : mLens(lens), mStrides(strides), mIsPacked(CalculateIsPacked(lens, strides))
+    {
+    }
+
+    // a template, so that braced lengths do not convert to HostTensorDescriptor
+    template <typename Desc,
+              typename = std::enable_if_t<std::is_same_v<Desc, HostTensorDescriptor>>>
+    explicit HostTensorDescriptorN(const Desc& desc)
+    {
+        if(desc.GetNumOfDimension() != Rank)
+            throw std::runtime_error("wrong! HostTensorDescriptorN rank mismatch");
+
+        std::copy_n(desc.GetLengths().begin(), Rank, mLens.begin());
+        std::copy_n(desc.GetStrides().begin(), Rank, mStrides.begin());
+
+        mIsPacked = CalculateIsPacked(mLens, mStrides);
+    }
+
+    operator HostTensorDescriptor() const { return HostTensorDescriptor(mLens, mStrides); }
+
+    static constexpr std::size_t GetNumOfDimension() { return Rank; }
+
+    constexpr std::size_t GetElementSize() const
+    {
+        std::size_t size = 1;
+        for(std::size_t i = 0; i < Rank; ++i)
+            size *= mLens[i];
+        return size;
+    }
+
+    constexpr std::size_t GetElementSpaceSize() const
+    {
+        std::size_t space = 1;
+        for(std::size_t i = 0; i < Rank; ++i)
+        {
+            if(mLens[i] == 0)
+                continue;
+
+            space += (mLens[i] - 1) * mStrides[i];
+        }
+        return space;
+    }
+
+    constexpr const Index& GetLengths() const { return mLens; }
+    constexpr const Index& GetStrides() const { return mStrides; }
+
+    // whether the elements are contiguous and in row-major order, so that the offset of an element
+    // is its row-major linear index
+    constexpr bool IsPacked() const { return mIsPacked; }
+
+    template <typename... Is>
+    constexpr std::size_t GetOffsetFromMultiIndex(Is... is) const
+    {
+        static_assert(sizeof...(Is) == Rank, "wrong! number of indices != rank");
+
+        return GetOffsetFromMultiIndex(Index{static_cast<std::size_t>(is)...});
+    }
+
+    constexpr std::size_t GetOffsetFromMultiIndex(const Index& idx) const
+    {
+        std::size_t offset = 0;
+        for(std::size_t i = 0; i < Rank; ++i)
+            offset += idx[i] * mStrides[i];
+        return offset;
+    }
+
+    constexpr Index GetMultiIndexFromLinearIndex(std::size_t linear) const
+    {
+        Index idx{};
+        for(std::size_t i = Rank; i-- > 0;)
+        {
+            idx[i] = linear % mLens[i];
+            linear /= mLens[i];
+        }
+        return idx;
+    }
+
+    constexpr std::size_t GetOffsetFromLinearIndex(std::size_t linear) const
+    {
+        return mIsPacked ? linear : GetOffsetFromMultiIndex(GetMultiIndexFromLinearIndex(linear));
+    }
+
+    // advances idx to the next element in row-major order and offset along with it
+    constexpr void StepMultiIndex(Index& idx, std::size_t& offset) const
+    {
+        for(std::size_t i = Rank; i-- > 0;)
+        {
+            offset += mStrides[i];
+
+            if(++idx[i] < mLens[i])
+                return;
+
+            offset -= mLens[i] * mStrides[i];
+            idx[i] = 0;
+        }
+    }
+
+    static constexpr Index CalculatePackedStrides(const Index& lens)
+    {
+        Index strides{};
+        std::size_t stride = 1;
+        for(std::size_t i = Rank; i-- > 0;)
+        {
+            strides[i] = stride;
+            stride *= lens[i];
+        }
+        return strides;
+    }
+
+    private:
+    static constexpr bool CalculateIsPacked(const Index& lens, const Index& strides)
+    {
+        const Index packed_strides = CalculatePackedStrides(lens);
+
+        for(std::size_t i = 0; i < Rank; ++i)
+            if(lens[i] > 1 && strides[i] != packed_strides[i])
+                return false;
+
+        return true;
+    }
+
+    Index mLens{};
+    Index mStrides{};
+    bool mIsPacked = true;
+};
+
 struct joinable_thread : std::thread
 {
     template <typename... Xs>
@@ -208,25 +371,33 @@ struct ParallelTensorFunctor
         return indices;
     }
 
-    void operator()(std::size_t num_thread = 1) const
+    // advance indices to the next element in row-major order
+    void StepNdIndices(std::array<std::size_t, NDIM>& indices) const
     {
-        std::size_t work_per_thread = (mN1d + num_thread - 1) / num_thread;
+        for(std::size_t idim = NDIM; idim-- > 0;)
+        {
+            if(++indices[idim] < mLens[idim])
+                return;
 
-        std::vector<joinable_thread> threads(num_thread);
+            indices[idim] = 0;
+        }
+    }
 
-        for(std::size_t it = 0; it < num_thread; ++it)
-        {
-            std::size_t iw_begin = it * work_per_thread;
-            std::size_t iw_end   = std::min((it + 1) * work_per_thread, mN1d);
+    // runs on the shared host thread pool, using at most num_thread threads
+    void operator()(std::size_t num_thread = 1) const
+    {
+        ck::utils::host_parallel_for(
+            mN1d,
+            [&](std::size_t iw_begin, std::size_t iw_end) {
+                auto indices = GetNdIndices(iw_begin);
 
-            auto f = [=] {
                 for(std::size_t iw = iw_begin; iw < iw_end; ++iw)
                 {
-                    call_f_unpack_args(mF, GetNdIndices(iw));
+                    call_f_unpack_args(mF, indices);
+                    StepNdIndices(indices);
                 }
-            };
-            threads[it] = joinable_thread(f);
-        }
+            },
+            num_thread);
     }
 };
 
@@ -266,13 +437,17 @@ struct Tensor
 
     Tensor(const Descriptor& desc) : mDesc(desc), mData(mDesc.GetElementSpaceSize()) {}
 
+    template <std::size_t Rank>
+    Tensor(const HostTensorDescriptorN<Rank>& desc) : Tensor(Descriptor(desc))
+    {
+    }
+
     template <typename OutT>
     Tensor<OutT> CopyAsType() const
     {
         Tensor<OutT> ret(mDesc);
 
-        ck::ranges::transform(
-            mData, ret.mData.begin(), [](auto value) { return ck::type_convert<OutT>(value); });
+        ck::convert_n(mData.data(), ret.mData.data(), mData.size());
 
         return ret;
     }
@@ -351,6 +526,57 @@ struct Tensor
         ForEach_impl(std::forward<const F>(f), idx, size_t(0));
     }
 
+    template <std::size_t Rank>
+    HostTensorDescriptorN<Rank> GetDescriptorN() const
+    {
+        return HostTensorDescriptorN<Rank>(mDesc);
+    }
+
+    // Calls f(value, idx) for every element, in row-major index order, where idx is a
+    // std::array<std::size_t, Rank>. Unlike ForEach() the index is never allocated, and the offset
+    // of the element is stepped along with it instead of being recomputed.
+    template <std::size_t Rank, typename F>
+    void ForEachElement(F&& f)
+    {
+        ForEachElementImpl<Rank>(*this, std::forward<F>(f));
+    }
+
+    template <std::size_t Rank, typename F>
+    void ForEachElement(F&& f) const
+    {
+        ForEachElementImpl<Rank>(*this, std::forward<F>(f));
+    }
+
+    template <std::size_t Rank, typename Self, typename F>
+    static void ForEachElementImpl(Self& self, F&& f)
+    {
+        const auto desc = self.template GetDescriptorN<Rank>();
+        const auto size = desc.GetElementSize();
+
+        typename HostTensorDescriptorN<Rank>::Index idx{};
+
+        if(desc.IsPacked())
+        {
+            for(std::size_t i = 0; i < size; ++i)
+            {
+                f(self.mData[i], std::as_const(idx));
+
+                std::size_t unused = 0;
+                desc.StepMultiIndex(idx, unused);
+            }
+        }
+        else
+        {
+            std::size_t offset = 0;
+
+            for(std::size_t i = 0; i < size; ++i)
+            {
+                f(self.mData[offset], std::as_const(idx));
+                desc.StepMultiIndex(idx, offset);
+            }
+        }
+    }
+
     template <typename G>
     void GenerateTensorValue(G g, std::size_t num_thread = 1)
     {
@@ -430,12 +656,24 @@ struct Tensor
         return mData[mDesc.GetOffsetFromMultiIndex(is...)];
     }
 
-    T& operator()(std::vector<std::size_t> idx)
+    T& operator()(const std::vector<std::size_t>& idx)
+    {
+        return mData[mDesc.GetOffsetFromMultiIndex(idx)];
+    }
+
+    const T& operator()(const std::vector<std::size_t>& idx) const
+    {
+        return mData[mDesc.GetOffsetFromMultiIndex(idx)];
+    }
+
+    template <std::size_t Rank>
+    T& operator()(const std::array<std::size_t, Rank>& idx)
     {
         return mData[mDesc.GetOffsetFromMultiIndex(idx)];
     }
 
-    const T& operator()(std::vector<std::size_t> idx) const
+    template <std::size_t Rank>
+    const T& operator()(const std::array<std::size_t, Rank>& idx) const
     {
         return mData[mDesc.GetOffsetFromMultiIndex(idx)];
     }
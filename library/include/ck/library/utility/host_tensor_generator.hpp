@@ -9,6 +9,8 @@
 
 #include "ck/ck.hpp"
 
+#include "ck/library/utility/host_random.hpp"
+
 template <typename T>
 struct GeneratorTensor_0
 {
@@ -60,11 +62,14 @@ struct GeneratorTensor_2
 {
     int min_value = 0;
     int max_value = 1;
+    uint64_t seed = ck::utils::make_random_seed();
 
     template <typename... Is>
-    T operator()(Is...)
+    T operator()(Is... is)
     {
-        return static_cast<T>((std::rand() % (max_value - min_value)) + min_value);
+        const uint32_t u = ck::utils::get_random_uint32_at(seed, is...);
+
+        return static_cast<T>(ck::utils::get_uniform_int(u, min_value, max_value));
     }
 };
 
@@ -73,11 +78,14 @@ struct GeneratorTensor_2<ck::bhalf_t>
 {
     int min_value = 0;
     int max_value = 1;
+    uint64_t seed = ck::utils::make_random_seed();
 
     template <typename... Is>
-    ck::bhalf_t operator()(Is...)
+    ck::bhalf_t operator()(Is... is)
     {
-        float tmp = (std::rand() % (max_value - min_value)) + min_value;
+        const uint32_t u = ck::utils::get_random_uint32_at(seed, is...);
+
+        float tmp = ck::utils::get_uniform_int(u, min_value, max_value);
         return ck::type_convert<ck::bhalf_t>(tmp);
     }
 };
@@ -87,11 +95,14 @@ struct GeneratorTensor_2<int8_t>
 {
     int min_value = 0;
     int max_value = 1;
+    uint64_t seed = ck::utils::make_random_seed();
 
     template <typename... Is>
-    int8_t operator()(Is...)
+    int8_t operator()(Is... is)
     {
-        return (std::rand() % (max_value - min_value)) + min_value;
+        const uint32_t u = ck::utils::get_random_uint32_at(seed, is...);
+
+        return ck::utils::get_uniform_int(u, min_value, max_value);
     }
 };
 
@@ -101,11 +112,14 @@ struct GeneratorTensor_2<ck::f8_t>
 {
     int min_value = 0;
     int max_value = 1;
+    uint64_t seed = ck::utils::make_random_seed();
 
     template <typename... Is>
-    ck::f8_t operator()(Is...)
+    ck::f8_t operator()(Is... is)
     {
-        float tmp = (std::rand() % (max_value - min_value)) + min_value;
+        const uint32_t u = ck::utils::get_random_uint32_at(seed, is...);
+
+        float tmp = ck::utils::get_uniform_int(u, min_value, max_value);
         return ck::type_convert<ck::f8_t>(tmp);
     }
 };
@@ -117,11 +131,14 @@ struct GeneratorTensor_2<ck::bf8_t>
 {
     int min_value = 0;
     int max_value = 1;
+    uint64_t seed = ck::utils::make_random_seed();
 
     template <typename... Is>
-    ck::bf8_t operator()(Is...)
+    ck::bf8_t operator()(Is... is)
     {
-        float tmp = (std::rand() % (max_value - min_value)) + min_value;
+        const uint32_t u = ck::utils::get_random_uint32_at(seed, is...);
+
+        float tmp = ck::utils::get_uniform_int(u, min_value, max_value);
         return ck::type_convert<ck::bf8_t>(tmp);
     }
 };
@@ -132,11 +149,12 @@ struct GeneratorTensor_3
 {
     float min_value = 0;
     float max_value = 1;
+    uint64_t seed   = ck::utils::make_random_seed();
 
     template <typename... Is>
-    T operator()(Is...)
+    T operator()(Is... is)
     {
-        float tmp = float(std::rand()) / float(RAND_MAX);
+        float tmp = ck::utils::get_uniform_float(ck::utils::get_random_uint32_at(seed, is...));
 
         return static_cast<T>(min_value + tmp * (max_value - min_value));
     }
@@ -147,11 +165,12 @@ struct GeneratorTensor_3<ck::bhalf_t>
 {
     float min_value = 0;
     float max_value = 1;
+    uint64_t seed   = ck::utils::make_random_seed();
 
     template <typename... Is>
-    ck::bhalf_t operator()(Is...)
+    ck::bhalf_t operator()(Is... is)
     {
-        float tmp = float(std::rand()) / float(RAND_MAX);
+        float tmp = ck::utils::get_uniform_float(ck::utils::get_random_uint32_at(seed, is...));
 
         float fp32_tmp = min_value + tmp * (max_value - min_value);
 
@@ -165,11 +184,12 @@ struct GeneratorTensor_3<ck::f8_t>
 {
     float min_value = 0;
     float max_value = 1;
+    uint64_t seed   = ck::utils::make_random_seed();
 
     template <typename... Is>
-    ck::f8_t operator()(Is...)
+    ck::f8_t operator()(Is... is)
     {
-        float tmp = float(std::rand()) / float(RAND_MAX);
+        float tmp = ck::utils::get_uniform_float(ck::utils::get_random_uint32_at(seed, is...));
 
         float fp32_tmp = min_value + tmp * (max_value - min_value);
 
@@ -184,11 +204,12 @@ struct GeneratorTensor_3<ck::bf8_t>
 {
     float min_value = 0;
     float max_value = 1;
+    uint64_t seed   = ck::utils::make_random_seed();
 
     template <typename... Is>
-    ck::bf8_t operator()(Is...)
+    ck::bf8_t operator()(Is... is)
     {
-        float tmp = float(std::rand()) / float(RAND_MAX);
+        float tmp = ck::utils::get_uniform_float(ck::utils::get_random_uint32_at(seed, is...));
 
         float fp32_tmp = min_value + tmp * (max_value - min_value);
 
@@ -0,0 +1,293 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "ck/library/utility/host_tensor.hpp"
+
+// Non-owning view of host memory through a HostTensorDescriptor. The memory may belong to a Tensor
+// or to anything else (a mapped file, pinned host memory, a framework tensor); slicing,
+// transposition and broadcasting only make a new descriptor and never copy the elements.
+//
+// Like ck::span, a view is a shallow handle: a const TensorView<T> still gives write access to the
+// elements, TensorView<const T> is the read-only view.
+//
+// As a range, a view iterates its elements in row-major index order, so check_err() and the fills
+// of fill.hpp accept views. For a packed view this is the order of the elements in memory. There is
+// deliberately no data(): the elements of a strided view are not a contiguous array.
+//
+// Of the reference operators, ReferenceGemm, ReferenceBatchedGemm, reference_element_wise() and
+// ReferenceSparseEmbeddingsForwardLayernorm take views; the others still take Tensor.
+template <typename T>
+struct TensorView
+{
+    using Descriptor = HostTensorDescriptor;
+    using value_type = std::remove_const_t<T>;
+
+    // random access iterator over the elements in row-major index order. It holds the pointer and
+    // a copy of the descriptor, so it stays valid as long as the memory, even when obtained from a
+    // temporary view.
+    class Iterator
+    {
+        public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = TensorView::value_type;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = T*;
+        using reference         = T&;
+
+        Iterator() = default;
+
+        Iterator(T* p_data, const Descriptor& desc, bool is_packed, std::size_t i)
+            : p_data_{p_data}, desc_{desc}, is_packed_{is_packed}, i_{i}
+        {
+        }
+
+        reference operator*() const
+        {
+            return p_data_[TensorView::GetOffsetFromLinearIndex(desc_, is_packed_, i_)];
+        }
+
+        reference operator[](difference_type n) const
+        {
+            return p_data_[TensorView::GetOffsetFromLinearIndex(desc_, is_packed_, i_ + n)];
+        }
+
+        Iterator& operator++()
+        {
+            ++i_;
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator old = *this;
+            ++i_;
+            return old;
+        }
+
+        Iterator& operator--()
+        {
+            --i_;
+            return *this;
+        }
+
+        Iterator operator--(int)
+        {
+            Iterator old = *this;
+            --i_;
+            return old;
+        }
+
+        Iterator& operator+=(difference_type n)
+        {
+            i_ += n;
+            return *this;
+        }
+
+        Iterator& operator-=(difference_type n)
+        {
+            i_ -= n;
+            return *this;
+        }
+
+        friend Iterator operator+(Iterator it, difference_type n) { return it += n; }
+
+        friend Iterator operator+(difference_type n, Iterator it) { return it += n; }
+
+        friend Iterator operator-(Iterator it, difference_type n) { return it -= n; }
+
+        friend difference_type operator-(const Iterator& lhs, const Iterator& rhs)
+        {
+            return static_cast<difference_type>(lhs.i_) - static_cast<difference_type>(rhs.i_);
+        }
+
+        friend bool operator==(const Iterator& lhs, const Iterator& rhs)
+        {
+            return lhs.i_ == rhs.i_;
+        }
+
+        friend bool operator!=(const Iterator& lhs, const Iterator& rhs)
+        {
+            return lhs.i_ != rhs.i_;
+        }
+
+        friend bool operator<(const Iterator& lhs, const Iterator& rhs) { return lhs.i_ < rhs.i_; }
+
+        friend bool operator>(const Iterator& lhs, const Iterator& rhs) { return lhs.i_ > rhs.i_; }
+
+        friend bool operator<=(const Iterator& lhs, const Iterator& rhs)
+        {
+            return lhs.i_ <= rhs.i_;
+        }
+
+        friend bool operator>=(const Iterator& lhs, const Iterator& rhs)
+        {
+            return lhs.i_ >= rhs.i_;
+        }
+
+        private:
+        T* p_data_ = nullptr;
+        Descriptor desc_;
+        bool is_packed_ = true;
+        std::size_t i_  = 0;
+    };
+
+    TensorView(T* p_data, const Descriptor& desc)
+        : mDesc(desc), mData(p_data), mIsPacked(desc.IsPacked())
+    {
+    }
+
+    TensorView(Tensor<value_type>& tensor) : TensorView(tensor.mData.data(), tensor.mDesc) {}
+
+    template <typename U = T, typename = std::enable_if_t<std::is_const_v<U>>>
+    TensorView(const Tensor<value_type>& tensor) : TensorView(tensor.mData.data(), tensor.mDesc)
+    {
+    }
+
+    template <typename U = T, typename = std::enable_if_t<std::is_const_v<U>>>
+    TensorView(const TensorView<value_type>& other) : TensorView(other.mData, other.mDesc)
+    {
+    }
+
+    decltype(auto) GetLengths() const { return mDesc.GetLengths(); }
+
+    decltype(auto) GetStrides() const { return mDesc.GetStrides(); }
+
+    std::size_t GetNumOfDimension() const { return mDesc.GetNumOfDimension(); }
+
+    std::size_t GetElementSize() const { return mDesc.GetElementSize(); }
+
+    std::size_t GetElementSpaceSize() const { return mDesc.GetElementSpaceSize(); }
+
+    // whether the elements are contiguous and in row-major order
+    bool IsPacked() const { return mIsPacked; }
+
+    template <typename... Is>
+    std::size_t GetOffsetFromMultiIndex(Is... is) const
+    {
+        return mDesc.GetOffsetFromMultiIndex(is...);
+    }
+
+    std::size_t GetOffsetFromLinearIndex(std::size_t i) const
+    {
+        return GetOffsetFromLinearIndex(mDesc, mIsPacked, i);
+    }
+
+    template <typename... Is>
+    T& operator()(Is... is) const
+    {
+        return mData[mDesc.GetOffsetFromMultiIndex(is...)];
+    }
+
+    T& operator()(std::vector<std::size_t> idx) const
+    {
+        return mData[mDesc.GetOffsetFromMultiIndex(idx)];
+    }
+
+    // elements [begin, end) of dimension dim
+    TensorView Slice(std::size_t dim, std::size_t begin, std::size_t end) const
+    {
+        if(dim >= GetNumOfDimension() || begin > end || end > GetLengths()[dim])
+            throw std::runtime_error("wrong! invalid TensorView slice");
+
+        auto lengths = GetLengths();
+        lengths[dim] = end - begin;
+
+        return TensorView(mData + begin * GetStrides()[dim], Descriptor(lengths, GetStrides()));
+    }
+
+    // dimension i of the result is dimension new2old[i] of this view
+    template <typename New2Old>
+    TensorView Transpose(const New2Old& new2old) const
+    {
+        if(std::size(new2old) != GetNumOfDimension())
+            throw std::runtime_error("wrong! invalid TensorView transpose");
+
+        return TensorView(mData, transpose_host_tensor_descriptor_given_new2old(mDesc, new2old));
+    }
+
+    // NumPy broadcasting: the dimensions are aligned from the innermost one, dimensions of length
+    // 1 and new outer dimensions get stride 0
+    template <typename Lengths>
+    TensorView Broadcast(const Lengths& new_lengths) const
+    {
+        const std::size_t num_dim     = std::size(new_lengths);
+        const std::size_t old_num_dim = GetNumOfDimension();
+
+        if(num_dim < old_num_dim)
+            throw std::runtime_error("wrong! invalid TensorView broadcast");
+
+        std::vector<std::size_t> lengths(std::begin(new_lengths), std::end(new_lengths));
+        std::vector<std::size_t> strides(num_dim, 0);
+
+        for(std::size_t d = 0; d < old_num_dim; ++d)
+        {
+            const std::size_t old_length = GetLengths()[d];
+            const std::size_t new_d      = num_dim - old_num_dim + d;
+
+            if(old_length == lengths[new_d])
+                strides[new_d] = GetStrides()[d];
+            else if(old_length != 1)
+                throw std::runtime_error("wrong! invalid TensorView broadcast");
+        }
+
+        return TensorView(mData, Descriptor(lengths, strides));
+    }
+
+    Iterator begin() const { return Iterator{mData, mDesc, mIsPacked, 0}; }
+
+    Iterator end() const { return Iterator{mData, mDesc, mIsPacked, size()}; }
+
+    std::size_t size() const { return GetElementSize(); }
+
+    Descriptor mDesc;
+    T* mData;
+
+    private:
+    static std::size_t
+    GetOffsetFromLinearIndex(const Descriptor& desc, bool is_packed, std::size_t i)
+    {
+        if(is_packed)
+            return i;
+
+        const auto& lengths = desc.GetLengths();
+        const auto& strides = desc.GetStrides();
+
+        std::size_t offset = 0;
+
+        for(std::size_t d = lengths.size(); d-- > 0;)
+        {
+            offset += (i % lengths[d]) * strides[d];
+            i /= lengths[d];
+        }
+
+        return offset;
+    }
+
+    bool mIsPacked;
+};
+
+template <typename T>
+TensorView<T> make_tensor_view(T* p_data, const HostTensorDescriptor& desc)
+{
+    return TensorView<T>(p_data, desc);
+}
+
+template <typename T>
+TensorView<T> make_tensor_view(Tensor<T>& tensor)
+{
+    return TensorView<T>(tensor);
+}
+
+template <typename T>
+TensorView<const T> make_tensor_view(const Tensor<T>& tensor)
+{
+    return TensorView<const T>(tensor);
+}
@@ -0,0 +1,142 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/wrapper/layout.hpp"
+#include "ck/wrapper/tensor.hpp"
+#include "ck/library/utility/host_thread_pool.hpp"
+
+namespace ck {
+namespace wrapper {
+namespace host {
+
+/**
+ * \brief Host emulation of a thread block running a wrapper tile algorithm.
+ *
+ * The blocks of a host launch run in parallel on the host thread pool, one block at a time per
+ * worker thread. The threads of a block are emulated by that worker as lanes: ForEachThread()
+ * runs a per-thread function for every thread id in order, and returns once all the threads are
+ * done, which stands for a barrier of the block (block_sync_lds()). State that lives in registers
+ * across a barrier on the device, e.g. a VGPR tensor, lives in one object per thread on the host.
+ */
+class ThreadGroup
+{
+    public:
+    ThreadGroup(index_t block_id, index_t num_thread)
+        : block_id_(block_id), num_thread_(num_thread)
+    {
+    }
+
+    /**
+     * \brief Index of the block in the grid (blockIdx.x).
+     */
+    index_t GetBlockId() const { return block_id_; }
+
+    /**
+     * \brief Number of threads of the block (blockDim.x).
+     */
+    index_t GetNumThreads() const { return num_thread_; }
+
+    /**
+     * \brief Call f(thread_id) for every thread of the block, then synchronize the block.
+     *
+     * \param f Per-thread function, the body of the kernel between two barriers.
+     */
+    template <typename F>
+    void ForEachThread(F&& f) const
+    {
+        for(index_t thread_id = 0; thread_id < num_thread_; ++thread_id)
+        {
+            f(thread_id);
+        }
+    }
+
+    private:
+    index_t block_id_;
+    index_t num_thread_;
+};
+
+/**
+ * \brief Run a wrapper kernel on the host: kernel(group) for every block of the grid, with the
+ *  blocks spread over the host thread pool.
+ *
+ * \param grid_size Number of blocks (gridDim.x).
+ * \param block_size Number of threads per block (blockDim.x).
+ * \param kernel Block function taking a const ThreadGroup&. Memory it allocates, e.g. the buffer
+ *  of an LDS tensor, is private to the block.
+ */
+template <typename F>
+void launch_host_kernel(index_t grid_size, index_t block_size, F&& kernel)
+{
+    ck::utils::host_parallel_for(grid_size, [&](std::size_t block_begin, std::size_t block_end) {
+        for(std::size_t block_id = block_begin; block_id < block_end; ++block_id)
+        {
+            kernel(ThreadGroup(static_cast<index_t>(block_id), block_size));
+        }
+    });
+}
+
+/**
+ * \brief Copy between two tensors by all the threads of a group, each thread copying its local
+ *  partition of the tensors.
+ *
+ * The threads run in lockstep like the lanes of a wavefront. The partitions of all the threads
+ * share one layout and differ by their pointers only, so the offsets of element i are calculated
+ * once, and element i of every lane is copied before element i + 1.
+ *
+ * \param group Thread group of the block.
+ * \param src_tensor Source tensor, e.g. the tile of the block in global memory.
+ * \param dst_tensor Destination tensor of the same shape.
+ * \param thread_lengths Layout of threads, as for make_local_partition.
+ * \param steps Thread steps (default=1, raked partition).
+ */
+template <typename SrcTensorType,
+          typename DstTensorType,
+          typename ThreadLengthsTuple,
+          typename StepsTuple = Tuple<>>
+void copy(const ThreadGroup& group,
+          const SrcTensorType& src_tensor,
+          DstTensorType& dst_tensor,
+          const ThreadLengthsTuple& thread_lengths,
+          const StepsTuple steps = StepsTuple{})
+{
+    static_assert(SrcTensorType::IsDynamicBuffer && DstTensorType::IsDynamicBuffer,
+                  "Register tensors are per thread, copy them with ck::wrapper::copy.");
+
+    using SrcElementType = typename SrcTensorType::TensorElementType;
+    using DstElementType = typename DstTensorType::TensorElementType;
+
+    const index_t num_thread = group.GetNumThreads();
+
+    std::vector<SrcElementType*> p_srcs(num_thread);
+    std::vector<DstElementType*> p_dsts(num_thread);
+
+    group.ForEachThread([&](index_t thread_id) {
+        p_srcs[thread_id] =
+            make_local_partition(src_tensor, thread_lengths, thread_id, steps).GetPointer();
+        p_dsts[thread_id] =
+            make_local_partition(dst_tensor, thread_lengths, thread_id, steps).GetPointer();
+    });
+
+    const auto src_layout = layout(make_local_partition(src_tensor, thread_lengths, 0, steps));
+    const auto dst_layout = layout(make_local_partition(dst_tensor, thread_lengths, 0, steps));
+
+    for(index_t i = 0; i < size(src_layout); ++i)
+    {
+        const index_t src_offset = src_layout(make_tuple(i));
+        const index_t dst_offset = dst_layout(make_tuple(i));
+
+        group.ForEachThread([&](index_t thread_id) {
+            p_dsts[thread_id][dst_offset] = p_srcs[thread_id][src_offset];
+        });
+    }
+}
+
+} // namespace host
+} // namespace wrapper
+} // namespace ck
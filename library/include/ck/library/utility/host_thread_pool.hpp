@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ck {
+namespace utils {
+
+// Persistent, process-wide pool of host worker threads shared by ParallelTensorFunctor and the
+// CPU reference operators.
+//
+// A parallel loop over [0, n) is cut into chunks, and each participating thread owns a contiguous
+// range of chunks which it consumes from the front. Threads that run out of work steal chunks from
+// the back of other threads' ranges, which balances triangular or padded workloads.
+//
+// The number of threads defaults to the environment variable CK_HOST_NUM_THREADS if set, or to
+// std::thread::hardware_concurrency() otherwise, and can be changed with SetNumThreads().
+// Parallel loops issued from inside a pool task run serially on the calling thread.
+class HostThreadPool
+{
+    public:
+    static HostThreadPool& GetInstance();
+
+    HostThreadPool(const HostThreadPool&) = delete;
+    HostThreadPool& operator=(const HostThreadPool&) = delete;
+
+    ~HostThreadPool();
+
+    // number of threads taking part in a parallel loop, including the calling thread
+    std::size_t GetNumThreads() const;
+
+    // Waits for the running parallel loop, if any, to finish. Throws std::logic_error when called
+    // from a task of a parallel loop, which would wait for itself.
+    void SetNumThreads(std::size_t num_thread);
+
+    // Calls f(begin, end) on disjoint sub-ranges covering [0, n) using at most max_thread threads
+    // (0: all threads of the pool). Each sub-range has at least grain indices, except possibly the
+    // last one (0: chosen automatically).
+    template <typename F>
+    void ParallelFor(std::size_t n, F&& f, std::size_t max_thread = 0, std::size_t grain = 0)
+    {
+        using Func = std::remove_reference_t<F>;
+
+        auto task = [](const void* p_f, std::size_t begin, std::size_t end) {
+            (*static_cast<Func*>(const_cast<void*>(p_f)))(begin, end);
+        };
+
+        Run(n, grain, max_thread, task, static_cast<const void*>(std::addressof(f)));
+    }
+
+    private:
+    using Task = void (*)(const void*, std::size_t, std::size_t);
+
+    struct alignas(64) ChunkRange
+    {
+        // [front, back) packed as (back << 32) | front
+        std::atomic<uint64_t> range{0};
+    };
+
+    HostThreadPool();
+
+    void Run(std::size_t n, std::size_t grain, std::size_t max_thread, Task task, const void* p_f);
+
+    void StartWorkers(std::size_t num_thread);
+    void StopWorkers();
+
+    void WorkerLoop(std::size_t worker_id, uint64_t seen_generation);
+    void Execute(std::size_t participant_id);
+
+    bool PopFront(std::size_t participant_id, std::size_t& chunk);
+    bool StealBack(std::size_t participant_id, std::size_t& chunk);
+
+    std::mutex run_mutex_;
+
+    std::mutex mutex_;
+    std::condition_variable job_cv_;
+    std::condition_variable done_cv_;
+
+    std::vector<std::thread> workers_;
+    std::unique_ptr<ChunkRange[]> ranges_;
+
+    // workers_.size() + 1, readable without run_mutex_
+    std::atomic<std::size_t> num_threads_{1};
+
+    bool stop_            = false;
+    uint64_t generation_  = 0;
+    std::size_t num_busy_ = 0;
+
+    // description of the job currently running
+    Task task_                    = nullptr;
+    const void* p_f_              = nullptr;
+    std::size_t n_                = 0;
+    std::size_t chunk_size_       = 0;
+    std::size_t num_participants_ = 0;
+    std::exception_ptr exception_;
+};
+
+inline std::size_t get_host_num_threads() { return HostThreadPool::GetInstance().GetNumThreads(); }
+
+inline void set_host_num_threads(std::size_t num_thread)
+{
+    HostThreadPool::GetInstance().SetNumThreads(num_thread);
+}
+
+template <typename F>
+void host_parallel_for(std::size_t n, F&& f, std::size_t max_thread = 0, std::size_t grain = 0)
+{
+    HostThreadPool::GetInstance().ParallelFor(n, std::forward<F>(f), max_thread, grain);
+}
+
+} // namespace utils
+} // namespace ck
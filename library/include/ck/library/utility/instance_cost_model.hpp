@@ -0,0 +1,139 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <optional>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+
+#include "ck/library/utility/convolution_parameter.hpp"
+
+namespace ck {
+namespace utils {
+
+// Analytical cost model of tiled GEMM instances, to rank the instances of a problem before any of
+// them is launched.
+//
+// Every output tile of MPerBlock x NPerBlock is computed by one workgroup, which streams the A and
+// B tiles of its K loop through LDS. A tile takes the longer of its MFMA time and of its load time,
+// the loads being slowed down by narrow vector accesses. The model then accounts for:
+// - padding waste: a tile is always computed whole, and instances whose GemmSpecialization does
+//   not pad a dimension that is not a multiple of the tile are not applicable,
+// - occupancy: the workgroups resident on a CU are limited by their LDS footprint and block size,
+//   and too few waves per SIMD do not keep the MFMA pipes busy,
+// - wave quantisation: the tiles run in waves of num_cu x (workgroups per CU), the last one being
+//   as long as a full one.
+//
+// The estimates are meant for ranking instances of the same problem, not as absolute timings.
+struct GemmCostModelProblem
+{
+    std::size_t M_;
+    std::size_t N_;
+    std::size_t K_;
+
+    // number of independent GEMMs, e.g. the groups of a grouped convolution
+    std::size_t batch_ = 1;
+
+    std::size_t a_bytes_ = 2;
+    std::size_t b_bytes_ = 2;
+    std::size_t c_bytes_ = 2;
+};
+
+// defaults are one MI200 GCD running FP16 MFMA
+struct GemmCostModelDevice
+{
+    std::size_t num_cu_             = 110;
+    double clock_ghz_               = 1.7;
+    std::size_t lds_bytes_per_cu_   = 65536;
+    std::size_t max_threads_per_cu_ = 2048;
+    std::size_t num_simd_per_cu_    = 4;
+    std::size_t wave_size_          = 64;
+    double flops_per_cu_per_cycle_  = 1024;
+    // sustained global memory (mostly L2) bandwidth seen by a CU
+    double bytes_per_cu_per_cycle_ = 16;
+};
+
+// tile configuration of a GEMM-like instance, read from its DeviceOperatorDescriptor
+struct GemmTileConfig
+{
+    std::size_t block_size_;
+    std::size_t m_per_block_;
+    std::size_t n_per_block_;
+    std::size_t k_per_block_;
+
+    bool pad_m_;
+    bool pad_n_;
+    bool pad_k_;
+
+    // 0 if the instance does not tell
+    std::size_t a_scalar_per_vector_;
+    std::size_t b_scalar_per_vector_;
+};
+
+// Nullopt if the descriptor does not have the tile sizes. KPerBlock is in elements, or
+// K0PerBlock * K1 for the instances which split K.
+std::optional<GemmTileConfig>
+get_gemm_tile_config(const ck::tensor_operation::device::DeviceOperatorDescriptor& desc);
+
+// estimated time [ms] of the problem, nullopt if the tile configuration cannot run it
+std::optional<double> estimate_gemm_time(const GemmTileConfig& config,
+                                         const GemmCostModelProblem& problem,
+                                         const GemmCostModelDevice& device = {});
+
+// Implicit GEMM of a forward convolution: M = N * output pixels, N = K, K = C * filter taps, one
+// GEMM per group. The element sizes are left at their defaults.
+GemmCostModelProblem make_gemm_cost_model_problem(const ck::utils::conv::ConvParam& param);
+
+// estimated time [ms] of an instance, nullopt if it has no tile configuration or cannot run the
+// problem
+inline std::optional<double>
+estimate_instance_time(const ck::tensor_operation::device::BaseOperator& op,
+                       const GemmCostModelProblem& problem,
+                       const GemmCostModelDevice& device = {})
+{
+    const auto config = get_gemm_tile_config(op.GetDescriptor());
+
+    if(!config)
+        return std::nullopt;
+
+    return estimate_gemm_time(*config, problem, device);
+}
+
+// Indices of op_ptrs from the lowest to the highest estimated time. Instances without an estimate
+// come last, in their original order.
+template <typename OpPtrs>
+std::vector<std::size_t> rank_instances_by_cost(const OpPtrs& op_ptrs,
+                                                const GemmCostModelProblem& problem,
+                                                const GemmCostModelDevice& device = {})
+{
+    std::vector<std::optional<double>> times;
+    times.reserve(op_ptrs.size());
+
+    for(const auto& op_ptr : op_ptrs)
+        times.push_back(estimate_instance_time(*op_ptr, problem, device));
+
+    std::vector<std::size_t> order(op_ptrs.size());
+    std::iota(order.begin(), order.end(), std::size_t{0});
+
+    std::stable_sort(order.begin(), order.end(), [&](std::size_t lhs, std::size_t rhs) {
+        if(!times[rhs])
+            return times[lhs].has_value();
+
+        return times[lhs] && *times[lhs] < *times[rhs];
+    });
+
+    return order;
+}
+
+// Spearman rank correlation of x and y, ties get their average rank. 1 if the orders agree, -1 if
+// they are opposite.
+double get_rank_correlation(const std::vector<double>& x, const std::vector<double>& y);
+
+} // namespace utils
+} // namespace ck
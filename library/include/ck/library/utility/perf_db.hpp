@@ -0,0 +1,144 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+
+#include "ck/utility/data_type.hpp"
+
+namespace ck {
+namespace utils {
+
+// Tuning database: the best device operation instance found for a problem, so that the instance
+// search of DeviceOperationInstanceFactory<DeviceOp>::GetInstances() is only run once per problem.
+//
+// A database file is plain text, one record per line:
+//
+//   <key> \t <instance id> \t <instance name> \t <ave_time [ms]> \t <tflops> \t <GB/s>
+//
+// The instance name is the GetTypeString() of the instance, its id is the index of the instance in
+// GetInstances() when it was recorded. Ids are only a shortcut: they change when instances are
+// added, so a cached instance is always checked by name.
+struct PerfDbEntry
+{
+    std::size_t instance_id_;
+    std::string instance_name_;
+    float ave_time_;
+    float tflops_;
+    float gb_per_sec_;
+};
+
+class PerfDb
+{
+    public:
+    PerfDb() = default;
+
+    // loads the file if it exists
+    explicit PerfDb(const std::string& path);
+
+    // Adds the records of a file. Returns false if the file cannot be opened, throws if a record
+    // is malformed.
+    bool Load(const std::string& path);
+
+    // Writes all records, sorted by key, to a temporary file which is then renamed to path, so that
+    // readers never see a partially written database. Returns false on failure.
+    bool Save(const std::string& path) const;
+
+    // nullptr if the key has no record
+    const PerfDbEntry* Find(const std::string& key) const;
+
+    // Keeps the faster of the existing record and entry. Returns whether entry was stored.
+    bool Record(const std::string& key, const PerfDbEntry& entry);
+
+    // records every entry of other
+    void Merge(const PerfDb& other);
+
+    std::size_t Size() const { return entries_.size(); }
+
+    private:
+    std::unordered_map<std::string, PerfDbEntry> entries_;
+};
+
+// "<op>|<data types>|<layouts>|<problem>", each list comma-separated
+std::string make_perf_db_key(const std::string& op,
+                             const std::vector<std::string>& data_types,
+                             const std::vector<std::string>& layouts,
+                             const std::vector<int64_t>& problem);
+
+namespace detail {
+
+template <typename T, typename = void>
+struct has_layout_name : std::false_type
+{
+};
+
+template <typename T>
+struct has_layout_name<T, std::void_t<decltype(T::name)>> : std::true_type
+{
+};
+
+} // namespace detail
+
+// name of a data type or of a tensor layout in the keys
+template <typename T>
+std::string get_perf_db_type_name()
+{
+    if constexpr(detail::has_layout_name<T>::value)
+        return T::name;
+    else if constexpr(std::is_same_v<T, double>)
+        return "fp64";
+    else if constexpr(std::is_same_v<T, float>)
+        return "fp32";
+    else if constexpr(std::is_same_v<T, half_t>)
+        return "fp16";
+    else if constexpr(std::is_same_v<T, bhalf_t>)
+        return "bf16";
+    else if constexpr(std::is_same_v<T, f8_t>)
+        return "fp8";
+    else if constexpr(std::is_same_v<T, bf8_t>)
+        return "bf8";
+    else if constexpr(std::is_same_v<T, int8_t>)
+        return "int8";
+    else if constexpr(std::is_same_v<T, int32_t>)
+        return "int32";
+    else
+        return typeid(T).name();
+}
+
+template <typename... Ts>
+std::vector<std::string> get_perf_db_type_names()
+{
+    return {get_perf_db_type_name<Ts>()...};
+}
+
+// Index in op_ptrs of the instance recorded for key, or op_ptrs.size() if there is no record or
+// the recorded instance is not in op_ptrs. The recorded id is tried first, so the lookup does not
+// scan op_ptrs unless the instance list changed since the record was made.
+template <typename OpPtrs>
+std::size_t find_perf_db_instance(const PerfDb& db, const std::string& key, const OpPtrs& op_ptrs)
+{
+    const PerfDbEntry* entry = db.Find(key);
+
+    if(entry == nullptr)
+        return op_ptrs.size();
+
+    if(entry->instance_id_ < op_ptrs.size() &&
+       op_ptrs[entry->instance_id_]->GetTypeString() == entry->instance_name_)
+        return entry->instance_id_;
+
+    for(std::size_t i = 0; i < op_ptrs.size(); ++i)
+        if(op_ptrs[i]->GetTypeString() == entry->instance_name_)
+            return i;
+
+    return op_ptrs.size();
+}
+
+} // namespace utils
+} // namespace ck
@@ -0,0 +1,160 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/utility/type_convert.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+
+namespace ck {
+namespace utils {
+
+// Machine-readable profiling results: one record per timed instance, appended to a result file so
+// that runs can be compared without parsing the profiler logs.
+//
+// The format of a file follows its extension: ".csv" files are CSV with a header line, any other
+// file is JSON Lines, one object per line:
+//
+//   {"op": "gemm", "data_types": ["fp16", ...], "layouts": ["RowMajor", ...],
+//    "problem": [M, N, K, ...], "instance": "<GetTypeString()>",
+//    "descriptor": {"name": ..., "hash": "0x...", "params": {"BlockSize": 256, ...}},
+//    "time_ms": {"samples": [...], "mean": ..., "median": ..., "p10": ..., "p90": ...,
+//                "stddev": ..., "min": ..., "max": ...},
+//    "tflops": ..., "gb_per_sec": ..., "verification": "pass" | "fail" | "not_run",
+//    "error": {"max_abs": ..., "max_rel": ...}}
+//
+// In CSV the lists are ';'-separated within their cell, and the descriptor parameters are written
+// as "key=value;...". Non-finite numbers are written as null in JSON and read back as 0.
+struct TimeStatistics
+{
+    std::size_t num_samples_ = 0;
+    double mean_             = 0;
+    double median_           = 0;
+    // 10th and 90th percentiles, interpolated between the closest samples
+    double p10_ = 0;
+    double p90_ = 0;
+    // sample standard deviation
+    double stddev_ = 0;
+    double min_    = 0;
+    double max_    = 0;
+};
+
+TimeStatistics get_time_statistics(std::vector<double> samples);
+
+struct ErrorStatistics
+{
+    double max_abs_error_ = 0;
+    // relative to the magnitude of the reference value, for reference values other than 0
+    double max_rel_error_ = 0;
+};
+
+// error of out against the reference values ref, element by element
+template <typename Range, typename RefRange>
+ErrorStatistics get_error_statistics(const Range& out, const RefRange& ref)
+{
+    ErrorStatistics stats;
+
+    auto out_it = std::begin(out);
+    auto ref_it = std::begin(ref);
+
+    for(; out_it != std::end(out) && ref_it != std::end(ref); ++out_it, ++ref_it)
+    {
+        const double o = type_convert<float>(*out_it);
+        const double r = type_convert<float>(*ref_it);
+
+        const double abs_error = std::abs(o - r);
+
+        stats.max_abs_error_ = std::max(stats.max_abs_error_, abs_error);
+
+        if(r != 0)
+            stats.max_rel_error_ = std::max(stats.max_rel_error_, abs_error / std::abs(r));
+    }
+
+    return stats;
+}
+
+enum struct VerificationStatus
+{
+    NotRun,
+    Pass,
+    Fail,
+};
+
+struct ProfileResult
+{
+    std::string op_;
+    std::vector<std::string> data_types_;
+    std::vector<std::string> layouts_;
+    // sizes and strides, in the order of the command line of the profiler
+    std::vector<int64_t> problem_;
+
+    std::string instance_name_;
+    ck::tensor_operation::device::DeviceOperatorDescriptor descriptor_;
+
+    // time of every timed run
+    std::vector<double> time_samples_ms_;
+    float tflops_     = 0;
+    float gb_per_sec_ = 0;
+
+    VerificationStatus verification_ = VerificationStatus::NotRun;
+    ErrorStatistics error_;
+};
+
+// Appends the result to the file, creating it, with its CSV header, if needed. Returns false on
+// failure.
+bool append_profile_result(const std::string& path, const ProfileResult& result);
+
+// Reads all records of a file. Returns false if the file cannot be opened, throws if a record is
+// malformed.
+bool load_profile_results(const std::string& path, std::vector<ProfileResult>& results);
+
+// the problem of a record and its instance, see make_perf_db_key()
+std::string make_profile_result_key(const ProfileResult& result);
+
+struct ProfileResultComparison
+{
+    std::string key_;
+    TimeStatistics baseline_;
+    TimeStatistics current_;
+    // current_.median_ / baseline_.median_ - 1
+    double change_;
+    // the median is more than threshold slower and the time ranges do not overlap: p10 of current
+    // is above p90 of the baseline
+    bool regression_;
+    // verification passed in the baseline and failed now
+    bool verification_regression_;
+};
+
+// Compares the records with the same key, the last record of a key in each list is used. Records
+// that are only in one of the lists are left out.
+std::vector<ProfileResultComparison> compare_profile_results(
+    const std::vector<ProfileResult>& baseline,
+    const std::vector<ProfileResult>& current,
+    double threshold);
+
+// A problem of a ckProfiler sweep: the name of a profiler operation and its command line arguments,
+// as they would follow the operation name on the command line.
+//
+// Problem files are CSV for a ".csv" file, one problem per row, first the operation then its
+// arguments, and JSON Lines otherwise, one {"op": "gemm", "args": [1, 1, ...]} per line. Numbers
+// and strings are both accepted as arguments. Empty lines and lines starting with '#' are skipped.
+struct ProfileProblem
+{
+    std::string op_;
+    std::vector<std::string> args_;
+};
+
+// Reads all problems of a file. Returns false if the file cannot be opened, throws if a problem is
+// malformed.
+bool load_profile_problems(const std::string& path, std::vector<ProfileProblem>& problems);
+
+} // namespace utils
+} // namespace ck
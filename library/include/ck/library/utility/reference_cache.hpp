@@ -0,0 +1,139 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ck {
+namespace utils {
+
+// Outputs of the CPU reference operators, so that a problem verified again does not recompute its
+// reference: in memory, e.g. for a layer shape repeated in a network sweep, and in a directory
+// shared by the profiler, test and example processes.
+//
+// The key has to identify everything the output depends on: operation, data types, layouts,
+// element operations, problem, initialization method and random seed. The least recently used
+// outputs are evicted once the memory or the directory holds more than its capacity.
+//
+// Every output in the directory is one file named after the hash of its key, holding
+//
+//   "CKREF001" | key size (uint64) | key | output size (uint64) | output bytes
+//
+// which is memory-mapped on load. The key is checked, so outputs of colliding keys are not mixed
+// up.
+class ReferenceCache
+{
+    public:
+    // a cache of capacity 0 stores nothing in memory
+    explicit ReferenceCache(std::size_t capacity_bytes = 0) : capacity_(capacity_bytes) {}
+
+    // Copies the output cached for key to dst. Returns false if there is none of size bytes, or
+    // when recomputing.
+    bool Load(const std::string& key, void* dst, std::size_t size);
+
+    void Store(const std::string& key, const void* src, std::size_t size);
+
+    // evicts outputs until the memory cache fits in the new capacity
+    void SetCapacity(std::size_t capacity_bytes);
+
+    std::size_t GetCapacity() const { return capacity_; }
+
+    // Outputs are also kept in the files of directory, created if needed, using up to
+    // capacity_bytes. An empty directory turns this off.
+    void SetDirectory(const std::string& directory, std::size_t capacity_bytes);
+
+    const std::string& GetDirectory() const { return directory_; }
+
+    // Load() misses, so every reference is computed again, and Store() replaces the cached
+    // outputs
+    void SetRecompute(bool recompute) { recompute_ = recompute; }
+
+    // outputs in memory
+    std::size_t Size() const { return entries_.size(); }
+
+    // bytes held by the outputs in memory
+    std::size_t GetBytes() const { return bytes_; }
+
+    // empties the memory cache, the directory is left as is
+    void Clear();
+
+    private:
+    void StoreMemory(const std::string& key, const void* src, std::size_t size);
+
+    void Evict(std::size_t capacity_bytes);
+
+    std::string GetPath(const std::string& key) const;
+
+    bool LoadFile(const std::string& key, void* dst, std::size_t size) const;
+
+    void StoreFile(const std::string& key, const void* src, std::size_t size) const;
+
+    // Removes the least recently used files, except skip_name, until the directory fits in its
+    // capacity with reserved_bytes to spare.
+    void EvictFiles(const std::string& skip_name, std::size_t reserved_bytes) const;
+
+    struct Entry
+    {
+        std::vector<std::byte> data_;
+        // position in lru_
+        std::list<std::string>::iterator lru_pos_;
+    };
+
+    std::size_t capacity_;
+    std::size_t bytes_ = 0;
+
+    std::unordered_map<std::string, Entry> entries_;
+    // most recently used first
+    std::list<std::string> lru_;
+
+    std::string directory_;
+    std::size_t directory_capacity_ = 0;
+
+    bool recompute_ = false;
+};
+
+// Cache shared by the profilers, tests and examples of a process. Its memory capacity is 0, the
+// directory is read from the environment:
+//   CK_REFERENCE_CACHE_DIR: directory of the cached outputs, off if not set,
+//   CK_REFERENCE_CACHE_SIZE: capacity of the directory in MiB (default: 8192),
+//   CK_REFERENCE_CACHE_RECOMPUTE: recompute every reference if set to a value other than 0.
+ReferenceCache& get_reference_cache();
+
+// "<make_perf_db_key()>|<element operations>|<init method>|<seed>". Element operations with
+// parameters, like a scale, need them in the name. The random inputs are keyed by the seed alone,
+// so they must be generated right after restart_random_streams().
+std::string make_reference_cache_key(const std::string& op,
+                                     const std::vector<std::string>& data_types,
+                                     const std::vector<std::string>& layouts,
+                                     const std::vector<int64_t>& problem,
+                                     const std::vector<std::string>& element_ops,
+                                     int init_method,
+                                     uint64_t seed);
+
+// Fills the host tensor out with the output cached for key in get_reference_cache(), or with
+// run_reference(), whose output is then cached.
+template <typename Tensor, typename F>
+void run_reference_cached(const std::string& key, Tensor& out, F&& run_reference)
+{
+    auto& cache = get_reference_cache();
+
+    const std::size_t size = out.mData.size() * sizeof(out.mData[0]);
+
+    if(cache.Load(key, out.mData.data(), size))
+    {
+        return;
+    }
+
+    run_reference();
+
+    cache.Store(key, out.mData.data(), size);
+}
+
+} // namespace utils
+} // namespace ck
@@ -0,0 +1,139 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace ck {
+namespace utils {
+
+// Host-side model of the Stream-K GEMM schedule of BlockToCTileMap_GemmStreamK, to choose its
+// number of Stream-K blocks without launching the kernel.
+//
+// The output tiles are split in data-parallel (DP) tiles, each computed by one workgroup, and
+// Stream-K (SK) tiles, whose K iterations are spread evenly over sk_num_blocks workgroups. Blocks
+// that end a tile they did not start leave a partial result, which is added atomically or, with
+// the reduction strategy, summed by one reduction workgroup per SK tile.
+//
+// The simulator builds the same partition as the tile map for a given sk_num_blocks and plays the
+// grid on num_cu CUs which each hold up to occupancy workgroups, dispatched in block index order.
+// The workgroups resident on a CU share its throughput evenly. Times are in units of one K
+// iteration of a tile, so the predictions are meant to compare the candidate splits of a problem,
+// not as absolute timings.
+struct StreamKProblem
+{
+    uint32_t M_;
+    uint32_t N_;
+    uint32_t K_;
+
+    uint32_t m_per_block_;
+    uint32_t n_per_block_;
+    uint32_t k_per_block_;
+
+    uint32_t num_cu_;
+    // workgroups a CU holds at the same time
+    uint32_t occupancy_;
+
+    // StreamKReductionStrategy::Reduction, otherwise the partial tiles are added atomically
+    bool reduction_ = false;
+};
+
+// cost of the steps of a workgroup, relative to one K iteration
+struct StreamKCostModel
+{
+    // storing a finished tile to C
+    double tile_store_time_ = 2;
+    // atomic add of a partial tile to C
+    double atomic_store_time_ = 4;
+    // storing a partial tile to the workspace
+    double partial_store_time_ = 2;
+    // loading one partial tile from the workspace in a reduction block
+    double partial_load_time_ = 2;
+};
+
+// Same fields as BlockToCTileMap_GemmStreamK. The blocks are laid out as
+// [0, sk_num_blocks_): SK blocks, the first sk_num_big_blocks_ of them run k_iters_per_big_block_
+//                      iterations, the others one less,
+// [sk_num_blocks_, dp_start_block_idx_): padding blocks, which return immediately,
+// [dp_start_block_idx_, reduction_start_block_idx_): DP blocks, one tile each,
+// [reduction_start_block_idx_, grid_size_): reduction blocks, one per SK tile.
+struct StreamKSchedule
+{
+    uint32_t num_tiles_;
+    uint32_t k_iters_per_tile_;
+
+    uint32_t sk_num_blocks_;
+    uint32_t sk_num_big_blocks_;
+    uint32_t k_iters_per_big_block_;
+    uint32_t sk_tiles_;
+
+    uint32_t dp_start_block_idx_;
+    uint32_t reduction_start_block_idx_;
+    uint32_t grid_size_;
+};
+
+// K iterations [iter_begin_, iter_end_) of a tile computed by one block
+struct StreamKTileWork
+{
+    uint32_t tile_idx_;
+    uint32_t iter_begin_;
+    uint32_t iter_end_;
+
+    bool operator==(const StreamKTileWork& rhs) const
+    {
+        return tile_idx_ == rhs.tile_idx_ && iter_begin_ == rhs.iter_begin_ &&
+               iter_end_ == rhs.iter_end_;
+    }
+};
+
+struct StreamKPrediction
+{
+    uint32_t sk_num_blocks_;
+
+    // end of the last block of each phase, 0 if the phase is empty
+    double sk_time_;
+    double dp_time_;
+    double reduction_time_;
+
+    double makespan_;
+};
+
+struct StreamKTuningResult
+{
+    // 0 (DP only) first, then the SK block counts of get_stream_k_sk_num_blocks_candidates()
+    std::vector<StreamKPrediction> candidates_;
+    // shortest makespan, the fewest SK blocks among equals
+    StreamKPrediction best_;
+};
+
+// Partition of the problem with sk_num_blocks SK blocks, the sk_blocks argument of the
+// BlockToCTileMap_GemmStreamK constructor. 0 makes every tile a DP tile.
+StreamKSchedule make_stream_k_schedule(const StreamKProblem& problem, uint32_t sk_num_blocks);
+
+// 0, then the range of SK block counts BlockToCTileMap_GemmStreamK searches for the problem,
+// including its upper end
+std::vector<uint32_t> get_stream_k_sk_num_blocks_candidates(const StreamKProblem& problem);
+
+// Global K iterations [begin, end) of a block, as returned by get_block_itr() of the tile map.
+// Empty for the padding and reduction blocks.
+std::pair<uint32_t, uint32_t> get_stream_k_block_iters(const StreamKSchedule& schedule,
+                                                        uint32_t block_idx);
+
+// tiles computed by a block, one tile at a time from its last iteration backwards
+std::vector<StreamKTileWork> get_stream_k_block_work(const StreamKSchedule& schedule,
+                                                     uint32_t block_idx);
+
+StreamKPrediction simulate_stream_k(const StreamKProblem& problem,
+                                    uint32_t sk_num_blocks,
+                                    const StreamKCostModel& cost = {});
+
+// Simulates every candidate. best_.sk_num_blocks_ is meant for the sk_blocks argument of the tile
+// map, or the NumSKBlocks argument of DeviceGemmXdlStreamK::MakeArgument().
+StreamKTuningResult tune_stream_k(const StreamKProblem& problem,
+                                  const StreamKCostModel& cost = {});
+
+} // namespace utils
+} // namespace ck
@@ -0,0 +1,342 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define CK_CONVERT_USE_F16C 1
+#else
+#define CK_CONVERT_USE_F16C 0
+#endif
+
+#include "ck/library/utility/convert.hpp"
+
+namespace ck {
+
+namespace {
+
+// large enough chunks to amortize the scheduling of the pool
+constexpr std::size_t Grain = std::size_t{1} << 16;
+
+template <typename F>
+void parallel_for_elements(std::size_t n, F&& f)
+{
+    ck::utils::host_parallel_for(n, std::forward<F>(f), 0, Grain);
+}
+
+template <typename T>
+using bits_t = std::conditional_t<sizeof(T) == 1, uint8_t, uint16_t>;
+
+template <typename Y>
+inline constexpr bool is_f8_v = std::is_same_v<Y, f8_t> || std::is_same_v<Y, bf8_t>;
+
+template <typename Y, typename X>
+Y convert_nearest_even(X x)
+{
+    if constexpr(is_f8_v<Y>)
+        return f8_convert_rne<Y>(x);
+    else if constexpr(std::is_same_v<Y, bhalf_t>)
+        return bf16_convert_rtn<Y>(x);
+    else
+        return type_convert<Y>(x);
+}
+
+// f8_convert_sr<Y>(x), with the random bits seeded by id
+template <typename Y, typename X>
+Y convert_stochastic(X x, index_t id)
+{
+    constexpr int seed               = 42;
+    constexpr bool negative_zero_nan = true;
+    constexpr bool clip              = true;
+    constexpr bool stoch             = true;
+
+    const uint32_t rng = prand_generator<X, seed>(id, x);
+
+    return utils::cast_to_f8<X, Y, negative_zero_nan, clip, stoch>(x, rng);
+}
+
+// the rounding of Default to fp8 and bf8
+ConvertRounding get_f8_rounding(ConvertRounding rounding)
+{
+    if(rounding != ConvertRounding::Default)
+        return rounding;
+
+#if CK_USE_SR_F8_CONVERSION
+    return ConvertRounding::Stochastic;
+#else
+    return ConvertRounding::NearestEven;
+#endif
+}
+
+// conversion of every value of the 8- or 16-bit type X, built on first use
+template <typename Y, typename X, ConvertRounding Rounding>
+const std::vector<Y>& get_table()
+{
+    static const std::vector<Y> table = [] {
+        std::vector<Y> values(std::size_t{1} << (8 * sizeof(X)));
+
+        for(std::size_t i = 0; i < values.size(); ++i)
+        {
+            const X x = bit_cast<X>(static_cast<bits_t<X>>(i));
+
+            if constexpr(Rounding == ConvertRounding::NearestEven)
+                values[i] = convert_nearest_even<Y>(x);
+            else
+                values[i] = type_convert<Y>(x);
+        }
+
+        return values;
+    }();
+
+    return table;
+}
+
+template <typename Y, typename X>
+void convert_with_table(const X* p_x, Y* p_y, std::size_t n, const std::vector<Y>& table)
+{
+    const Y* p_table = table.data();
+
+    parallel_for_elements(n, [&](std::size_t begin, std::size_t end) {
+        for(std::size_t i = begin; i < end; ++i)
+            p_y[i] = p_table[bit_cast<bits_t<X>>(p_x[i])];
+    });
+}
+
+template <typename Y, typename X>
+void convert_stochastic_n(const X* p_x, Y* p_y, std::size_t n)
+{
+    parallel_for_elements(n, [&](std::size_t begin, std::size_t end) {
+        for(std::size_t i = begin; i < end; ++i)
+            p_y[i] = convert_stochastic<Y>(p_x[i], static_cast<index_t>(i));
+    });
+}
+
+// Rounding to nearest even of the floats with the same upper 16 bits: sign, exponent and upper 7
+// mantissa bits. The midpoints between fp8 or between bf8 values have at most 4 significant bits,
+// so only the first float of such a range, with lower bits 0, may be a midpoint, and all the
+// others round to the same value.
+template <typename Y>
+struct F8RoundingEntry
+{
+    Y first_;
+    Y rest_;
+    // false if the scalar conversion does not round the range that way, its floats are then
+    // converted one by one
+    bool exact_;
+};
+
+template <typename Y>
+const std::vector<F8RoundingEntry<Y>>& get_f8_rounding_table()
+{
+    static const std::vector<F8RoundingEntry<Y>> table = [] {
+        std::vector<F8RoundingEntry<Y>> entries(std::size_t{1} << 16);
+
+        for(uint32_t upper = 0; upper < entries.size(); ++upper)
+        {
+            auto convert = [&](uint32_t lower) {
+                return f8_convert_rne<Y>(bit_cast<float>((upper << 16) | lower));
+            };
+
+            const Y rest = convert(1);
+
+            entries[upper] = {convert(0), rest, convert(0xFFFF) == rest};
+        }
+
+        return entries;
+    }();
+
+    return table;
+}
+
+template <typename Y>
+void convert_float_to_f8(const float* p_x, Y* p_y, std::size_t n, ConvertRounding rounding)
+{
+    if(get_f8_rounding(rounding) == ConvertRounding::Stochastic)
+    {
+        convert_stochastic_n(p_x, p_y, n);
+        return;
+    }
+
+    const F8RoundingEntry<Y>* p_table = get_f8_rounding_table<Y>().data();
+
+    parallel_for_elements(n, [&](std::size_t begin, std::size_t end) {
+        for(std::size_t i = begin; i < end; ++i)
+        {
+            const uint32_t bits = bit_cast<uint32_t>(p_x[i]);
+            const auto& entry   = p_table[bits >> 16];
+
+            if((bits & 0xFFFF) == 0)
+                p_y[i] = entry.first_;
+            else if(entry.exact_)
+                p_y[i] = entry.rest_;
+            else
+                p_y[i] = f8_convert_rne<Y>(p_x[i]);
+        }
+    });
+}
+
+template <typename Y>
+void convert_half_to_f8(const half_t* p_x, Y* p_y, std::size_t n, ConvertRounding rounding)
+{
+    if(get_f8_rounding(rounding) == ConvertRounding::Stochastic)
+        convert_stochastic_n(p_x, p_y, n);
+    else
+        convert_with_table(p_x, p_y, n, get_table<Y, half_t, ConvertRounding::NearestEven>());
+}
+
+#if CK_CONVERT_USE_F16C
+bool has_f16c()
+{
+    static const bool f16c = __builtin_cpu_supports("f16c") && __builtin_cpu_supports("avx");
+
+    return f16c;
+}
+
+// vcvtps2ph rounds to nearest even as the scalar conversion
+__attribute__((target("avx,f16c"))) void
+convert_float_to_half_f16c(const float* p_x, half_t* p_y, std::size_t begin, std::size_t end)
+{
+    std::size_t i = begin;
+
+    for(; i + 8 <= end; i += 8)
+    {
+        const __m128i y = _mm256_cvtps_ph(_mm256_loadu_ps(p_x + i), _MM_FROUND_TO_NEAREST_INT);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p_y + i), y);
+    }
+
+    for(; i < end; ++i)
+        p_y[i] = type_convert<half_t>(p_x[i]);
+}
+#endif
+
+} // namespace
+
+template <>
+void convert_n<float, half_t>(const half_t* p_x, float* p_y, std::size_t n, ConvertRounding)
+{
+    convert_with_table(p_x, p_y, n, get_table<float, half_t, ConvertRounding::Default>());
+}
+
+template <>
+void convert_n<float, bhalf_t>(const bhalf_t* p_x, float* p_y, std::size_t n, ConvertRounding)
+{
+    parallel_for_elements(n, [&](std::size_t begin, std::size_t end) {
+        for(std::size_t i = begin; i < end; ++i)
+            p_y[i] = type_convert<float>(p_x[i]);
+    });
+}
+
+template <>
+void convert_n<float, f8_t>(const f8_t* p_x, float* p_y, std::size_t n, ConvertRounding)
+{
+    convert_with_table(p_x, p_y, n, get_table<float, f8_t, ConvertRounding::Default>());
+}
+
+template <>
+void convert_n<float, bf8_t>(const bf8_t* p_x, float* p_y, std::size_t n, ConvertRounding)
+{
+    convert_with_table(p_x, p_y, n, get_table<float, bf8_t, ConvertRounding::Default>());
+}
+
+template <>
+void convert_n<half_t, float>(const float* p_x, half_t* p_y, std::size_t n, ConvertRounding)
+{
+    parallel_for_elements(n, [&](std::size_t begin, std::size_t end) {
+#if CK_CONVERT_USE_F16C
+        if(has_f16c())
+        {
+            convert_float_to_half_f16c(p_x, p_y, begin, end);
+            return;
+        }
+#endif
+        for(std::size_t i = begin; i < end; ++i)
+            p_y[i] = type_convert<half_t>(p_x[i]);
+    });
+}
+
+template <>
+void convert_n<half_t, bhalf_t>(const bhalf_t* p_x, half_t* p_y, std::size_t n, ConvertRounding)
+{
+    convert_with_table(p_x, p_y, n, get_table<half_t, bhalf_t, ConvertRounding::Default>());
+}
+
+template <>
+void convert_n<half_t, f8_t>(const f8_t* p_x, half_t* p_y, std::size_t n, ConvertRounding)
+{
+    convert_with_table(p_x, p_y, n, get_table<half_t, f8_t, ConvertRounding::Default>());
+}
+
+template <>
+void convert_n<half_t, bf8_t>(const bf8_t* p_x, half_t* p_y, std::size_t n, ConvertRounding)
+{
+    convert_with_table(p_x, p_y, n, get_table<half_t, bf8_t, ConvertRounding::Default>());
+}
+
+template <>
+void convert_n<bhalf_t, float>(const float* p_x,
+                               bhalf_t* p_y,
+                               std::size_t n,
+                               ConvertRounding rounding)
+{
+    const bool nearest_even = rounding != ConvertRounding::Default;
+
+    parallel_for_elements(n, [&](std::size_t begin, std::size_t end) {
+        if(nearest_even)
+        {
+            for(std::size_t i = begin; i < end; ++i)
+                p_y[i] = bf16_convert_rtn<bhalf_t>(p_x[i]);
+        }
+        else
+        {
+            for(std::size_t i = begin; i < end; ++i)
+                p_y[i] = type_convert<bhalf_t>(p_x[i]);
+        }
+    });
+}
+
+template <>
+void convert_n<bhalf_t, half_t>(const half_t* p_x,
+                                bhalf_t* p_y,
+                                std::size_t n,
+                                ConvertRounding rounding)
+{
+    if(rounding != ConvertRounding::Default)
+        convert_with_table(
+            p_x, p_y, n, get_table<bhalf_t, half_t, ConvertRounding::NearestEven>());
+    else
+        convert_with_table(p_x, p_y, n, get_table<bhalf_t, half_t, ConvertRounding::Default>());
+}
+
+template <>
+void convert_n<f8_t, float>(const float* p_x, f8_t* p_y, std::size_t n, ConvertRounding rounding)
+{
+    convert_float_to_f8(p_x, p_y, n, rounding);
+}
+
+template <>
+void convert_n<f8_t, half_t>(const half_t* p_x, f8_t* p_y, std::size_t n, ConvertRounding rounding)
+{
+    convert_half_to_f8(p_x, p_y, n, rounding);
+}
+
+template <>
+void convert_n<bf8_t, float>(const float* p_x, bf8_t* p_y, std::size_t n, ConvertRounding rounding)
+{
+    convert_float_to_f8(p_x, p_y, n, rounding);
+}
+
+template <>
+void convert_n<bf8_t, half_t>(const half_t* p_x,
+                              bf8_t* p_y,
+                              std::size_t n,
+                              ConvertRounding rounding)
+{
+    convert_half_to_f8(p_x, p_y, n, rounding);
+}
+
+} // namespace ck
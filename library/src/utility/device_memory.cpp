@@ -1,23 +1,126 @@
 // SPDX-License-Identifier: MIT
 // Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
 
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
 #include "ck/host_utility/hip_check_error.hpp"
 
 #include "ck/library/utility/device_memory.hpp"
 
+namespace {
+
+struct DeviceMemCache
+{
+    std::mutex mutex_;
+    bool enabled_ = false;
+
+    // buffers not in use, by capacity
+    std::multimap<std::size_t, void*> free_buffers_;
+    // capacity of the buffers allocated while the cache is enabled
+    std::unordered_map<void*, std::size_t> capacities_;
+
+    // the caller holds mutex_
+    void Release()
+    {
+        for(auto& [capacity, p] : free_buffers_)
+        {
+            capacities_.erase(p);
+            hip_check_error(hipFree(p));
+        }
+
+        free_buffers_.clear();
+    }
+};
+
+// never destroyed, the HIP runtime may be gone at exit
+DeviceMemCache& get_device_mem_cache()
+{
+    static auto* cache = new DeviceMemCache;
+    return *cache;
+}
+
+void* allocate_device_buffer(std::size_t size)
+{
+    auto& cache = get_device_mem_cache();
+
+    std::lock_guard<std::mutex> lock(cache.mutex_);
+
+    if(cache.enabled_)
+    {
+        const auto found = cache.free_buffers_.lower_bound(size);
+
+        if(found != cache.free_buffers_.end() && found->first / 2 <= size)
+        {
+            void* p = found->second;
+            cache.free_buffers_.erase(found);
+
+            // unlike hipFree, returning a buffer to the cache does not wait for the kernels still
+            // using it, which may run on any stream
+            hip_check_error(hipDeviceSynchronize());
+
+            return p;
+        }
+    }
+
+    void* p = nullptr;
+
+    // the buffers kept by the cache may be what the allocation is missing
+    if(hipMalloc(&p, size) != hipSuccess)
+    {
+        (void)hipGetLastError();
+
+        cache.Release();
+        hip_check_error(hipMalloc(&p, size));
+    }
+
+    if(cache.enabled_ && p != nullptr)
+    {
+        cache.capacities_[p] = size;
+    }
+
+    return p;
+}
+
+void free_device_buffer(void* p)
+{
+    auto& cache = get_device_mem_cache();
+
+    std::lock_guard<std::mutex> lock(cache.mutex_);
+
+    const auto found = cache.capacities_.find(p);
+
+    if(found == cache.capacities_.end())
+    {
+        hip_check_error(hipFree(p));
+    }
+    else if(cache.enabled_)
+    {
+        cache.free_buffers_.emplace(found->second, p);
+    }
+    else
+    {
+        cache.capacities_.erase(found);
+        hip_check_error(hipFree(p));
+    }
+}
+
+} // namespace
+
 DeviceMem::DeviceMem(std::size_t mem_size) : mMemSize(mem_size)
 {
-    hip_check_error(hipMalloc(static_cast<void**>(&mpDeviceBuf), mMemSize));
+    mpDeviceBuf = allocate_device_buffer(mMemSize);
 }
 
 void DeviceMem::Realloc(std::size_t mem_size)
 {
     if(mpDeviceBuf)
     {
-        hip_check_error(hipFree(mpDeviceBuf));
+        free_device_buffer(mpDeviceBuf);
     }
-    mMemSize = mem_size;
-    hip_check_error(hipMalloc(static_cast<void**>(&mpDeviceBuf), mMemSize));
+    mMemSize    = mem_size;
+    mpDeviceBuf = allocate_device_buffer(mMemSize);
 }
 
 void* DeviceMem::GetDeviceBuffer() const { return mpDeviceBuf; }
@@ -71,6 +174,20 @@ DeviceMem::~DeviceMem()
 {
     if(mpDeviceBuf)
     {
-        hip_check_error(hipFree(mpDeviceBuf));
+        free_device_buffer(mpDeviceBuf);
+    }
+}
+
+void DeviceMem::EnableCache(bool enable)
+{
+    auto& cache = get_device_mem_cache();
+
+    std::lock_guard<std::mutex> lock(cache.mutex_);
+
+    cache.enabled_ = enable;
+
+    if(!enable)
+    {
+        cache.Release();
     }
 }
@@ -0,0 +1,58 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <atomic>
+#include <cstdlib>
+#include <string>
+
+#include "ck/library/utility/host_random.hpp"
+
+namespace ck {
+namespace utils {
+
+namespace {
+
+uint64_t get_default_random_seed()
+{
+    if(const char* env = std::getenv("CK_RANDOM_SEED"))
+    {
+        try
+        {
+            return std::stoull(env);
+        }
+        catch(...)
+        {
+        }
+    }
+
+    return 11939;
+}
+
+std::atomic<uint64_t> host_random_seed{get_default_random_seed()};
+std::atomic<uint64_t> num_random_stream{0};
+
+} // namespace
+
+uint64_t get_host_random_seed() { return host_random_seed.load(); }
+
+void set_host_random_seed(uint64_t seed)
+{
+    host_random_seed.store(seed);
+    num_random_stream.store(0);
+}
+
+void restart_random_streams() { num_random_stream.store(0); }
+
+uint64_t make_random_seed()
+{
+    const uint64_t stream = num_random_stream.fetch_add(1);
+
+    const auto u = Philox4x32::Generate(
+        {static_cast<uint32_t>(stream), static_cast<uint32_t>(stream >> 32), 0, 0},
+        Philox4x32::MakeKey(host_random_seed.load()));
+
+    return (uint64_t{u[1]} << 32) | u[0];
+}
+
+} // namespace utils
+} // namespace ck
@@ -39,6 +39,21 @@ std::size_t HostTensorDescriptor::GetElementSpaceSize() const
     return space;
 }
 
+bool HostTensorDescriptor::IsPacked() const
+{
+    assert(mLens.size() == mStrides.size());
+
+    std::size_t stride = 1;
+    for(std::size_t i = mLens.size(); i-- > 0;)
+    {
+        if(mLens[i] > 1 && mStrides[i] != stride)
+            return false;
+
+        stride *= mLens[i];
+    }
+    return true;
+}
+
 const std::vector<std::size_t>& HostTensorDescriptor::GetLengths() const { return mLens; }
 
 const std::vector<std::size_t>& HostTensorDescriptor::GetStrides() const { return mStrides; }
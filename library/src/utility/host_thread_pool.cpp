@@ -0,0 +1,287 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+
+#include "ck/library/utility/host_thread_pool.hpp"
+
+namespace ck {
+namespace utils {
+
+namespace {
+
+// true on pool workers, and on the calling thread while it takes part in a parallel loop
+thread_local bool tl_in_parallel_region = false;
+
+// each participant starts with this many chunks, the surplus feeds work stealing
+constexpr std::size_t ChunksPerParticipant = 16;
+
+std::size_t get_default_num_threads()
+{
+    if(const char* env = std::getenv("CK_HOST_NUM_THREADS"))
+    {
+        try
+        {
+            const long long num_thread = std::stoll(env);
+            if(num_thread > 0)
+                return static_cast<std::size_t>(num_thread);
+        }
+        catch(...)
+        {
+        }
+    }
+
+    return std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+constexpr uint64_t pack_range(uint64_t front, uint64_t back) { return (back << 32) | front; }
+
+constexpr uint64_t range_front(uint64_t range) { return range & 0xffffffffu; }
+
+constexpr uint64_t range_back(uint64_t range) { return range >> 32; }
+
+} // namespace
+
+HostThreadPool& HostThreadPool::GetInstance()
+{
+    static HostThreadPool pool;
+    return pool;
+}
+
+HostThreadPool::HostThreadPool() { StartWorkers(get_default_num_threads()); }
+
+HostThreadPool::~HostThreadPool() { StopWorkers(); }
+
+std::size_t HostThreadPool::GetNumThreads() const
+{
+    return num_threads_.load(std::memory_order_relaxed);
+}
+
+void HostThreadPool::SetNumThreads(std::size_t num_thread)
+{
+    // the loop running this task holds run_mutex_ until the task returns
+    if(tl_in_parallel_region)
+        throw std::logic_error("HostThreadPool::SetNumThreads() called from a pool task");
+
+    std::lock_guard<std::mutex> run_lock(run_mutex_);
+
+    num_thread = std::max<std::size_t>(num_thread, 1);
+
+    if(num_thread == GetNumThreads())
+        return;
+
+    StopWorkers();
+    StartWorkers(num_thread);
+}
+
+void HostThreadPool::StartWorkers(std::size_t num_thread)
+{
+    stop_   = false;
+    ranges_ = std::make_unique<ChunkRange[]>(num_thread);
+
+    // no job is in flight here, so the workers start from the current generation
+    workers_.reserve(num_thread - 1);
+    for(std::size_t i = 1; i < num_thread; ++i)
+        workers_.emplace_back([this, i, generation = generation_] { WorkerLoop(i, generation); });
+
+    num_threads_.store(num_thread, std::memory_order_relaxed);
+}
+
+void HostThreadPool::StopWorkers()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    job_cv_.notify_all();
+
+    for(auto& worker : workers_)
+        worker.join();
+
+    workers_.clear();
+
+    num_threads_.store(1, std::memory_order_relaxed);
+}
+
+void HostThreadPool::Run(
+    std::size_t n, std::size_t grain, std::size_t max_thread, Task task, const void* p_f)
+{
+    if(n == 0)
+        return;
+
+    std::size_t num_participants = GetNumThreads();
+    if(max_thread > 0)
+        num_participants = std::min(num_participants, max_thread);
+
+    if(num_participants <= 1 || tl_in_parallel_region)
+    {
+        task(p_f, 0, n);
+        return;
+    }
+
+    // chunk indices are stored in 32 bits
+    const std::size_t min_chunk_size = (n >> 31) + 1;
+
+    const std::size_t num_initial_chunks = num_participants * ChunksPerParticipant;
+    const std::size_t auto_grain         = (n + num_initial_chunks - 1) / num_initial_chunks;
+
+    const std::size_t chunk_size = std::max({grain, auto_grain, min_chunk_size});
+    const std::size_t num_chunks = (n + chunk_size - 1) / chunk_size;
+
+    // not worth waking up the workers
+    if(num_chunks == 1)
+    {
+        task(p_f, 0, n);
+        return;
+    }
+
+    std::lock_guard<std::mutex> run_lock(run_mutex_);
+
+    // the pool may have been resized since the size was read above
+    num_participants = std::min({num_participants, num_chunks, GetNumThreads()});
+
+    for(std::size_t p = 0; p < num_participants; ++p)
+    {
+        const uint64_t front = p * num_chunks / num_participants;
+        const uint64_t back  = (p + 1) * num_chunks / num_participants;
+
+        ranges_[p].range.store(pack_range(front, back), std::memory_order_relaxed);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        task_             = task;
+        p_f_              = p_f;
+        n_                = n;
+        chunk_size_       = chunk_size;
+        num_participants_ = num_participants;
+        num_busy_         = num_participants - 1;
+        exception_        = nullptr;
+
+        ++generation_;
+    }
+    job_cv_.notify_all();
+
+    tl_in_parallel_region = true;
+    Execute(0);
+    tl_in_parallel_region = false;
+
+    std::exception_ptr exception;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [this] { return num_busy_ == 0; });
+
+        exception = exception_;
+    }
+
+    if(exception)
+        std::rethrow_exception(exception);
+}
+
+void HostThreadPool::WorkerLoop(std::size_t worker_id, uint64_t seen_generation)
+{
+    tl_in_parallel_region = true;
+
+    while(true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            job_cv_.wait(lock, [&] { return stop_ || generation_ != seen_generation; });
+
+            if(stop_)
+                return;
+
+            seen_generation = generation_;
+
+            if(worker_id >= num_participants_)
+                continue;
+        }
+
+        Execute(worker_id);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if(--num_busy_ == 0)
+                done_cv_.notify_one();
+        }
+    }
+}
+
+void HostThreadPool::Execute(std::size_t participant_id)
+{
+    auto run_chunk = [&](std::size_t chunk) {
+        const std::size_t begin = chunk * chunk_size_;
+        const std::size_t end   = std::min(begin + chunk_size_, n_);
+
+        try
+        {
+            task_(p_f_, begin, end);
+        }
+        catch(...)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if(!exception_)
+                exception_ = std::current_exception();
+        }
+    };
+
+    std::size_t chunk;
+
+    while(PopFront(participant_id, chunk))
+        run_chunk(chunk);
+
+    for(std::size_t i = 1; i < num_participants_; ++i)
+    {
+        const std::size_t victim = (participant_id + i) % num_participants_;
+
+        while(StealBack(victim, chunk))
+            run_chunk(chunk);
+    }
+}
+
+bool HostThreadPool::PopFront(std::size_t participant_id, std::size_t& chunk)
+{
+    auto& range = ranges_[participant_id].range;
+
+    uint64_t old_range = range.load(std::memory_order_relaxed);
+
+    while(range_front(old_range) < range_back(old_range))
+    {
+        const uint64_t new_range = pack_range(range_front(old_range) + 1, range_back(old_range));
+
+        if(range.compare_exchange_weak(old_range, new_range, std::memory_order_acq_rel))
+        {
+            chunk = range_front(old_range);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool HostThreadPool::StealBack(std::size_t participant_id, std::size_t& chunk)
+{
+    auto& range = ranges_[participant_id].range;
+
+    uint64_t old_range = range.load(std::memory_order_relaxed);
+
+    while(range_front(old_range) < range_back(old_range))
+    {
+        const uint64_t new_range = pack_range(range_front(old_range), range_back(old_range) - 1);
+
+        if(range.compare_exchange_weak(old_range, new_range, std::memory_order_acq_rel))
+        {
+            chunk = range_back(old_range) - 1;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+} // namespace utils
+} // namespace ck
@@ -0,0 +1,199 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cmath>
+#include <cstdint>
+#include <string>
+
+#include "ck/library/utility/instance_cost_model.hpp"
+
+namespace ck {
+namespace utils {
+
+namespace {
+
+std::size_t ceil_div(std::size_t a, std::size_t b) { return (a + b - 1) / b; }
+
+// share of the bandwidth reached by vector accesses of scalar_per_vector elements, full from 16
+// bytes on
+double get_vector_access_efficiency(std::size_t scalar_per_vector, std::size_t bytes)
+{
+    if(scalar_per_vector == 0)
+        return 1;
+
+    return std::min(1.0, static_cast<double>(scalar_per_vector * bytes) / 16);
+}
+
+// rank of every value of x, starting from 1, ties get their average rank
+std::vector<double> get_ranks(const std::vector<double>& x)
+{
+    std::vector<std::size_t> order(x.size());
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::sort(order.begin(), order.end(), [&](auto lhs, auto rhs) { return x[lhs] < x[rhs]; });
+
+    std::vector<double> ranks(x.size());
+
+    for(std::size_t begin = 0; begin < order.size();)
+    {
+        std::size_t end = begin + 1;
+
+        while(end < order.size() && x[order[end]] == x[order[begin]])
+            ++end;
+
+        for(std::size_t i = begin; i < end; ++i)
+            ranks[order[i]] = static_cast<double>(begin + end + 1) / 2;
+
+        begin = end;
+    }
+
+    return ranks;
+}
+
+} // namespace
+
+std::optional<GemmTileConfig>
+get_gemm_tile_config(const ck::tensor_operation::device::DeviceOperatorDescriptor& desc)
+{
+    auto get = [&](const char* key) -> std::size_t {
+        const auto* value = desc.Get<int64_t>(key);
+        return value == nullptr || *value < 0 ? 0 : static_cast<std::size_t>(*value);
+    };
+
+    GemmTileConfig config{};
+
+    config.block_size_  = get("BlockSize");
+    config.m_per_block_ = get("MPerBlock");
+    config.n_per_block_ = get("NPerBlock");
+    config.k_per_block_ = desc.Find("KPerBlock") ? get("KPerBlock") : get("K0PerBlock") * get("K1");
+
+    if(config.block_size_ == 0 || config.m_per_block_ == 0 || config.n_per_block_ == 0 ||
+       config.k_per_block_ == 0)
+        return std::nullopt;
+
+    // "MNKPadding" pads M, N and K, "Default" none of them
+    const auto* spec = desc.Get<std::string>("GemmSpec");
+    const auto pos   = spec == nullptr ? std::string::npos : spec->rfind("Padding");
+    const std::string padded_dims = pos == std::string::npos ? "" : spec->substr(0, pos);
+
+    config.pad_m_ = padded_dims.find('M') != std::string::npos;
+    config.pad_n_ = padded_dims.find('N') != std::string::npos;
+    config.pad_k_ = padded_dims.find('K') != std::string::npos;
+
+    config.a_scalar_per_vector_ = get("ABlockTransferSrcScalarPerVector");
+    config.b_scalar_per_vector_ = get("BBlockTransferSrcScalarPerVector");
+
+    return config;
+}
+
+std::optional<double> estimate_gemm_time(const GemmTileConfig& config,
+                                         const GemmCostModelProblem& problem,
+                                         const GemmCostModelDevice& device)
+{
+    const std::size_t m_per_block = config.m_per_block_;
+    const std::size_t n_per_block = config.n_per_block_;
+    const std::size_t k_per_block = config.k_per_block_;
+
+    if((!config.pad_m_ && problem.M_ % m_per_block != 0) ||
+       (!config.pad_n_ && problem.N_ % n_per_block != 0) ||
+       (!config.pad_k_ && problem.K_ % k_per_block != 0))
+        return std::nullopt;
+
+    const std::size_t num_tile = ceil_div(problem.M_, m_per_block) *
+                                 ceil_div(problem.N_, n_per_block) * problem.batch_;
+    const double k_length = static_cast<double>(ceil_div(problem.K_, k_per_block) * k_per_block);
+
+    if(num_tile == 0)
+        return 0.0;
+
+    // workgroups per CU, limited by the LDS holding one A and one B tile, and by the threads
+    const std::size_t lds_bytes =
+        (m_per_block * problem.a_bytes_ + n_per_block * problem.b_bytes_) * k_per_block;
+
+    const std::size_t max_blocks_per_cu = std::max<std::size_t>(
+        std::min(device.lds_bytes_per_cu_ / std::max<std::size_t>(lds_bytes, 1),
+                 device.max_threads_per_cu_ / config.block_size_),
+        1);
+
+    const std::size_t blocks_per_cu =
+        std::min(max_blocks_per_cu, ceil_div(num_tile, device.num_cu_));
+    const std::size_t num_wave = ceil_div(num_tile, device.num_cu_ * blocks_per_cu);
+
+    // MFMA latency is hidden from two waves per SIMD on
+    const double waves_per_simd = static_cast<double>(blocks_per_cu * config.block_size_) /
+                                  (device.wave_size_ * device.num_simd_per_cu_);
+    const double mfma_efficiency = std::min(1.0, waves_per_simd / 2);
+
+    const double compute_cycles = 2.0 * m_per_block * n_per_block * k_length /
+                                  (device.flops_per_cu_per_cycle_ * mfma_efficiency);
+
+    const double load_bytes =
+        (m_per_block * problem.a_bytes_ /
+             get_vector_access_efficiency(config.a_scalar_per_vector_, problem.a_bytes_) +
+         n_per_block * problem.b_bytes_ /
+             get_vector_access_efficiency(config.b_scalar_per_vector_, problem.b_bytes_)) *
+        k_length;
+
+    const double load_cycles  = load_bytes / device.bytes_per_cu_per_cycle_;
+    const double store_cycles = static_cast<double>(m_per_block * n_per_block * problem.c_bytes_) /
+                                device.bytes_per_cu_per_cycle_;
+
+    // the resident workgroups of a wave share the CU
+    const double cycles =
+        num_wave * blocks_per_cu * (std::max(compute_cycles, load_cycles) + store_cycles);
+
+    return cycles / (device.clock_ghz_ * 1.E6);
+}
+
+GemmCostModelProblem make_gemm_cost_model_problem(const ck::utils::conv::ConvParam& param)
+{
+    const auto output_spatial_lengths = param.GetOutputSpatialLengths();
+
+    std::size_t num_output_pixel = 1;
+    std::size_t num_filter_tap   = 1;
+
+    for(ck::index_t d = 0; d < param.num_dim_spatial_; ++d)
+    {
+        num_output_pixel *= static_cast<std::size_t>(output_spatial_lengths[d]);
+        num_filter_tap *= static_cast<std::size_t>(param.filter_spatial_lengths_[d]);
+    }
+
+    GemmCostModelProblem problem{};
+
+    problem.M_     = static_cast<std::size_t>(param.N_) * num_output_pixel;
+    problem.N_     = static_cast<std::size_t>(param.K_);
+    problem.K_     = static_cast<std::size_t>(param.C_) * num_filter_tap;
+    problem.batch_ = static_cast<std::size_t>(param.G_);
+
+    return problem;
+}
+
+double get_rank_correlation(const std::vector<double>& x, const std::vector<double>& y)
+{
+    const std::size_t n = std::min(x.size(), y.size());
+
+    if(n < 2)
+        return 0;
+
+    const auto rank_x = get_ranks(std::vector<double>(x.begin(), x.begin() + n));
+    const auto rank_y = get_ranks(std::vector<double>(y.begin(), y.begin() + n));
+
+    // Pearson correlation of the ranks
+    const double mean = static_cast<double>(n + 1) / 2;
+
+    double cov = 0, var_x = 0, var_y = 0;
+
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        cov += (rank_x[i] - mean) * (rank_y[i] - mean);
+        var_x += (rank_x[i] - mean) * (rank_x[i] - mean);
+        var_y += (rank_y[i] - mean) * (rank_y[i] - mean);
+    }
+
+    if(var_x == 0 || var_y == 0)
+        return 0;
+
+    return cov / std::sqrt(var_x * var_y);
+}
+
+} // namespace utils
+} // namespace ck
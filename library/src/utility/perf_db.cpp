@@ -0,0 +1,162 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#include "ck/library/utility/perf_db.hpp"
+
+namespace ck {
+namespace utils {
+
+namespace {
+
+constexpr char FieldSeparator = '\t';
+
+std::vector<std::string> split_fields(const std::string& line)
+{
+    std::vector<std::string> fields;
+    std::istringstream stream(line);
+
+    for(std::string field; std::getline(stream, field, FieldSeparator);)
+        fields.push_back(field);
+
+    return fields;
+}
+
+template <typename T>
+std::string join(const std::vector<T>& values)
+{
+    std::ostringstream stream;
+
+    for(std::size_t i = 0; i < values.size(); ++i)
+        stream << (i > 0 ? "," : "") << values[i];
+
+    return stream.str();
+}
+
+} // namespace
+
+PerfDb::PerfDb(const std::string& path) { Load(path); }
+
+bool PerfDb::Load(const std::string& path)
+{
+    std::ifstream file(path);
+
+    if(!file)
+        return false;
+
+    std::size_t line_number = 0;
+
+    for(std::string line; std::getline(file, line);)
+    {
+        ++line_number;
+
+        if(line.empty() || line[0] == '#')
+            continue;
+
+        const auto fields = split_fields(line);
+
+        if(fields.size() != 6)
+            throw std::runtime_error("wrong! invalid perf-db record at " + path + ":" +
+                                     std::to_string(line_number));
+
+        try
+        {
+            Record(fields[0],
+                   PerfDbEntry{std::stoull(fields[1]),
+                               fields[2],
+                               std::stof(fields[3]),
+                               std::stof(fields[4]),
+                               std::stof(fields[5])});
+        }
+        catch(const std::logic_error&)
+        {
+            throw std::runtime_error("wrong! invalid perf-db record at " + path + ":" +
+                                     std::to_string(line_number));
+        }
+    }
+
+    return true;
+}
+
+bool PerfDb::Save(const std::string& path) const
+{
+    std::vector<const std::pair<const std::string, PerfDbEntry>*> records;
+    records.reserve(entries_.size());
+
+    for(const auto& record : entries_)
+        records.push_back(&record);
+
+    std::sort(records.begin(), records.end(), [](auto lhs, auto rhs) {
+        return lhs->first < rhs->first;
+    });
+
+    const std::string tmp_path = path + ".tmp";
+
+    {
+        std::ofstream file(tmp_path, std::ios::trunc);
+
+        if(!file)
+            return false;
+
+        file << "# key\tinstance id\tinstance name\tave_time [ms]\ttflops\tGB/s\n";
+
+        for(const auto* record : records)
+        {
+            const auto& entry = record->second;
+
+            file << record->first << FieldSeparator << entry.instance_id_ << FieldSeparator
+                 << entry.instance_name_ << FieldSeparator << entry.ave_time_ << FieldSeparator
+                 << entry.tflops_ << FieldSeparator << entry.gb_per_sec_ << '\n';
+        }
+
+        if(!file.flush())
+            return false;
+    }
+
+    return std::rename(tmp_path.c_str(), path.c_str()) == 0;
+}
+
+const PerfDbEntry* PerfDb::Find(const std::string& key) const
+{
+    const auto it = entries_.find(key);
+
+    return it == entries_.end() ? nullptr : &it->second;
+}
+
+bool PerfDb::Record(const std::string& key, const PerfDbEntry& entry)
+{
+    const auto [it, inserted] = entries_.emplace(key, entry);
+
+    if(inserted)
+        return true;
+
+    if(entry.ave_time_ < it->second.ave_time_)
+    {
+        it->second = entry;
+        return true;
+    }
+
+    return false;
+}
+
+void PerfDb::Merge(const PerfDb& other)
+{
+    for(const auto& [key, entry] : other.entries_)
+        Record(key, entry);
+}
+
+std::string make_perf_db_key(const std::string& op,
+                             const std::vector<std::string>& data_types,
+                             const std::vector<std::string>& layouts,
+                             const std::vector<int64_t>& problem)
+{
+    return op + "|" + join(data_types) + "|" + join(layouts) + "|" + join(problem);
+}
+
+} // namespace utils
+} // namespace ck
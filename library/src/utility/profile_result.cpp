@@ -0,0 +1,856 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "ck/library/utility/perf_db.hpp"
+#include "ck/library/utility/profile_result.hpp"
+
+namespace ck {
+namespace utils {
+
+namespace {
+
+using ck::tensor_operation::device::DeviceOperatorDescriptor;
+
+constexpr int NumberPrecision = 9;
+
+// an argument as the profilers parse it with std::stoi/std::stof: integers in full, without an
+// exponent, and other numbers with all their digits
+std::string format_problem_arg(double value)
+{
+    if(value == std::floor(value) && std::abs(value) < 9e18)
+        return std::to_string(std::llround(value));
+
+    std::ostringstream arg;
+    arg << std::setprecision(std::numeric_limits<double>::max_digits10) << value;
+
+    return arg.str();
+}
+
+const char* get_verification_name(VerificationStatus status)
+{
+    switch(status)
+    {
+    case VerificationStatus::Pass: return "pass";
+    case VerificationStatus::Fail: return "fail";
+    default: return "not_run";
+    }
+}
+
+VerificationStatus get_verification_status(const std::string& name)
+{
+    if(name == "pass")
+        return VerificationStatus::Pass;
+    if(name == "fail")
+        return VerificationStatus::Fail;
+    if(name == "not_run")
+        return VerificationStatus::NotRun;
+
+    throw std::invalid_argument("unknown verification status " + name);
+}
+
+bool is_csv_path(const std::string& path)
+{
+    return path.size() >= 4 && path.compare(path.size() - 4, 4, ".csv") == 0;
+}
+
+std::string to_hex(uint64_t value)
+{
+    std::ostringstream stream;
+    stream << "0x" << std::hex << std::setw(16) << std::setfill('0') << value;
+    return stream.str();
+}
+
+// percentile p in [0, 1] of sorted samples, interpolated between the closest ones
+double get_percentile(const std::vector<double>& sorted, double p)
+{
+    const double pos   = p * static_cast<double>(sorted.size() - 1);
+    const auto lower   = static_cast<std::size_t>(pos);
+    const auto upper   = std::min(lower + 1, sorted.size() - 1);
+    const double alpha = pos - static_cast<double>(lower);
+
+    return sorted[lower] * (1 - alpha) + sorted[upper] * alpha;
+}
+
+//
+// JSON Lines
+//
+
+void write_json_string(std::ostream& os, const std::string& str)
+{
+    os << '"';
+
+    for(const char c : str)
+    {
+        switch(c)
+        {
+        case '"': os << "\\\""; break;
+        case '\\': os << "\\\\"; break;
+        case '\n': os << "\\n"; break;
+        case '\t': os << "\\t"; break;
+        default:
+            if(static_cast<unsigned char>(c) < 0x20)
+                os << "\\u" << std::hex << std::setw(4) << std::setfill('0') << int(c)
+                   << std::dec << std::setfill(' ');
+            else
+                os << c;
+        }
+    }
+
+    os << '"';
+}
+
+// JSON has no infinity and NaN
+void write_json_number(std::ostream& os, double x)
+{
+    if(std::isfinite(x))
+        os << x;
+    else
+        os << "null";
+}
+
+template <typename T, typename F>
+void write_json_array(std::ostream& os, const std::vector<T>& values, F write_value)
+{
+    os << '[';
+
+    for(std::size_t i = 0; i < values.size(); ++i)
+    {
+        os << (i > 0 ? ", " : "");
+        write_value(values[i]);
+    }
+
+    os << ']';
+}
+
+void write_json_record(std::ostream& os, const ProfileResult& result)
+{
+    const auto stats = get_time_statistics(result.time_samples_ms_);
+
+    auto write_string = [&](const std::string& str) { write_json_string(os, str); };
+    auto write_number = [&](double x) { write_json_number(os, x); };
+
+    os << std::setprecision(NumberPrecision) << "{\"op\": ";
+    write_string(result.op_);
+    os << ", \"data_types\": ";
+    write_json_array(os, result.data_types_, write_string);
+    os << ", \"layouts\": ";
+    write_json_array(os, result.layouts_, write_string);
+    os << ", \"problem\": ";
+    write_json_array(os, result.problem_, [&](int64_t x) { os << x; });
+    os << ", \"instance\": ";
+    write_string(result.instance_name_);
+
+    os << ", \"descriptor\": {\"name\": ";
+    write_string(result.descriptor_.name_);
+    os << ", \"hash\": ";
+    write_string(to_hex(result.descriptor_.GetHash()));
+    os << ", \"params\": {";
+
+    for(std::size_t i = 0; i < result.descriptor_.params_.size(); ++i)
+    {
+        const auto& [key, value] = result.descriptor_.params_[i];
+
+        os << (i > 0 ? ", " : "");
+        write_string(key);
+        os << ": ";
+
+        if(const auto* str = std::get_if<std::string>(&value))
+            write_string(*str);
+        else
+            os << std::get<int64_t>(value);
+    }
+
+    os << "}}, \"time_ms\": {\"samples\": ";
+    write_json_array(os, result.time_samples_ms_, write_number);
+
+    const std::pair<const char*, double> stat_fields[] = {{"mean", stats.mean_},
+                                                          {"median", stats.median_},
+                                                          {"p10", stats.p10_},
+                                                          {"p90", stats.p90_},
+                                                          {"stddev", stats.stddev_},
+                                                          {"min", stats.min_},
+                                                          {"max", stats.max_}};
+
+    for(const auto& [name, value] : stat_fields)
+    {
+        os << ", \"" << name << "\": ";
+        write_number(value);
+    }
+
+    os << "}, \"tflops\": ";
+    write_number(result.tflops_);
+    os << ", \"gb_per_sec\": ";
+    write_number(result.gb_per_sec_);
+    os << ", \"verification\": ";
+    write_string(get_verification_name(result.verification_));
+    os << ", \"error\": {\"max_abs\": ";
+    write_number(result.error_.max_abs_error_);
+    os << ", \"max_rel\": ";
+    write_number(result.error_.max_rel_error_);
+    os << "}}\n";
+}
+
+// the subset of JSON written by write_json_record(): objects, arrays, strings, numbers and null
+struct JsonValue
+{
+    enum struct Type
+    {
+        Null,
+        Number,
+        String,
+        Array,
+        Object,
+    };
+
+    Type type_     = Type::Null;
+    double number_ = 0;
+    std::string string_;
+    std::vector<JsonValue> array_;
+    std::vector<std::pair<std::string, JsonValue>> object_;
+
+    const JsonValue& At(const std::string& key, Type type) const
+    {
+        for(const auto& [k, v] : object_)
+            if(k == key && (v.type_ == type || (type == Type::Number && v.type_ == Type::Null)))
+                return v;
+
+        throw std::invalid_argument("missing field " + key);
+    }
+
+    // null, written for non-finite numbers, reads as 0
+    double AsNumber() const
+    {
+        if(type_ != Type::Number && type_ != Type::Null)
+            throw std::invalid_argument("expected a number");
+
+        return type_ == Type::Null ? 0 : number_;
+    }
+
+    const std::string& AsString() const
+    {
+        if(type_ != Type::String)
+            throw std::invalid_argument("expected a string");
+
+        return string_;
+    }
+
+    double GetNumber(const std::string& key) const { return At(key, Type::Number).AsNumber(); }
+
+    const std::string& GetString(const std::string& key) const
+    {
+        return At(key, Type::String).string_;
+    }
+};
+
+class JsonParser
+{
+    public:
+    explicit JsonParser(const std::string& text) : text_(text) {}
+
+    JsonValue Parse()
+    {
+        JsonValue value = ParseValue();
+
+        SkipSpaces();
+
+        if(pos_ != text_.size())
+            throw std::invalid_argument("trailing characters");
+
+        return value;
+    }
+
+    private:
+    void SkipSpaces()
+    {
+        while(pos_ < text_.size() && std::isspace(static_cast<unsigned char>(text_[pos_])))
+            ++pos_;
+    }
+
+    bool Consume(char c)
+    {
+        SkipSpaces();
+
+        if(pos_ < text_.size() && text_[pos_] == c)
+        {
+            ++pos_;
+            return true;
+        }
+
+        return false;
+    }
+
+    void Expect(char c)
+    {
+        if(!Consume(c))
+            throw std::invalid_argument(std::string("expected ") + c);
+    }
+
+    JsonValue ParseValue()
+    {
+        SkipSpaces();
+
+        if(pos_ == text_.size())
+            throw std::invalid_argument("unexpected end");
+
+        JsonValue value;
+
+        if(Consume('{'))
+        {
+            value.type_ = JsonValue::Type::Object;
+
+            if(Consume('}'))
+                return value;
+
+            do
+            {
+                SkipSpaces();
+                std::string key = ParseString();
+                Expect(':');
+                value.object_.emplace_back(std::move(key), ParseValue());
+            } while(Consume(','));
+
+            Expect('}');
+        }
+        else if(Consume('['))
+        {
+            value.type_ = JsonValue::Type::Array;
+
+            if(Consume(']'))
+                return value;
+
+            do
+            {
+                value.array_.push_back(ParseValue());
+            } while(Consume(','));
+
+            Expect(']');
+        }
+        else if(text_[pos_] == '"')
+        {
+            value.type_   = JsonValue::Type::String;
+            value.string_ = ParseString();
+        }
+        else if(text_.compare(pos_, 4, "null") == 0)
+        {
+            pos_ += 4;
+        }
+        else
+        {
+            const char* begin = text_.c_str() + pos_;
+            char* end         = nullptr;
+
+            value.type_   = JsonValue::Type::Number;
+            value.number_ = std::strtod(begin, &end);
+
+            if(end == begin)
+                throw std::invalid_argument("invalid value");
+
+            pos_ += end - begin;
+        }
+
+        return value;
+    }
+
+    std::string ParseString()
+    {
+        if(pos_ == text_.size() || text_[pos_] != '"')
+            throw std::invalid_argument("expected a string");
+
+        std::string str;
+
+        for(++pos_; pos_ < text_.size() && text_[pos_] != '"'; ++pos_)
+        {
+            if(text_[pos_] != '\\')
+            {
+                str += text_[pos_];
+                continue;
+            }
+
+            if(++pos_ == text_.size())
+                break;
+
+            switch(text_[pos_])
+            {
+            case 'n': str += '\n'; break;
+            case 't': str += '\t'; break;
+            case 'u':
+                str += static_cast<char>(std::stoi(text_.substr(pos_ + 1, 4), nullptr, 16));
+                pos_ += 4;
+                break;
+            default: str += text_[pos_];
+            }
+        }
+
+        if(pos_ == text_.size())
+            throw std::invalid_argument("unterminated string");
+
+        ++pos_;
+
+        return str;
+    }
+
+    const std::string& text_;
+    std::size_t pos_ = 0;
+};
+
+ProfileResult parse_json_record(const std::string& line)
+{
+    using Type = JsonValue::Type;
+
+    const JsonValue record = JsonParser(line).Parse();
+
+    ProfileResult result;
+
+    result.op_ = record.GetString("op");
+
+    for(const auto& value : record.At("data_types", Type::Array).array_)
+        result.data_types_.push_back(value.AsString());
+
+    for(const auto& value : record.At("layouts", Type::Array).array_)
+        result.layouts_.push_back(value.AsString());
+
+    for(const auto& value : record.At("problem", Type::Array).array_)
+        result.problem_.push_back(static_cast<int64_t>(value.AsNumber()));
+
+    result.instance_name_ = record.GetString("instance");
+
+    const auto& descriptor    = record.At("descriptor", Type::Object);
+    result.descriptor_.name_ = descriptor.GetString("name");
+
+    for(const auto& [key, value] : descriptor.At("params", Type::Object).object_)
+    {
+        if(value.type_ == Type::String)
+            result.descriptor_.Add(key, value.string_);
+        else
+            result.descriptor_.Add(key, static_cast<int64_t>(value.AsNumber()));
+    }
+
+    for(const auto& value : record.At("time_ms", Type::Object).At("samples", Type::Array).array_)
+        result.time_samples_ms_.push_back(value.AsNumber());
+
+    result.tflops_       = static_cast<float>(record.GetNumber("tflops"));
+    result.gb_per_sec_   = static_cast<float>(record.GetNumber("gb_per_sec"));
+    result.verification_ = get_verification_status(record.GetString("verification"));
+
+    const auto& error            = record.At("error", Type::Object);
+    result.error_.max_abs_error_ = error.GetNumber("max_abs");
+    result.error_.max_rel_error_ = error.GetNumber("max_rel");
+
+    return result;
+}
+
+//
+// CSV
+//
+
+constexpr const char* CsvHeader =
+    "op,data_types,layouts,problem,instance,descriptor_name,descriptor_hash,descriptor_params,"
+    "num_samples,mean_ms,median_ms,p10_ms,p90_ms,stddev_ms,min_ms,max_ms,tflops,gb_per_sec,"
+    "verification,max_abs_error,max_rel_error,samples_ms";
+
+void write_csv_field(std::ostream& os, const std::string& field)
+{
+    if(field.find_first_of(",\"\n") == std::string::npos)
+    {
+        os << field;
+        return;
+    }
+
+    os << '"';
+
+    for(const char c : field)
+        os << (c == '"' ? "\"\"" : std::string(1, c));
+
+    os << '"';
+}
+
+template <typename T>
+std::string join_cell(const std::vector<T>& values)
+{
+    std::ostringstream stream;
+    stream << std::setprecision(NumberPrecision);
+
+    for(std::size_t i = 0; i < values.size(); ++i)
+        stream << (i > 0 ? ";" : "") << values[i];
+
+    return stream.str();
+}
+
+std::vector<std::string> split_cell(const std::string& cell)
+{
+    std::vector<std::string> values;
+    std::istringstream stream(cell);
+
+    for(std::string value; std::getline(stream, value, ';');)
+        values.push_back(value);
+
+    return values;
+}
+
+void write_csv_record(std::ostream& os, const ProfileResult& result)
+{
+    const auto stats = get_time_statistics(result.time_samples_ms_);
+
+    std::vector<std::string> params;
+
+    for(const auto& [key, value] : result.descriptor_.params_)
+    {
+        if(const auto* str = std::get_if<std::string>(&value))
+            params.push_back(key + "=" + *str);
+        else
+            params.push_back(key + "=" + std::to_string(std::get<int64_t>(value)));
+    }
+
+    const std::string fields[] = {result.op_,
+                                  join_cell(result.data_types_),
+                                  join_cell(result.layouts_),
+                                  join_cell(result.problem_),
+                                  result.instance_name_,
+                                  result.descriptor_.name_,
+                                  to_hex(result.descriptor_.GetHash()),
+                                  join_cell(params)};
+
+    for(const auto& field : fields)
+    {
+        write_csv_field(os, field);
+        os << ',';
+    }
+
+    os << std::setprecision(NumberPrecision) << stats.num_samples_ << ',' << stats.mean_ << ','
+       << stats.median_ << ',' << stats.p10_ << ',' << stats.p90_ << ',' << stats.stddev_ << ','
+       << stats.min_ << ',' << stats.max_ << ',' << result.tflops_ << ',' << result.gb_per_sec_
+       << ',' << get_verification_name(result.verification_) << ','
+       << result.error_.max_abs_error_ << ',' << result.error_.max_rel_error_ << ','
+       << join_cell(result.time_samples_ms_) << '\n';
+}
+
+std::vector<std::string> split_csv_line(const std::string& line)
+{
+    std::vector<std::string> fields(1);
+    bool quoted = false;
+
+    for(std::size_t i = 0; i < line.size(); ++i)
+    {
+        const char c = line[i];
+
+        if(quoted && c == '"' && i + 1 < line.size() && line[i + 1] == '"')
+        {
+            fields.back() += '"';
+            ++i;
+        }
+        else if(c == '"')
+            quoted = !quoted;
+        else if(c == ',' && !quoted)
+            fields.emplace_back();
+        else
+            fields.back() += c;
+    }
+
+    return fields;
+}
+
+ProfileResult parse_csv_record(const std::unordered_map<std::string, std::size_t>& columns,
+                               const std::vector<std::string>& fields)
+{
+    auto get = [&](const std::string& name) -> const std::string& {
+        const auto it = columns.find(name);
+
+        if(it == columns.end() || it->second >= fields.size())
+            throw std::invalid_argument("missing field " + name);
+
+        return fields[it->second];
+    };
+
+    ProfileResult result;
+
+    result.op_         = get("op");
+    result.data_types_ = split_cell(get("data_types"));
+    result.layouts_    = split_cell(get("layouts"));
+
+    for(const auto& value : split_cell(get("problem")))
+        result.problem_.push_back(std::stoll(value));
+
+    result.instance_name_    = get("instance");
+    result.descriptor_.name_ = get("descriptor_name");
+
+    // values that are integers were written from integers
+    for(const auto& param : split_cell(get("descriptor_params")))
+    {
+        const auto separator = param.find('=');
+
+        if(separator == std::string::npos)
+            throw std::invalid_argument("invalid descriptor parameter " + param);
+
+        const std::string value = param.substr(separator + 1);
+        char* end               = nullptr;
+        const long long number  = std::strtoll(value.c_str(), &end, 10);
+
+        if(!value.empty() && *end == '\0')
+            result.descriptor_.Add(param.substr(0, separator), static_cast<int64_t>(number));
+        else
+            result.descriptor_.Add(param.substr(0, separator), value);
+    }
+
+    for(const auto& value : split_cell(get("samples_ms")))
+        result.time_samples_ms_.push_back(std::stod(value));
+
+    result.tflops_               = std::stof(get("tflops"));
+    result.gb_per_sec_           = std::stof(get("gb_per_sec"));
+    result.verification_         = get_verification_status(get("verification"));
+    result.error_.max_abs_error_ = std::stod(get("max_abs_error"));
+    result.error_.max_rel_error_ = std::stod(get("max_rel_error"));
+
+    return result;
+}
+
+} // namespace
+
+TimeStatistics get_time_statistics(std::vector<double> samples)
+{
+    TimeStatistics stats;
+
+    if(samples.empty())
+        return stats;
+
+    std::sort(samples.begin(), samples.end());
+
+    const double n = static_cast<double>(samples.size());
+
+    stats.num_samples_ = samples.size();
+    stats.mean_        = std::accumulate(samples.begin(), samples.end(), 0.0) / n;
+    stats.median_      = get_percentile(samples, 0.5);
+    stats.p10_         = get_percentile(samples, 0.1);
+    stats.p90_         = get_percentile(samples, 0.9);
+    stats.min_         = samples.front();
+    stats.max_         = samples.back();
+
+    if(samples.size() > 1)
+    {
+        double sum_sq = 0;
+
+        for(const double x : samples)
+            sum_sq += (x - stats.mean_) * (x - stats.mean_);
+
+        stats.stddev_ = std::sqrt(sum_sq / (n - 1));
+    }
+
+    return stats;
+}
+
+bool append_profile_result(const std::string& path, const ProfileResult& result)
+{
+    const bool csv = is_csv_path(path);
+
+    // a new or empty CSV file needs its header
+    const bool write_header = csv && std::ifstream(path, std::ios::ate).tellg() <= 0;
+
+    std::ofstream file(path, std::ios::app);
+
+    if(!file)
+        return false;
+
+    if(write_header)
+        file << CsvHeader << '\n';
+
+    if(csv)
+        write_csv_record(file, result);
+    else
+        write_json_record(file, result);
+
+    return static_cast<bool>(file.flush());
+}
+
+bool load_profile_results(const std::string& path, std::vector<ProfileResult>& results)
+{
+    std::ifstream file(path);
+
+    if(!file)
+        return false;
+
+    const bool csv = is_csv_path(path);
+
+    std::unordered_map<std::string, std::size_t> columns;
+    std::size_t line_number = 0;
+
+    for(std::string line; std::getline(file, line);)
+    {
+        ++line_number;
+
+        if(line.empty())
+            continue;
+
+        try
+        {
+            if(!csv)
+            {
+                results.push_back(parse_json_record(line));
+            }
+            else if(columns.empty())
+            {
+                const auto names = split_csv_line(line);
+
+                for(std::size_t i = 0; i < names.size(); ++i)
+                    columns.emplace(names[i], i);
+            }
+            else if(line != CsvHeader)
+            {
+                results.push_back(parse_csv_record(columns, split_csv_line(line)));
+            }
+        }
+        catch(const std::logic_error& e)
+        {
+            throw std::runtime_error("wrong! invalid result record at " + path + ":" +
+                                     std::to_string(line_number) + ": " + e.what());
+        }
+    }
+
+    return true;
+}
+
+std::string make_profile_result_key(const ProfileResult& result)
+{
+    return make_perf_db_key(result.op_, result.data_types_, result.layouts_, result.problem_) +
+           "|" + result.instance_name_;
+}
+
+std::vector<ProfileResultComparison> compare_profile_results(
+    const std::vector<ProfileResult>& baseline,
+    const std::vector<ProfileResult>& current,
+    double threshold)
+{
+    std::unordered_map<std::string, const ProfileResult*> baseline_records;
+
+    for(const auto& result : baseline)
+        baseline_records[make_profile_result_key(result)] = &result;
+
+    // last record of each key, in order of first appearance
+    std::vector<std::string> keys;
+    std::unordered_map<std::string, const ProfileResult*> current_records;
+
+    for(const auto& result : current)
+    {
+        auto key = make_profile_result_key(result);
+
+        if(baseline_records.count(key) == 0)
+            continue;
+
+        if(current_records.count(key) == 0)
+            keys.push_back(key);
+
+        current_records[std::move(key)] = &result;
+    }
+
+    std::vector<ProfileResultComparison> comparisons;
+
+    for(const auto& key : keys)
+    {
+        const ProfileResult& old_result = *baseline_records.at(key);
+        const ProfileResult& new_result = *current_records.at(key);
+
+        ProfileResultComparison comparison{key,
+                                           get_time_statistics(old_result.time_samples_ms_),
+                                           get_time_statistics(new_result.time_samples_ms_),
+                                           0,
+                                           false,
+                                           false};
+
+        if(comparison.baseline_.median_ > 0)
+            comparison.change_ = comparison.current_.median_ / comparison.baseline_.median_ - 1;
+
+        comparison.regression_ =
+            comparison.change_ > threshold && comparison.current_.p10_ > comparison.baseline_.p90_;
+
+        comparison.verification_regression_ =
+            old_result.verification_ == VerificationStatus::Pass &&
+            new_result.verification_ == VerificationStatus::Fail;
+
+        comparisons.push_back(std::move(comparison));
+    }
+
+    return comparisons;
+}
+
+bool load_profile_problems(const std::string& path, std::vector<ProfileProblem>& problems)
+{
+    std::ifstream file(path);
+
+    if(!file)
+        return false;
+
+    const bool csv          = is_csv_path(path);
+    std::size_t line_number = 0;
+
+    for(std::string line; std::getline(file, line);)
+    {
+        ++line_number;
+
+        if(line.find_first_not_of(" \t\r") == std::string::npos || line[0] == '#')
+            continue;
+
+        try
+        {
+            ProfileProblem problem;
+
+            if(csv)
+            {
+                auto fields = split_csv_line(line);
+
+                // problem files are often aligned by hand
+                for(auto& field : fields)
+                {
+                    field.erase(0, field.find_first_not_of(" \t"));
+                    field.erase(field.find_last_not_of(" \t\r") + 1);
+                }
+
+                problem.op_ = fields.front();
+                problem.args_.assign(fields.begin() + 1, fields.end());
+            }
+            else
+            {
+                using Type = JsonValue::Type;
+
+                const JsonValue record = JsonParser(line).Parse();
+
+                problem.op_ = record.GetString("op");
+
+                for(const auto& value : record.At("args", Type::Array).array_)
+                {
+                    if(value.type_ == Type::String)
+                    {
+                        problem.args_.push_back(value.string_);
+                    }
+                    else
+                    {
+                        problem.args_.push_back(format_problem_arg(value.AsNumber()));
+                    }
+                }
+            }
+
+            if(problem.op_.empty())
+                throw std::invalid_argument("missing operation");
+
+            problems.push_back(std::move(problem));
+        }
+        catch(const std::logic_error& e)
+        {
+            throw std::runtime_error("wrong! invalid problem at " + path + ":" +
+                                     std::to_string(line_number) + ": " + e.what());
+        }
+    }
+
+    return true;
+}
+
+} // namespace utils
+} // namespace ck
@@ -0,0 +1,383 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "ck/library/utility/perf_db.hpp"
+#include "ck/library/utility/reference_cache.hpp"
+
+namespace ck {
+namespace utils {
+
+namespace {
+
+namespace fs = std::filesystem;
+
+constexpr char FileMagic[8]    = {'C', 'K', 'R', 'E', 'F', '0', '0', '1'};
+constexpr const char* FileType = ".ckref";
+
+// 64-bit FNV-1a, as DeviceOperatorDescriptor::GetHash()
+uint64_t get_key_hash(const std::string& key)
+{
+    uint64_t hash = 0xcbf29ce484222325ull;
+
+    for(const char c : key)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 0x100000001b3ull;
+    }
+
+    return hash;
+}
+
+// Copies the output of a cache file, which is one of size bytes for key. Returns false otherwise.
+bool read_cache_file(const std::byte* file,
+                     std::size_t file_size,
+                     const std::string& key,
+                     void* dst,
+                     std::size_t size)
+{
+    const std::size_t header_size = sizeof(FileMagic) + 2 * sizeof(uint64_t) + key.size();
+
+    if(file_size != header_size + size || std::memcmp(file, FileMagic, sizeof(FileMagic)) != 0)
+        return false;
+
+    uint64_t key_size, data_size;
+
+    std::memcpy(&key_size, file + sizeof(FileMagic), sizeof(uint64_t));
+    std::memcpy(&data_size, file + header_size - sizeof(uint64_t), sizeof(uint64_t));
+
+    if(key_size != key.size() || data_size != size ||
+       std::memcmp(file + sizeof(FileMagic) + sizeof(uint64_t), key.data(), key.size()) != 0)
+        return false;
+
+    std::memcpy(dst, file + header_size, size);
+
+    return true;
+}
+
+std::size_t get_env_size(const char* name, std::size_t default_value)
+{
+    if(const char* env = std::getenv(name))
+    {
+        try
+        {
+            return std::stoull(env);
+        }
+        catch(...)
+        {
+        }
+    }
+
+    return default_value;
+}
+
+} // namespace
+
+bool ReferenceCache::Load(const std::string& key, void* dst, std::size_t size)
+{
+    if(recompute_)
+        return false;
+
+    if(const auto found = entries_.find(key);
+       found != entries_.end() && found->second.data_.size() == size)
+    {
+        lru_.splice(lru_.begin(), lru_, found->second.lru_pos_);
+
+        std::memcpy(dst, found->second.data_.data(), size);
+
+        return true;
+    }
+
+    if(directory_.empty() || !LoadFile(key, dst, size))
+        return false;
+
+    // keeps the output at hand for the next load
+    StoreMemory(key, dst, size);
+
+    return true;
+}
+
+void ReferenceCache::Store(const std::string& key, const void* src, std::size_t size)
+{
+    if(!directory_.empty())
+        StoreFile(key, src, size);
+
+    StoreMemory(key, src, size);
+}
+
+void ReferenceCache::StoreMemory(const std::string& key, const void* src, std::size_t size)
+{
+    if(size > capacity_)
+        return;
+
+    auto found = entries_.find(key);
+
+    if(found == entries_.end())
+    {
+        lru_.push_front(key);
+        found = entries_.emplace(key, Entry{{}, lru_.begin()}).first;
+    }
+    else
+    {
+        lru_.splice(lru_.begin(), lru_, found->second.lru_pos_);
+        bytes_ -= found->second.data_.size();
+    }
+
+    const auto* bytes = static_cast<const std::byte*>(src);
+
+    found->second.data_.assign(bytes, bytes + size);
+    bytes_ += size;
+
+    Evict(capacity_);
+}
+
+void ReferenceCache::SetCapacity(std::size_t capacity_bytes)
+{
+    capacity_ = capacity_bytes;
+
+    Evict(capacity_);
+}
+
+void ReferenceCache::SetDirectory(const std::string& directory, std::size_t capacity_bytes)
+{
+    directory_          = directory;
+    directory_capacity_ = capacity_bytes;
+
+    if(!directory_.empty())
+    {
+        std::error_code error;
+        fs::create_directories(directory_, error);
+
+        EvictFiles("", 0);
+    }
+}
+
+void ReferenceCache::Clear() { Evict(0); }
+
+void ReferenceCache::Evict(std::size_t capacity_bytes)
+{
+    while(bytes_ > capacity_bytes || (capacity_bytes == 0 && !lru_.empty()))
+    {
+        const auto found = entries_.find(lru_.back());
+
+        bytes_ -= found->second.data_.size();
+
+        entries_.erase(found);
+        lru_.pop_back();
+    }
+}
+
+std::string ReferenceCache::GetPath(const std::string& key) const
+{
+    std::ostringstream name;
+    name << std::hex << std::setw(16) << std::setfill('0') << get_key_hash(key) << FileType;
+
+    return (fs::path(directory_) / name.str()).string();
+}
+
+bool ReferenceCache::LoadFile(const std::string& key, void* dst, std::size_t size) const
+{
+    const std::string path = GetPath(key);
+
+    bool loaded = false;
+
+#ifndef _WIN32
+    const int fd = open(path.c_str(), O_RDONLY);
+
+    if(fd < 0)
+        return false;
+
+    struct stat file_stat;
+
+    if(fstat(fd, &file_stat) == 0 && file_stat.st_size > 0)
+    {
+        const auto file_size = static_cast<std::size_t>(file_stat.st_size);
+
+        void* file = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        if(file != MAP_FAILED)
+        {
+            loaded =
+                read_cache_file(static_cast<const std::byte*>(file), file_size, key, dst, size);
+
+            munmap(file, file_size);
+        }
+    }
+
+    close(fd);
+#else
+    std::ifstream file(path, std::ios::binary);
+
+    if(!file)
+        return false;
+
+    const std::vector<char> contents{std::istreambuf_iterator<char>(file),
+                                     std::istreambuf_iterator<char>()};
+
+    loaded = read_cache_file(reinterpret_cast<const std::byte*>(contents.data()),
+                             contents.size(),
+                             key,
+                             dst,
+                             size);
+#endif
+
+    // the eviction removes the files used the longest ago first
+    if(loaded)
+    {
+        std::error_code error;
+        fs::last_write_time(path, fs::file_time_type::clock::now(), error);
+    }
+
+    return loaded;
+}
+
+void ReferenceCache::StoreFile(const std::string& key, const void* src, std::size_t size) const
+{
+    const std::string path = GetPath(key);
+
+    // processes sharing the directory never see a partially written file
+    const std::string tmp_path =
+        path + ".tmp" + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id())) +
+        std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+
+    {
+        std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+
+        if(!file)
+            return;
+
+        const uint64_t key_size  = key.size();
+        const uint64_t data_size = size;
+
+        file.write(FileMagic, sizeof(FileMagic));
+        file.write(reinterpret_cast<const char*>(&key_size), sizeof(key_size));
+        file.write(key.data(), key.size());
+        file.write(reinterpret_cast<const char*>(&data_size), sizeof(data_size));
+        file.write(static_cast<const char*>(src), size);
+
+        if(!file.flush())
+        {
+            file.close();
+            std::remove(tmp_path.c_str());
+            return;
+        }
+    }
+
+    // makes room before the new file appears, so that it is never the one evicted
+    EvictFiles(fs::path(path).filename().string(), size);
+
+    std::error_code error;
+    fs::rename(tmp_path, path, error);
+
+    if(error)
+    {
+        std::remove(tmp_path.c_str());
+    }
+}
+
+void ReferenceCache::EvictFiles(const std::string& skip_name, std::size_t reserved_bytes) const
+{
+    struct File
+    {
+        fs::path path_;
+        fs::file_time_type time_;
+        std::uintmax_t size_;
+    };
+
+    std::vector<File> files;
+    std::uintmax_t total_size = 0;
+
+    std::error_code error;
+
+    for(const auto& entry : fs::directory_iterator(directory_, error))
+    {
+        if(entry.path().extension() != FileType || entry.path().filename() == skip_name)
+            continue;
+
+        const auto time = entry.last_write_time(error);
+        const auto size = entry.file_size(error);
+
+        if(error)
+            continue;
+
+        files.push_back({entry.path(), time, size});
+        total_size += size;
+    }
+
+    // a file larger than the whole directory is kept alone
+    const std::uintmax_t capacity =
+        directory_capacity_ > reserved_bytes ? directory_capacity_ - reserved_bytes : 0;
+
+    if(total_size <= capacity)
+        return;
+
+    std::sort(files.begin(), files.end(), [](const File& lhs, const File& rhs) {
+        return lhs.time_ < rhs.time_;
+    });
+
+    for(const auto& file : files)
+    {
+        if(total_size <= capacity)
+            break;
+
+        if(fs::remove(file.path_, error))
+            total_size -= file.size_;
+    }
+}
+
+ReferenceCache& get_reference_cache()
+{
+    static ReferenceCache cache = [] {
+        ReferenceCache env_cache;
+
+        if(const char* directory = std::getenv("CK_REFERENCE_CACHE_DIR"))
+        {
+            env_cache.SetDirectory(directory, get_env_size("CK_REFERENCE_CACHE_SIZE", 8192) << 20);
+        }
+
+        env_cache.SetRecompute(get_env_size("CK_REFERENCE_CACHE_RECOMPUTE", 0) != 0);
+
+        return env_cache;
+    }();
+
+    return cache;
+}
+
+std::string make_reference_cache_key(const std::string& op,
+                                     const std::vector<std::string>& data_types,
+                                     const std::vector<std::string>& layouts,
+                                     const std::vector<int64_t>& problem,
+                                     const std::vector<std::string>& element_ops,
+                                     int init_method,
+                                     uint64_t seed)
+{
+    std::string key = make_perf_db_key(op, data_types, layouts, problem) + "|";
+
+    for(std::size_t i = 0; i < element_ops.size(); ++i)
+    {
+        key += (i > 0 ? "," : "") + element_ops[i];
+    }
+
+    return key + "|" + std::to_string(init_method) + "|" + std::to_string(seed);
+}
+
+} // namespace utils
+} // namespace ck
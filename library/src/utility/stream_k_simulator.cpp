@@ -0,0 +1,350 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <limits>
+
+#include "ck/library/utility/stream_k_simulator.hpp"
+
+namespace ck {
+namespace utils {
+
+namespace {
+
+// same as BlockToCTileMap_GemmStreamK
+constexpr uint32_t min_k_iters_per_sk_block = 2;
+
+uint32_t ceil_div(uint32_t a, uint32_t b) { return (a + b - 1) / b; }
+
+struct StreamKTileSplit
+{
+    uint32_t dp_tiles_;
+    uint32_t sk_tiles_;
+    uint32_t sk_occupancy_;
+};
+
+// how the tile map splits the tiles between DP and SK before choosing the SK block count
+StreamKTileSplit get_stream_k_tile_split(const StreamKProblem& problem, uint32_t num_tiles)
+{
+    const uint32_t num_cu    = problem.num_cu_;
+    const uint32_t occupancy = problem.occupancy_;
+
+    const uint32_t full_dispatches     = num_tiles / num_cu;
+    const uint32_t full_dispatch_tiles = full_dispatches * num_cu;
+    const uint32_t partial_tiles       = num_tiles - full_dispatch_tiles;
+
+    if(full_dispatches < occupancy)
+        return {full_dispatch_tiles, partial_tiles, 1};
+
+    if(occupancy > 1 && full_dispatches % occupancy == occupancy - 1)
+        return {full_dispatch_tiles, partial_tiles, 1};
+
+    // one dispatch of DP tiles joins the partial dispatch
+    return {full_dispatch_tiles - num_cu,
+            partial_tiles + num_cu,
+            occupancy - ((full_dispatches - 1) % occupancy)};
+}
+
+} // namespace
+
+StreamKSchedule make_stream_k_schedule(const StreamKProblem& problem, uint32_t sk_num_blocks)
+{
+    StreamKSchedule schedule{};
+
+    schedule.num_tiles_ =
+        ceil_div(problem.M_, problem.m_per_block_) * ceil_div(problem.N_, problem.n_per_block_);
+    schedule.k_iters_per_tile_ = ceil_div(problem.K_, problem.k_per_block_);
+
+    uint32_t dp_num_blocks = 0;
+
+    if(sk_num_blocks == 0)
+    {
+        dp_num_blocks = schedule.num_tiles_;
+    }
+    else
+    {
+        const auto split = get_stream_k_tile_split(problem, schedule.num_tiles_);
+
+        // the first sk_num_big_blocks_ blocks take one iteration more than the others
+        const uint32_t sk_total_iters       = schedule.k_iters_per_tile_ * split.sk_tiles_;
+        const uint32_t k_iters_per_sk_block = sk_total_iters / sk_num_blocks;
+
+        schedule.sk_num_blocks_         = sk_num_blocks;
+        schedule.sk_num_big_blocks_     = sk_total_iters - k_iters_per_sk_block * sk_num_blocks;
+        schedule.k_iters_per_big_block_ = k_iters_per_sk_block + 1;
+        schedule.sk_tiles_              = split.sk_tiles_;
+
+        dp_num_blocks                = split.dp_tiles_;
+        schedule.dp_start_block_idx_ = ceil_div(sk_num_blocks, problem.num_cu_) * problem.num_cu_;
+    }
+
+    schedule.reduction_start_block_idx_ = schedule.dp_start_block_idx_ + dp_num_blocks;
+    schedule.grid_size_ =
+        schedule.reduction_start_block_idx_ + (problem.reduction_ ? schedule.sk_tiles_ : 0);
+
+    return schedule;
+}
+
+std::vector<uint32_t> get_stream_k_sk_num_blocks_candidates(const StreamKProblem& problem)
+{
+    const uint32_t num_tiles =
+        ceil_div(problem.M_, problem.m_per_block_) * ceil_div(problem.N_, problem.n_per_block_);
+    const uint32_t k_iters_per_tile = ceil_div(problem.K_, problem.k_per_block_);
+
+    const auto split              = get_stream_k_tile_split(problem, num_tiles);
+    const uint32_t num_cu         = problem.num_cu_;
+    const uint32_t sk_total_iters = k_iters_per_tile * split.sk_tiles_;
+
+    const uint32_t min_sk_blocks = split.sk_tiles_ >= num_cu ? num_cu : split.sk_tiles_ + 1;
+    const uint32_t max_sk_blocks =
+        split.sk_tiles_ >= num_cu ? num_cu * split.sk_occupancy_
+                                  : std::min(num_cu, sk_total_iters / min_k_iters_per_sk_block);
+
+    // the tile map leaves max_sk_blocks out, which is often the only split of a full dispatch
+    const uint32_t last_sk_blocks = std::min(max_sk_blocks, sk_total_iters);
+
+    std::vector<uint32_t> candidates{0};
+
+    for(uint32_t sk_num_blocks = min_sk_blocks; sk_num_blocks <= last_sk_blocks; ++sk_num_blocks)
+        candidates.push_back(sk_num_blocks);
+
+    return candidates;
+}
+
+std::pair<uint32_t, uint32_t> get_stream_k_block_iters(const StreamKSchedule& schedule,
+                                                        uint32_t block_idx)
+{
+    const uint32_t big_iters    = schedule.k_iters_per_big_block_;
+    const uint32_t sk_big_iters = schedule.sk_num_big_blocks_ * big_iters;
+
+    if(block_idx < schedule.sk_num_big_blocks_)
+        return {block_idx * big_iters, (block_idx + 1) * big_iters};
+
+    if(block_idx < schedule.sk_num_blocks_)
+    {
+        const uint32_t begin =
+            sk_big_iters + (block_idx - schedule.sk_num_big_blocks_) * (big_iters - 1);
+
+        return {begin, begin + big_iters - 1};
+    }
+
+    if(block_idx >= schedule.dp_start_block_idx_ && block_idx < schedule.reduction_start_block_idx_)
+    {
+        const uint32_t sk_total_iters =
+            sk_big_iters +
+            (schedule.sk_num_blocks_ - schedule.sk_num_big_blocks_) * (big_iters - 1);
+        const uint32_t begin = sk_total_iters + (block_idx - schedule.dp_start_block_idx_) *
+                                                    schedule.k_iters_per_tile_;
+
+        return {begin, begin + schedule.k_iters_per_tile_};
+    }
+
+    return {0, 0};
+}
+
+std::vector<StreamKTileWork> get_stream_k_block_work(const StreamKSchedule& schedule,
+                                                     uint32_t block_idx)
+{
+    auto [iter_start, iter_end] = get_stream_k_block_iters(schedule, block_idx);
+
+    std::vector<StreamKTileWork> work;
+
+    const uint32_t k_iters_per_tile = schedule.k_iters_per_tile_;
+
+    // one tile at a time, from the last one
+    while(iter_end > iter_start)
+    {
+        const uint32_t iter_length_mod = iter_end % k_iters_per_tile;
+        const uint32_t current_iter_length =
+            std::min(iter_length_mod == 0 ? k_iters_per_tile : iter_length_mod,
+                     iter_end - iter_start);
+        const uint32_t iter_offset = (iter_end - 1) % k_iters_per_tile - current_iter_length + 1;
+
+        work.push_back({(iter_end - 1) / k_iters_per_tile,
+                        iter_offset,
+                        iter_offset + current_iter_length});
+
+        iter_end -= current_iter_length;
+    }
+
+    return work;
+}
+
+StreamKPrediction simulate_stream_k(const StreamKProblem& problem,
+                                    uint32_t sk_num_blocks,
+                                    const StreamKCostModel& cost)
+{
+    const auto schedule = make_stream_k_schedule(problem, sk_num_blocks);
+
+    const uint32_t grid_size = schedule.grid_size_;
+
+    // work of every block, and the SK blocks each SK tile waits for before its reduction
+    std::vector<double> block_work(grid_size, 0);
+    std::vector<uint32_t> tile_num_partials(schedule.sk_tiles_, 0);
+    std::vector<std::vector<uint32_t>> block_sk_tiles(schedule.sk_num_blocks_);
+
+    for(uint32_t block_idx = 0; block_idx < schedule.reduction_start_block_idx_; ++block_idx)
+    {
+        const bool is_sk_block = block_idx < schedule.sk_num_blocks_;
+
+        for(const auto& work : get_stream_k_block_work(schedule, block_idx))
+        {
+            block_work[block_idx] += work.iter_end_ - work.iter_begin_;
+
+            if(!is_sk_block)
+                block_work[block_idx] += cost.tile_store_time_;
+            else if(problem.reduction_)
+                block_work[block_idx] += cost.partial_store_time_;
+            else
+                block_work[block_idx] += cost.atomic_store_time_;
+
+            if(is_sk_block)
+            {
+                ++tile_num_partials[work.tile_idx_];
+                block_sk_tiles[block_idx].push_back(work.tile_idx_);
+            }
+        }
+    }
+
+    if(problem.reduction_)
+    {
+        for(uint32_t tile_idx = 0; tile_idx < schedule.sk_tiles_; ++tile_idx)
+            block_work[schedule.reduction_start_block_idx_ + tile_idx] =
+                tile_num_partials[tile_idx] * cost.partial_load_time_ + cost.tile_store_time_;
+    }
+
+    // SK blocks a reduction block still waits for
+    std::vector<uint32_t> tile_pending = tile_num_partials;
+
+    struct ResidentBlock
+    {
+        uint32_t block_idx_;
+        uint32_t cu_;
+        double remaining_;
+    };
+
+    std::vector<ResidentBlock> resident;
+    std::vector<uint32_t> cu_num_resident(problem.num_cu_, 0);
+    std::vector<uint32_t> cu_num_running(problem.num_cu_, 0);
+    std::vector<double> finish_time(grid_size, 0);
+
+    auto is_waiting = [&](uint32_t block_idx) {
+        return block_idx >= schedule.reduction_start_block_idx_ &&
+               tile_pending[block_idx - schedule.reduction_start_block_idx_] > 0;
+    };
+
+    double time              = 0;
+    uint32_t next_block_idx  = 0;
+    uint32_t num_blocks_done = 0;
+
+    while(num_blocks_done < grid_size)
+    {
+        // dispatch in block order, each block to the least loaded CU
+        while(next_block_idx < grid_size)
+        {
+            const uint32_t cu = static_cast<uint32_t>(
+                std::min_element(cu_num_resident.begin(), cu_num_resident.end()) -
+                cu_num_resident.begin());
+
+            if(cu_num_resident[cu] >= problem.occupancy_)
+                break;
+
+            const uint32_t block_idx = next_block_idx++;
+
+            if(block_work[block_idx] == 0)
+            {
+                finish_time[block_idx] = time;
+                ++num_blocks_done;
+                continue;
+            }
+
+            resident.push_back({block_idx, cu, block_work[block_idx]});
+            ++cu_num_resident[cu];
+
+            if(!is_waiting(block_idx))
+                ++cu_num_running[cu];
+        }
+
+        // the running blocks of a CU progress at 1 / (number of running blocks) each
+        double step = std::numeric_limits<double>::max();
+
+        for(const auto& block : resident)
+            if(!is_waiting(block.block_idx_))
+                step = std::min(step, block.remaining_ * cu_num_running[block.cu_]);
+
+        if(step == std::numeric_limits<double>::max())
+            break;
+
+        time += step;
+
+        for(auto& block : resident)
+            if(!is_waiting(block.block_idx_))
+                block.remaining_ -= step / cu_num_running[block.cu_];
+
+        std::vector<uint32_t> finished_sk_blocks;
+
+        for(std::size_t i = 0; i < resident.size();)
+        {
+            const auto& block = resident[i];
+
+            if(is_waiting(block.block_idx_) || block.remaining_ > 1e-9 * step)
+            {
+                ++i;
+                continue;
+            }
+
+            finish_time[block.block_idx_] = time;
+            --cu_num_resident[block.cu_];
+            --cu_num_running[block.cu_];
+            ++num_blocks_done;
+
+            if(block.block_idx_ < schedule.sk_num_blocks_)
+                finished_sk_blocks.push_back(block.block_idx_);
+
+            resident[i] = resident.back();
+            resident.pop_back();
+        }
+
+        // reduction blocks whose partial tiles are all done start running
+        for(uint32_t block_idx : finished_sk_blocks)
+            for(uint32_t tile_idx : block_sk_tiles[block_idx])
+                if(--tile_pending[tile_idx] == 0)
+                    for(const auto& block : resident)
+                        if(block.block_idx_ == schedule.reduction_start_block_idx_ + tile_idx)
+                            ++cu_num_running[block.cu_];
+    }
+
+    StreamKPrediction prediction{sk_num_blocks, 0, 0, 0, time};
+
+    for(uint32_t block_idx = 0; block_idx < grid_size; ++block_idx)
+    {
+        if(block_idx < schedule.sk_num_blocks_)
+            prediction.sk_time_ = std::max(prediction.sk_time_, finish_time[block_idx]);
+        else if(block_idx >= schedule.reduction_start_block_idx_)
+            prediction.reduction_time_ =
+                std::max(prediction.reduction_time_, finish_time[block_idx]);
+        else if(block_idx >= schedule.dp_start_block_idx_)
+            prediction.dp_time_ = std::max(prediction.dp_time_, finish_time[block_idx]);
+    }
+
+    return prediction;
+}
+
+StreamKTuningResult tune_stream_k(const StreamKProblem& problem, const StreamKCostModel& cost)
+{
+    StreamKTuningResult result{};
+
+    for(uint32_t sk_num_blocks : get_stream_k_sk_num_blocks_candidates(problem))
+    {
+        result.candidates_.push_back(simulate_stream_k(problem, sk_num_blocks, cost));
+
+        if(result.candidates_.size() == 1 ||
+           result.candidates_.back().makespan_ < result.best_.makespan_)
+            result.best_ = result.candidates_.back();
+    }
+
+    return result;
+}
+
+} // namespace utils
+} // namespace ck
@@ -112,7 +112,8 @@ bool profile_batched_gemm_softmax_gemm_permute_impl(bool do_verification,
     std::cout << "b1_gs_os_ns: " << b1_gs_os_ns.mDesc << std::endl;
     std::cout << "c_gs_ms_os: " << c_gs_ms_os_host_result.mDesc << std::endl;
 
-    std::srand(1); // work around test flakiness
+    // same inputs for every call with the same --seed, to work around test flakiness
+    ck::utils::restart_random_streams();
     switch(init_method)
     {
     case 0: break;
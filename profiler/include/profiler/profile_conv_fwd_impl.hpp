@@ -20,6 +20,9 @@
 #include "ck/library/utility/host_tensor_generator.hpp"
 #include "ck/library/utility/convolution_parameter.hpp"
 #include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
+#include "ck/library/utility/host_random.hpp"
+#include "ck/library/utility/perf_db.hpp"
+#include "ck/library/utility/reference_cache.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd.hpp"
 
 namespace ck {
@@ -64,6 +67,9 @@ bool profile_conv_fwd_impl(int do_verification,
     std::cout << "weight: " << weight.mDesc << std::endl;
     std::cout << "output: " << host_output.mDesc << std::endl;
 
+    // the inputs only depend on the seed, which keys the cached reference output
+    ck::utils::restart_random_streams();
+
     switch(init_method)
     {
     case 0: break;
@@ -106,10 +112,40 @@ bool profile_conv_fwd_impl(int do_verification,
                                                   wei_element_op,
                                                   out_element_op);
 
-        // init host output to zero
-        host_output.SetZero();
+        using ck::utils::get_perf_db_type_names;
+
+        std::vector<int64_t> problem{conv_param.num_dim_spatial_,
+                                     conv_param.G_,
+                                     conv_param.N_,
+                                     conv_param.K_,
+                                     conv_param.C_};
+
+        for(const auto* lengths : {&conv_param.filter_spatial_lengths_,
+                                   &conv_param.input_spatial_lengths_,
+                                   &conv_param.conv_filter_strides_,
+                                   &conv_param.conv_filter_dilations_,
+                                   &conv_param.input_left_pads_,
+                                   &conv_param.input_right_pads_})
+        {
+            problem.insert(problem.end(), lengths->begin(), lengths->end());
+        }
 
-        ref_invoker.Run(ref_argument);
+        const auto ref_key = ck::utils::make_reference_cache_key(
+            "conv_fwd",
+            // ReferenceConvFwd accumulates in float
+            get_perf_db_type_names<InDataType, WeiDataType, OutDataType, float>(),
+            get_perf_db_type_names<InLayout, WeiLayout, OutLayout>(),
+            problem,
+            get_perf_db_type_names<InElementOp, WeiElementOp, OutElementOp>(),
+            init_method,
+            ck::utils::get_host_random_seed());
+
+        ck::utils::run_reference_cached(ref_key, host_output, [&] {
+            // init host output to zero
+            host_output.SetZero();
+
+            ref_invoker.Run(ref_argument);
+        });
     }
 
     using DeviceOp = ck::tensor_operation::device::DeviceConvFwd<NDimSpatial,
@@ -18,6 +18,7 @@
 #include "ck/library/utility/host_tensor_generator.hpp"
 #include "ck/library/utility/literals.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_element_wise.hpp"
 
 namespace ck {
 namespace profiler {
@@ -126,13 +127,8 @@ bool profile_gemm_fastgelu_impl(int do_verification,
 
         ref_invoker.Run(ref_argument);
 
-        for(int m = 0; m < M; ++m)
-        {
-            for(int n = 0; n < N; ++n)
-            {
-                cde_element_op(e_m_n_host_result(m, n), c_m_n(m, n));
-            }
-        }
+        ck::tensor_operation::host::reference_element_wise(
+            cde_element_op, e_m_n_host_result, c_m_n);
     }
 
     DeviceMem a_device_buf(sizeof(ADataType) * a_m_k.mDesc.GetElementSpaceSize());
@@ -22,6 +22,12 @@
 #include "ck/library/utility/literals.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
 #include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_random.hpp"
+#include "ck/library/utility/reference_cache.hpp"
+
+#include "profiler/profiler_cost_model.hpp"
+#include "profiler/profiler_perf_db.hpp"
+#include "profiler/profiler_result.hpp"
 
 namespace ck {
 namespace profiler {
@@ -69,6 +75,9 @@ int profile_gemm_impl(int do_verification,
     std::cout << "b_k_n: " << b_k_n.mDesc << std::endl;
     std::cout << "c_m_n: " << c_m_n_device_result.mDesc << std::endl;
 
+    // the inputs only depend on the seed, which keys the cached reference output
+    ck::utils::restart_random_streams();
+
     switch(init_method)
     {
     case 0:
@@ -132,16 +141,47 @@ int profile_gemm_impl(int do_verification,
         auto ref_argument = ref_op.MakeArgument(
             a_m_k, b_k_n, c_m_n_host_result, a_element_op, b_element_op, c_element_op);
 
-        ref_invoker.Run(ref_argument);
+        using ck::utils::get_perf_db_type_names;
+
+        const auto ref_key = ck::utils::make_reference_cache_key(
+            "gemm",
+            get_perf_db_type_names<ADataType, BDataType, CDataType, AccDataType>(),
+            get_perf_db_type_names<ALayout, BLayout, CLayout>(),
+            {M, N, K, StrideA, StrideB, StrideC},
+            get_perf_db_type_names<AElementOp, BElementOp, CElementOp>(),
+            init_method,
+            ck::utils::get_host_random_seed());
+
+        ck::utils::run_reference_cached(
+            ref_key, c_m_n_host_result, [&] { ref_invoker.Run(ref_argument); });
     }
 
     float best_tflops    = 0;
     int best_instance_id = 0;
 
-    int instance_id = 0;
+    const ck::utils::GemmCostModelProblem cost_model_problem{
+        static_cast<std::size_t>(M),
+        static_cast<std::size_t>(N),
+        static_cast<std::size_t>(K),
+        1,
+        sizeof(ADataType),
+        sizeof(BDataType),
+        sizeof(CDataType)};
+
+    const std::size_t top_k = get_profiler_top_k();
+    std::size_t num_timed   = 0;
+
+    std::vector<double> estimated_times;
+    std::vector<double> measured_times;
+
     // profile device op instances
-    for(auto& op_ptr : op_ptrs)
+    for(const std::size_t instance_id : get_profiled_instance_order(op_ptrs, cost_model_problem))
     {
+        if(top_k > 0 && num_timed == top_k)
+            break;
+
+        auto& op_ptr = op_ptrs[instance_id];
+
         auto argument_ptr =
             op_ptr->MakeArgumentPointer(static_cast<ADataType*>(a_device_buf.GetDeviceBuffer()),
                                         static_cast<BDataType*>(b_device_buf.GetDeviceBuffer()),
@@ -180,17 +220,33 @@ int profile_gemm_impl(int do_verification,
             std::cout << "Perf: " << std::setw(10) << avg_time << " ms, " << tflops << " TFlops, "
                       << gb_per_sec << " GB/s, " << op_name << std::endl;
 
+            ++num_timed;
+
+            if(const auto estimated_time =
+                   ck::utils::estimate_instance_time(*op_ptr, cost_model_problem))
+            {
+                estimated_times.push_back(*estimated_time);
+                measured_times.push_back(avg_time);
+            }
+
             if(tflops > best_tflops)
             {
-                best_instance_id = instance_id;
+                best_instance_id = static_cast<int>(instance_id);
                 best_tflops      = tflops;
             }
 
+            auto verification = ck::utils::VerificationStatus::NotRun;
+
             if(do_verification)
             {
                 c_device_buf.FromDevice(c_m_n_device_result.mData.data());
 
-                pass = pass & ck::utils::check_err(c_m_n_device_result, c_m_n_host_result);
+                const bool instance_pass =
+                    ck::utils::check_err(c_m_n_device_result, c_m_n_host_result);
+
+                pass         = pass & instance_pass;
+                verification = instance_pass ? ck::utils::VerificationStatus::Pass
+                                             : ck::utils::VerificationStatus::Fail;
 
                 if(do_log)
                 {
@@ -202,13 +258,44 @@ int profile_gemm_impl(int do_verification,
                         << std::endl;
                 }
             }
+
+            if(time_kernel && !get_profile_result_path().empty())
+            {
+                using ck::utils::get_perf_db_type_names;
+
+                ck::utils::ProfileResult result;
+
+                result.op_            = "gemm";
+                result.data_types_    = get_perf_db_type_names<ADataType, BDataType, CDataType>();
+                result.layouts_       = get_perf_db_type_names<ALayout, BLayout, CLayout>();
+                result.problem_       = {M, N, K, StrideA, StrideB, StrideC};
+                result.instance_name_ = op_name;
+                result.descriptor_    = op_ptr->GetDescriptor();
+                result.tflops_        = tflops;
+                result.gb_per_sec_    = gb_per_sec;
+                result.verification_  = verification;
+
+                result.time_samples_ms_ =
+                    get_profile_time_samples(*invoker_ptr, argument_ptr.get());
+
+                if(do_verification)
+                {
+                    result.error_ = ck::utils::get_error_statistics(c_m_n_device_result.mData,
+                                                                    c_m_n_host_result.mData);
+                }
+
+                record_profile_result(result);
+            }
         }
         else
         {
             std::cout << op_ptr->GetTypeString() << " does not support this problem" << std::endl;
         }
+    }
 
-        instance_id++;
+    if(time_kernel)
+    {
+        report_cost_model_correlation(estimated_times, measured_times);
     }
 
     sleep(2);
@@ -293,6 +380,23 @@ int profile_gemm_impl(int do_verification,
                       << " StrideB = " << StrideB << " StrideC = " << StrideC << " : " << avg_time
                       << " ms, " << tflops << " TFlops, " << gb_per_sec << " GB/s, " << op_name
                       << std::endl;
+
+            if(time_kernel)
+            {
+                using ck::utils::get_perf_db_type_names;
+
+                record_perf_db_entry(
+                    ck::utils::make_perf_db_key(
+                        "gemm",
+                        get_perf_db_type_names<ADataType, BDataType, CDataType>(),
+                        get_perf_db_type_names<ALayout, BLayout, CLayout>(),
+                        {M, N, K, StrideA, StrideB, StrideC}),
+                    {static_cast<std::size_t>(best_instance_id),
+                     op_name,
+                     avg_time,
+                     tflops,
+                     gb_per_sec});
+            }
         }
     }
 
@@ -110,12 +110,12 @@ bool profile_gemm_reduce_impl(int do_verification,
     {
     case 0: break;
     case 1:
-        std::srand(0);
+        ck::utils::restart_random_streams();
         a_m_k.GenerateTensorValue(GeneratorTensor_2<ADataType>{-5, 5}, num_thread);
         b_k_n.GenerateTensorValue(GeneratorTensor_2<BDataType>{-5, 5}, num_thread);
         break;
     default:
-        std::srand(0);
+        ck::utils::restart_random_streams();
         a_m_k.GenerateTensorValue(GeneratorTensor_3<ADataType>{0.0, 1.0}, num_thread);
         b_k_n.GenerateTensorValue(GeneratorTensor_3<BDataType>{-0.5, 0.5}, num_thread);
     }
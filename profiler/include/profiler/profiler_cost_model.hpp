@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+#include "ck/library/utility/instance_cost_model.hpp"
+
+namespace ck {
+namespace profiler {
+
+// Number of supported instances the profilers time, taking them in the order of the cost model,
+// set by the --top-k option of ckProfiler. All instances are timed while it is 0.
+inline std::size_t& get_profiler_top_k()
+{
+    static std::size_t top_k = 0;
+    return top_k;
+}
+
+// order in which the instances are profiled: by estimated time if only the top k are timed,
+// otherwise their order in op_ptrs
+template <typename OpPtrs>
+std::vector<std::size_t> get_profiled_instance_order(const OpPtrs& op_ptrs,
+                                                     const ck::utils::GemmCostModelProblem& problem)
+{
+    if(get_profiler_top_k() > 0)
+        return ck::utils::rank_instances_by_cost(op_ptrs, problem);
+
+    std::vector<std::size_t> order(op_ptrs.size());
+    std::iota(order.begin(), order.end(), std::size_t{0});
+
+    return order;
+}
+
+// Spearman rank correlation between the estimated and the measured times of the timed instances,
+// it tells how well --top-k can be trusted for a problem
+inline void report_cost_model_correlation(const std::vector<double>& estimated_times,
+                                          const std::vector<double>& measured_times)
+{
+    if(estimated_times.size() < 2)
+        return;
+
+    std::cout << "Cost model rank correlation: "
+              << ck::utils::get_rank_correlation(estimated_times, measured_times) << " over "
+              << estimated_times.size() << " instances" << std::endl;
+}
+
+} // namespace profiler
+} // namespace ck
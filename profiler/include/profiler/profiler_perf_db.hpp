@@ -0,0 +1,39 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <iostream>
+#include <string>
+
+#include "ck/library/utility/perf_db.hpp"
+
+namespace ck {
+namespace profiler {
+
+// perf-db file the profilers record their best instances into, set by the --perf-db option of
+// ckProfiler. Recording is off while it is empty.
+inline std::string& get_perf_db_record_path()
+{
+    static std::string path;
+    return path;
+}
+
+// Records the best instance of a problem into the perf-db file, keeping a faster existing record.
+// Concurrent profiler processes should record into different files and merge them with
+// "ckProfiler perf_db_merge".
+inline void record_perf_db_entry(const std::string& key, const ck::utils::PerfDbEntry& entry)
+{
+    const std::string& path = get_perf_db_record_path();
+
+    if(path.empty())
+        return;
+
+    ck::utils::PerfDb db(path);
+
+    if(db.Record(key, entry) && !db.Save(path))
+        std::cerr << "failed to write perf-db " << path << std::endl;
+}
+
+} // namespace profiler
+} // namespace ck
@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "ck/stream_config.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+
+#include "ck/library/utility/profile_result.hpp"
+
+namespace ck {
+namespace profiler {
+
+// result file the profilers append a record of every timed instance to, set by the --results
+// option of ckProfiler. Recording is off while it is empty.
+inline std::string& get_profile_result_path()
+{
+    static std::string path;
+    return path;
+}
+
+// Times num_samples single runs of a warmed up instance. The average of launch_and_time_kernel()
+// hides the spread between the runs, which the comparison of result files needs.
+inline std::vector<double>
+get_profile_time_samples(ck::tensor_operation::device::BaseInvoker& invoker,
+                         const ck::tensor_operation::device::BaseArgument* argument,
+                         int num_samples = 20)
+{
+    std::vector<double> samples;
+
+    for(int i = 0; i < num_samples; ++i)
+    {
+        samples.push_back(invoker.Run(argument, StreamConfig{nullptr, true, 0, 0, 1}));
+    }
+
+    return samples;
+}
+
+inline void record_profile_result(const ck::utils::ProfileResult& result)
+{
+    const std::string& path = get_profile_result_path();
+
+    if(path.empty())
+        return;
+
+    if(!ck::utils::append_profile_result(path, result))
+        std::cerr << "failed to write result file " << path << std::endl;
+}
+
+} // namespace profiler
+} // namespace ck
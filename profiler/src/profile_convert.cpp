@@ -0,0 +1,164 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "ck/library/utility/convert.hpp"
+#include "ck/library/utility/host_random.hpp"
+
+#include "profiler_operation_registry.hpp"
+
+#define OP_NAME "convert"
+#define OP_DESC "Host bulk type conversions"
+
+static void print_helper_msg()
+{
+    std::cout << "arg1: tensor operation (" OP_NAME ": " OP_DESC ")\n"
+              << "arg2: number of elements (default: 16777216)\n"
+              << "arg3: number of repeats (default: 5)\n"
+              << std::endl;
+}
+
+namespace {
+
+// mean time of repeat calls of f, in ms
+template <typename F>
+double time_ms(int repeat, F&& f)
+{
+    f();
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for(int i = 0; i < repeat; ++i)
+    {
+        f();
+    }
+
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+               .count() /
+           repeat;
+}
+
+// times convert_n() against scalar() called on every element on one thread
+template <typename Y, typename X, typename F>
+void time_convert(const std::string& name,
+                  const std::vector<X>& x,
+                  ck::ConvertRounding rounding,
+                  int repeat,
+                  F&& scalar)
+{
+    std::vector<Y> y(x.size());
+
+    const double scalar_ms = time_ms(repeat, [&] {
+        for(std::size_t i = 0; i < x.size(); ++i)
+        {
+            y[i] = scalar(x[i]);
+        }
+    });
+
+    const double bulk_ms =
+        time_ms(repeat, [&] { ck::convert_n(x.data(), y.data(), x.size(), rounding); });
+
+    // elements per ns
+    auto rate = [&](double ms) { return x.size() / (ms * 1e6); };
+
+    std::cout << name << ", " << std::fixed << std::setprecision(3) << scalar_ms << ", "
+              << rate(scalar_ms) << ", " << bulk_ms << ", " << rate(bulk_ms) << ", "
+              << std::setprecision(1) << scalar_ms / bulk_ms << std::endl;
+}
+
+} // namespace
+
+int profile_convert(int argc, char* argv[])
+{
+    if(argc > 4)
+    {
+        print_helper_msg();
+        return EXIT_FAILURE;
+    }
+
+    const std::size_t n = argc > 2 ? std::stoull(argv[2]) : std::size_t{1} << 24;
+    const int repeat    = argc > 3 ? std::stoi(argv[3]) : 5;
+
+    if(n == 0 || repeat <= 0)
+    {
+        print_helper_msg();
+        return EXIT_FAILURE;
+    }
+
+    using ck::bf8_t;
+    using ck::bhalf_t;
+    using ck::f8_t;
+    using ck::half_t;
+
+    constexpr auto Default     = ck::ConvertRounding::Default;
+    constexpr auto NearestEven = ck::ConvertRounding::NearestEven;
+
+    // values in the range of fp8, so that the rounding is exercised
+    std::vector<float> x_fp32(n);
+
+    const uint64_t seed = ck::utils::get_host_random_seed();
+
+    ck::utils::host_parallel_for(n, [&](std::size_t begin, std::size_t end) {
+        for(std::size_t i = begin; i < end; ++i)
+        {
+            const float u = ck::utils::get_uniform_float(ck::utils::get_random_uint32(seed, i));
+
+            x_fp32[i] = 480.f * u - 240.f;
+        }
+    });
+
+    std::vector<half_t> x_fp16(n);
+    std::vector<bhalf_t> x_bf16(n);
+    std::vector<f8_t> x_fp8(n);
+    std::vector<bf8_t> x_bf8(n);
+
+    ck::convert_n(x_fp32.data(), x_fp16.data(), n);
+    ck::convert_n(x_fp32.data(), x_bf16.data(), n);
+    ck::convert_n(x_fp32.data(), x_fp8.data(), n, NearestEven);
+    ck::convert_n(x_fp32.data(), x_bf8.data(), n, NearestEven);
+
+    std::cout << "conversion, scalar_ms, scalar_elem_per_ns, convert_n_ms, convert_n_elem_per_ns, "
+                 "speedup"
+              << std::endl;
+
+    time_convert<half_t>("fp32->fp16", x_fp32, Default, repeat, [](float v) {
+        return ck::type_convert<half_t>(v);
+    });
+    time_convert<bhalf_t>("fp32->bf16 rne", x_fp32, NearestEven, repeat, [](float v) {
+        return ck::bf16_convert_rtn<bhalf_t>(v);
+    });
+    time_convert<f8_t>("fp32->fp8 rne", x_fp32, NearestEven, repeat, [](float v) {
+        return ck::f8_convert_rne<f8_t>(v);
+    });
+    time_convert<bf8_t>("fp32->bf8 rne", x_fp32, NearestEven, repeat, [](float v) {
+        return ck::f8_convert_rne<bf8_t>(v);
+    });
+    time_convert<float>("fp16->fp32", x_fp16, Default, repeat, [](half_t v) {
+        return ck::type_convert<float>(v);
+    });
+    time_convert<f8_t>("fp16->fp8 rne", x_fp16, NearestEven, repeat, [](half_t v) {
+        return ck::f8_convert_rne<f8_t>(v);
+    });
+    time_convert<float>("bf16->fp32", x_bf16, Default, repeat, [](bhalf_t v) {
+        return ck::type_convert<float>(v);
+    });
+    time_convert<float>("fp8->fp32", x_fp8, Default, repeat, [](f8_t v) {
+        return ck::type_convert<float>(v);
+    });
+    time_convert<half_t>("fp8->fp16", x_fp8, Default, repeat, [](f8_t v) {
+        return ck::type_convert<half_t>(v);
+    });
+    time_convert<float>("bf8->fp32", x_bf8, Default, repeat, [](bf8_t v) {
+        return ck::type_convert<float>(v);
+    });
+
+    return EXIT_SUCCESS;
+}
+
+REGISTER_PROFILER_OPERATION(OP_NAME, OP_DESC, profile_convert);
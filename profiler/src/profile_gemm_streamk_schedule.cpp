@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "ck/library/utility/stream_k_simulator.hpp"
+
+#include "profiler_operation_registry.hpp"
+
+#define OP_NAME "gemm_streamk_schedule"
+#define OP_DESC "Simulated Stream-K GEMM schedules"
+
+static void print_helper_msg()
+{
+    std::cout << "arg1: tensor operation (" OP_NAME ": " OP_DESC ")\n"
+              << "arg2 to 4: M, N, K\n"
+              << "arg5 to 7: MPerBlock, NPerBlock, KPerBlock\n"
+              << "arg8: number of CUs\n"
+              << "arg9: occupancy (workgroups per CU)\n"
+              << "arg10: reduction strategy (0: atomic; 1: reduction)\n"
+              << std::endl;
+}
+
+int profile_gemm_streamk_schedule(int argc, char* argv[])
+{
+    if(argc != 11)
+    {
+        print_helper_msg();
+        return EXIT_FAILURE;
+    }
+
+    auto arg = [&](int i) { return static_cast<uint32_t>(std::stoul(argv[i])); };
+
+    const ck::utils::StreamKProblem problem{
+        arg(2), arg(3), arg(4), arg(5), arg(6), arg(7), arg(8), arg(9), arg(10) != 0};
+
+    if(problem.m_per_block_ == 0 || problem.n_per_block_ == 0 || problem.k_per_block_ == 0 ||
+       problem.num_cu_ == 0 || problem.occupancy_ == 0)
+    {
+        print_helper_msg();
+        return EXIT_FAILURE;
+    }
+
+    const auto result = ck::utils::tune_stream_k(problem);
+
+    std::cout << "sk_num_blocks, sk_time, dp_time, reduction_time, makespan" << std::endl;
+
+    for(const auto& candidate : result.candidates_)
+    {
+        std::cout << candidate.sk_num_blocks_ << ", " << candidate.sk_time_ << ", "
+                  << candidate.dp_time_ << ", " << candidate.reduction_time_ << ", "
+                  << candidate.makespan_ << std::endl;
+    }
+
+    // candidates_.front() is the DP-only schedule
+    const double speedup = result.candidates_.front().makespan_ / result.best_.makespan_;
+
+    std::cout << "Best: " << result.best_.sk_num_blocks_ << " SK blocks (num_sk_blocks of "
+              << "gemm_streamk), predicted speedup over DP only: " << std::setprecision(3)
+              << speedup << std::endl;
+
+    return EXIT_SUCCESS;
+}
+
+REGISTER_PROFILER_OPERATION(OP_NAME, OP_DESC, profile_gemm_streamk_schedule);
@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdlib>
+#include <iostream>
+
+#include "ck/library/utility/perf_db.hpp"
+
+#include "profiler_operation_registry.hpp"
+
+#define OP_NAME "perf_db_merge"
+#define OP_DESC "Merge perf-db files"
+
+static void print_helper_msg()
+{
+    std::cout << "arg1: tensor operation (" OP_NAME ": " OP_DESC ")\n"
+              << "arg2: output perf-db file\n"
+              << "arg3 and later: input perf-db files, the fastest record of each problem is kept\n"
+              << std::endl;
+}
+
+int profile_perf_db_merge(int argc, char* argv[])
+{
+    if(argc < 4)
+    {
+        print_helper_msg();
+        return EXIT_FAILURE;
+    }
+
+    ck::utils::PerfDb db;
+
+    for(int i = 3; i < argc; ++i)
+    {
+        if(!db.Load(argv[i]))
+        {
+            std::cerr << "cannot open perf-db " << argv[i] << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    if(!db.Save(argv[2]))
+    {
+        std::cerr << "failed to write perf-db " << argv[2] << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "merged " << argc - 3 << " files, " << db.Size() << " records" << std::endl;
+
+    return EXIT_SUCCESS;
+}
+
+REGISTER_PROFILER_OPERATION(OP_NAME, OP_DESC, profile_perf_db_merge);
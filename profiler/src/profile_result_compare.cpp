@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "ck/library/utility/profile_result.hpp"
+
+#include "profiler_operation_registry.hpp"
+
+#define OP_NAME "result_compare"
+#define OP_DESC "Compare result files for regressions"
+
+static void print_helper_msg()
+{
+    std::cout << "arg1: tensor operation (" OP_NAME ": " OP_DESC ")\n"
+              << "arg2: baseline result file\n"
+              << "arg3: current result file\n"
+              << "arg4: relative slowdown of the median time counted as a regression (default: "
+                 "0.05)\n"
+              << "returns a failure if an instance regressed or stopped passing verification\n"
+              << std::endl;
+}
+
+int profile_result_compare(int argc, char* argv[])
+{
+    if(argc != 4 && argc != 5)
+    {
+        print_helper_msg();
+        return EXIT_FAILURE;
+    }
+
+    const double threshold = argc == 5 ? std::stod(argv[4]) : 0.05;
+
+    std::vector<ck::utils::ProfileResult> results[2];
+
+    for(int i = 0; i < 2; ++i)
+    {
+        if(!ck::utils::load_profile_results(argv[i + 2], results[i]))
+        {
+            std::cerr << "cannot open result file " << argv[i + 2] << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    const auto comparisons = ck::utils::compare_profile_results(results[0], results[1], threshold);
+
+    int num_regressions = 0;
+
+    std::cout << std::fixed << std::setprecision(4);
+
+    for(const auto& comparison : comparisons)
+    {
+        const char* status = comparison.verification_regression_ ? "VERIFICATION FAILED"
+                             : comparison.regression_            ? "REGRESSION"
+                             : comparison.change_ < -threshold   ? "improved"
+                                                                 : nullptr;
+
+        if(status == nullptr)
+            continue;
+
+        num_regressions += comparison.regression_ || comparison.verification_regression_;
+
+        std::cout << status << ": " << comparison.key_ << ", median "
+                  << comparison.baseline_.median_ << " ms -> " << comparison.current_.median_
+                  << " ms (" << std::showpos << comparison.change_ * 100 << std::noshowpos << "%)"
+                  << std::endl;
+    }
+
+    std::cout << "compared " << comparisons.size() << " instances, " << num_regressions
+              << " regressions" << std::endl;
+
+    return num_regressions > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+REGISTER_PROFILER_OPERATION(OP_NAME, OP_DESC, profile_result_compare);
@@ -0,0 +1,133 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/host_random.hpp"
+#include "ck/library/utility/profile_result.hpp"
+#include "ck/library/utility/reference_cache.hpp"
+
+#include "profiler_operation_registry.hpp"
+
+#define OP_NAME "sweep"
+#define OP_DESC "Profile a list of problems in one process"
+
+static void print_helper_msg()
+{
+    std::cout << "arg1: tensor operation (" OP_NAME ": " OP_DESC ")\n"
+              << "arg2: problem file, CSV for a .csv file (operation, arguments...), JSON Lines "
+                 "otherwise ({\"op\": ..., \"args\": [...]})\n"
+              << "arg3: memory for the reference outputs reused across problems, in MiB "
+                 "(default: 4096)\n"
+              << "combine with --results <file> for one result file of the whole sweep\n"
+              << std::endl;
+}
+
+int profile_sweep(int argc, char* argv[])
+{
+    if(argc != 3 && argc != 4)
+    {
+        print_helper_msg();
+        return EXIT_FAILURE;
+    }
+
+    std::vector<ck::utils::ProfileProblem> problems;
+
+    if(!ck::utils::load_profile_problems(argv[2], problems))
+    {
+        std::cerr << "cannot open problem file " << argv[2] << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const std::size_t reference_cache_mib = argc == 4 ? std::stoull(argv[3]) : 4096;
+
+    ck::utils::get_reference_cache().SetCapacity(reference_cache_mib << 20);
+    DeviceMem::EnableCache(true);
+
+    // every problem starts from the same random streams, as if it was run on its own
+    const uint64_t seed = ck::utils::get_host_random_seed();
+
+    std::vector<int> statuses;
+    std::vector<double> seconds;
+
+    for(const auto& problem : problems)
+    {
+        std::cout << "[" << statuses.size() + 1 << "/" << problems.size() << "] " << problem.op_;
+
+        for(const auto& arg : problem.args_)
+        {
+            std::cout << " " << arg;
+        }
+
+        std::cout << std::endl;
+
+        const auto start = std::chrono::steady_clock::now();
+
+        int status = EXIT_FAILURE;
+
+        if(const auto operation = ProfilerOperationRegistry::GetInstance().Get(problem.op_);
+           !operation.has_value() || problem.op_ == OP_NAME)
+        {
+            std::cerr << "cannot find operation " << problem.op_ << std::endl;
+        }
+        else
+        {
+            // the same command line as for a single problem, argv[0] is ckProfiler
+            std::vector<std::string> args{argv[0], problem.op_};
+            args.insert(args.end(), problem.args_.begin(), problem.args_.end());
+
+            std::vector<char*> op_argv;
+
+            for(auto& arg : args)
+            {
+                op_argv.push_back(arg.data());
+            }
+
+            op_argv.push_back(nullptr);
+
+            ck::utils::set_host_random_seed(seed);
+
+            try
+            {
+                status = (*operation)(static_cast<int>(args.size()), op_argv.data());
+            }
+            catch(const std::exception& e)
+            {
+                std::cerr << "problem failed: " << e.what() << std::endl;
+            }
+        }
+
+        statuses.push_back(status);
+        seconds.push_back(
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    }
+
+    DeviceMem::EnableCache(false);
+    ck::utils::get_reference_cache().SetCapacity(0);
+
+    int num_failed = 0;
+
+    std::cout << "problem, operation, status, seconds" << std::endl;
+
+    for(std::size_t i = 0; i < problems.size(); ++i)
+    {
+        num_failed += statuses[i] != EXIT_SUCCESS;
+
+        std::cout << i + 1 << ", " << problems[i].op_ << ", "
+                  << (statuses[i] == EXIT_SUCCESS ? "pass" : "fail") << ", " << std::fixed
+                  << std::setprecision(2) << seconds[i] << std::endl;
+    }
+
+    std::cout << problems.size() << " problems, " << num_failed << " failed" << std::endl;
+
+    return num_failed > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+REGISTER_PROFILER_OPERATION(OP_NAME, OP_DESC, profile_sweep);
@@ -0,0 +1,278 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_description/tensor_descriptor.hpp"
+#include "ck/tensor_description/tensor_descriptor_helper.hpp"
+#include "ck/tensor_description/tensor_descriptor_flatten.hpp"
+
+#include "profiler_operation_registry.hpp"
+
+#define OP_NAME "tensor_descriptor"
+#define OP_DESC "Host offset calculation of tensor descriptors"
+
+static void print_helper_msg()
+{
+    std::cout << "arg1: tensor operation (" OP_NAME ": " OP_DESC ")\n"
+              << "arg2: number of repeats (default: 20)\n"
+              << std::endl;
+}
+
+namespace {
+
+using ck::index_t;
+using ck::long_index_t;
+using ck::Number;
+using ck::Sequence;
+
+// mean time of repeat calls of f, in ms
+template <typename F>
+double time_ms(int repeat, F&& f)
+{
+    f();
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for(int i = 0; i < repeat; ++i)
+    {
+        f();
+    }
+
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+               .count() /
+           repeat;
+}
+
+// visible index of the element e in the order of the lengths
+template <typename Desc>
+auto get_index(const Desc& desc, index_t e)
+{
+    constexpr index_t ndim = Desc::GetNumOfDimension();
+
+    auto idx = ck::make_zero_multi_index<ndim>();
+
+    ck::static_for<ndim, 0, -1>{}([&](auto i_p1) {
+        constexpr auto i = i_p1 - Number<1>{};
+
+        idx(i) = e % desc.GetLength(i);
+        e /= desc.GetLength(i);
+    });
+
+    return idx;
+}
+
+// sum of the offsets of all the elements, by CalculateOffset() of every index and by
+// move_tensor_coordinate() along the innermost dimension
+template <typename Desc>
+auto sum_offsets(const Desc& desc, index_t num_elem, int repeat)
+{
+    constexpr index_t ndim = Desc::GetNumOfDimension();
+
+    const index_t inner = desc.GetLength(Number<ndim - 1>{});
+
+    // the indices are decomposed up front, to time CalculateOffset() alone
+    std::vector<decltype(get_index(desc, 0))> idxs;
+
+    idxs.reserve(num_elem);
+
+    for(index_t e = 0; e < num_elem; ++e)
+    {
+        idxs.push_back(get_index(desc, e));
+    }
+
+    long_index_t sum_calculate = 0;
+    long_index_t sum_move      = 0;
+
+    const double calculate_ms = time_ms(repeat, [&] {
+        sum_calculate = 0;
+
+        for(const auto& idx : idxs)
+        {
+            sum_calculate += desc.CalculateOffset(idx);
+        }
+    });
+
+    const auto step = ck::make_tensor_coordinate_step(
+        desc,
+        ck::generate_tuple([](auto i) { return index_t{i.value == ndim - 1}; }, Number<ndim>{}));
+
+    const double move_ms = time_ms(repeat, [&] {
+        sum_move = 0;
+
+        for(index_t e = 0; e < num_elem; e += inner)
+        {
+            auto coord = ck::make_tensor_coordinate(desc, idxs[e]);
+
+            sum_move += coord.GetOffset();
+
+            for(index_t i = 1; i < inner; ++i)
+            {
+                ck::move_tensor_coordinate(desc, coord, step);
+
+                sum_move += coord.GetOffset();
+            }
+        }
+    });
+
+    return std::make_tuple(calculate_ms, move_ms, sum_calculate, sum_move);
+}
+
+// times the offsets of desc against the ones of flatten_tensor_descriptor(desc)
+template <typename Desc>
+bool time_descriptor(const std::string& name, const Desc& desc, int repeat)
+{
+    const auto flat = ck::flatten_tensor_descriptor(desc);
+
+    index_t num_elem = 1;
+
+    ck::static_for<0, Desc::GetNumOfDimension(), 1>{}(
+        [&](auto i) { num_elem *= desc.GetLength(i); });
+
+    const auto [calculate_ms, move_ms, sum_calculate, sum_move] =
+        sum_offsets(desc, num_elem, repeat);
+
+    const auto [flat_calculate_ms, flat_move_ms, flat_sum_calculate, flat_sum_move] =
+        sum_offsets(flat, num_elem, repeat);
+
+    // elements per ns
+    auto rate = [&](double ms) { return num_elem / (ms * 1e6); };
+
+    std::cout << name << ", " << Desc::GetNumOfTransform() << ", "
+              << decltype(flat)::GetNumOfTransform() << ", " << std::fixed << std::setprecision(3)
+              << rate(calculate_ms) << ", " << rate(flat_calculate_ms) << ", " << rate(move_ms)
+              << ", " << rate(flat_move_ms) << ", " << std::setprecision(1)
+              << calculate_ms / flat_calculate_ms << ", " << move_ms / flat_move_ms << std::endl;
+
+    const bool pass = sum_calculate == flat_sum_calculate && sum_move == flat_sum_move &&
+                      sum_calculate == sum_move;
+
+    if(!pass)
+    {
+        std::cout << name << ": offsets of the flattened descriptor differ" << std::endl;
+    }
+
+    return pass;
+}
+
+} // namespace
+
+int profile_tensor_descriptor(int argc, char* argv[])
+{
+    if(argc > 3)
+    {
+        print_helper_msg();
+        return EXIT_FAILURE;
+    }
+
+    const int repeat = argc > 2 ? std::stoi(argv[2]) : 20;
+
+    if(repeat <= 0)
+    {
+        print_helper_msg();
+        return EXIT_FAILURE;
+    }
+
+    constexpr auto I1 = Number<1>{};
+    constexpr auto I4 = Number<4>{};
+    constexpr auto I8 = Number<8>{};
+
+    std::cout << "descriptor, transforms, flat_transforms, calculate_offset_elem_per_ns, "
+                 "flat_calculate_offset_elem_per_ns, move_coordinate_elem_per_ns, "
+                 "flat_move_coordinate_elem_per_ns, calculate_offset_speedup, "
+                 "move_coordinate_speedup"
+              << std::endl;
+
+    bool pass = true;
+
+    // M x K row-major, K split into K0 x K1 and reordered to K0 x M x K1
+    {
+        const index_t M = 256, K0 = 64, K1 = 8;
+
+        const auto desc_m_k = ck::make_naive_tensor_descriptor(ck::make_tuple(M, K0 * K1),
+                                                               ck::make_tuple(K0 * K1, I1));
+
+        const auto desc_k0_m_k1 = ck::transform_tensor_descriptor(
+            desc_m_k,
+            ck::make_tuple(ck::make_pass_through_transform(M),
+                           ck::make_unmerge_transform(ck::make_tuple(K0, K1))),
+            ck::make_tuple(Sequence<0>{}, Sequence<1>{}),
+            ck::make_tuple(Sequence<1>{}, Sequence<0, 2>{}));
+
+        pass &= time_descriptor("gemm_k0_m_k1", desc_k0_m_k1, repeat);
+    }
+
+    // windows of an NHWC image without padding: N x Ho x Wo x Y x X x C
+    {
+        const index_t N = 4, Hi = 34, Wi = 34, C = 32, Y = 3, X = 3, Ho = 32, Wo = 32;
+
+        const auto desc_n_hi_wi_c = ck::make_naive_tensor_descriptor_packed(
+            ck::make_tuple(N, Hi, Wi, C));
+
+        const auto desc_n_y_ho_x_wo_c = ck::transform_tensor_descriptor(
+            desc_n_hi_wi_c,
+            ck::make_tuple(ck::make_pass_through_transform(N),
+                           ck::make_embed_transform(ck::make_tuple(Y, Ho), ck::make_tuple(I1, I1)),
+                           ck::make_embed_transform(ck::make_tuple(X, Wo), ck::make_tuple(I1, I1)),
+                           ck::make_pass_through_transform(C)),
+            ck::make_tuple(Sequence<0>{}, Sequence<1>{}, Sequence<2>{}, Sequence<3>{}),
+            ck::make_tuple(Sequence<0>{}, Sequence<1, 2>{}, Sequence<3, 4>{}, Sequence<5>{}));
+
+        const auto desc_n_ho_wo_y_x_c = ck::transform_tensor_descriptor(
+            desc_n_y_ho_x_wo_c,
+            ck::make_tuple(ck::make_pass_through_transform(N),
+                           ck::make_pass_through_transform(Y),
+                           ck::make_pass_through_transform(Ho),
+                           ck::make_pass_through_transform(X),
+                           ck::make_pass_through_transform(Wo),
+                           ck::make_slice_transform(C, 0, C / 2)),
+            ck::make_tuple(Sequence<0>{},
+                           Sequence<1>{},
+                           Sequence<2>{},
+                           Sequence<3>{},
+                           Sequence<4>{},
+                           Sequence<5>{}),
+            ck::make_tuple(Sequence<0>{},
+                           Sequence<3>{},
+                           Sequence<1>{},
+                           Sequence<4>{},
+                           Sequence<2>{},
+                           Sequence<5>{}));
+
+        pass &= time_descriptor("conv_n_ho_wo_y_x_c", desc_n_ho_wo_y_x_c, repeat);
+    }
+
+    // a tile merged and split again with the same lengths known at compile-time
+    {
+        const index_t M = 512;
+
+        const auto desc_m_n = ck::make_naive_tensor_descriptor(
+            ck::make_tuple(M, I4, I8), ck::make_tuple(Number<64>{}, I8, I1));
+
+        const auto desc_m_n0n1 = ck::transform_tensor_descriptor(
+            desc_m_n,
+            ck::make_tuple(ck::make_pass_through_transform(M),
+                           ck::make_merge_transform(ck::make_tuple(I4, I8))),
+            ck::make_tuple(Sequence<0>{}, Sequence<1, 2>{}),
+            ck::make_tuple(Sequence<0>{}, Sequence<1>{}));
+
+        const auto desc_m_n0_n1 = ck::transform_tensor_descriptor(
+            desc_m_n0n1,
+            ck::make_tuple(ck::make_pass_through_transform(M),
+                           ck::make_unmerge_transform(ck::make_tuple(I4, I8))),
+            ck::make_tuple(Sequence<0>{}, Sequence<1>{}),
+            ck::make_tuple(Sequence<0>{}, Sequence<1, 2>{}));
+
+        pass &= time_descriptor("merge_unmerge", desc_m_n0_n1, repeat);
+    }
+
+    return pass ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+REGISTER_PROFILER_OPERATION(OP_NAME, OP_DESC, profile_tensor_descriptor);
@@ -0,0 +1,210 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/wrapper/layout.hpp"
+#include "ck/wrapper/tensor.hpp"
+#include "ck/wrapper/operations/copy.hpp"
+#include "ck/library/utility/host_thread_group.hpp"
+
+#include "profiler_operation_registry.hpp"
+
+#define OP_NAME "wrapper_host_copy"
+#define OP_DESC "Host execution of wrapper tile copies"
+
+static void print_helper_msg()
+{
+    std::cout << "arg1: tensor operation (" OP_NAME ": " OP_DESC ")\n"
+              << "arg2: M (default: 4096)\n"
+              << "arg3: N (default: 4096)\n"
+              << "arg4: number of repeats (default: 10)\n"
+              << std::endl;
+}
+
+namespace {
+
+using ck::index_t;
+using ck::Number;
+
+// mean time of repeat calls of f, in ms
+template <typename F>
+double time_ms(int repeat, F&& f)
+{
+    f();
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for(int i = 0; i < repeat; ++i)
+    {
+        f();
+    }
+
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+               .count() /
+           repeat;
+}
+
+enum struct CopyPath
+{
+    // every thread copies its partition of the global tile, the lanes in lockstep
+    Direct,
+    // Global to LDS and LDS to Global, with a barrier in between
+    ViaLds,
+};
+
+// copies the row-major M x N matrix x to y by tiles of TileM x TileN, one block per tile and
+// ThreadM x ThreadN threads per block, and reports the bandwidth of the reads and writes
+template <index_t TileM, index_t TileN, index_t ThreadM, index_t ThreadN, bool Packed>
+bool time_copy(const std::string& name,
+               const std::vector<float>& x,
+               std::vector<float>& y,
+               index_t M,
+               index_t N,
+               CopyPath path,
+               int repeat)
+{
+    const auto layout = ck::wrapper::make_layout(ck::make_tuple(M, N), ck::make_tuple(N, 1));
+
+    const auto x_tensor = ck::wrapper::make_tensor<ck::wrapper::MemoryTypeEnum::Global>(
+        static_cast<const float*>(x.data()), layout);
+    auto y_tensor =
+        ck::wrapper::make_tensor<ck::wrapper::MemoryTypeEnum::Global>(y.data(), layout);
+
+    const auto tile_shape    = ck::make_tuple(Number<TileM>{}, Number<TileN>{});
+    const auto thread_layout = ck::make_tuple(Number<ThreadM>{}, Number<ThreadN>{});
+    // packed: each thread owns a contiguous TileM / ThreadM x TileN / ThreadN sub-tile
+    const auto thread_steps =
+        ck::make_tuple(Number<(Packed ? TileM / ThreadM : 1)>{},
+                       Number<(Packed ? TileN / ThreadN : 1)>{});
+
+    const index_t num_tile_n = N / TileN;
+    const index_t grid_size  = (M / TileM) * num_tile_n;
+
+    std::fill(y.begin(), y.end(), 0.f);
+
+    const double ms = time_ms(repeat, [&] {
+        ck::wrapper::host::launch_host_kernel(
+            grid_size, ThreadM * ThreadN, [&](const ck::wrapper::host::ThreadGroup& group) {
+                // the tiles are contiguous blocks of the matrix
+                const auto block_idxs = ck::make_tuple(group.GetBlockId() / num_tile_n,
+                                                       group.GetBlockId() % num_tile_n);
+
+                const auto x_tile =
+                    ck::wrapper::make_local_tile(x_tensor, tile_shape, block_idxs, tile_shape);
+                auto y_tile =
+                    ck::wrapper::make_local_tile(y_tensor, tile_shape, block_idxs, tile_shape);
+
+                if(path == CopyPath::Direct)
+                {
+                    ck::wrapper::host::copy(group, x_tile, y_tile, thread_layout, thread_steps);
+                    return;
+                }
+
+                float p_shared[TileM * TileN];
+                auto lds_tile = ck::wrapper::make_tensor<ck::wrapper::MemoryTypeEnum::Lds>(
+                    p_shared, ck::wrapper::make_layout(tile_shape));
+
+                group.ForEachThread([&](index_t thread_id) {
+                    const auto x_partition = ck::wrapper::make_local_partition(
+                        x_tile, thread_layout, thread_id, thread_steps);
+                    auto lds_partition = ck::wrapper::make_local_partition(
+                        lds_tile, thread_layout, thread_id, thread_steps);
+
+                    ck::wrapper::copy(x_partition, lds_partition);
+                });
+
+                group.ForEachThread([&](index_t thread_id) {
+                    const auto lds_partition = ck::wrapper::make_local_partition(
+                        lds_tile, thread_layout, thread_id, thread_steps);
+                    auto y_partition = ck::wrapper::make_local_partition(
+                        y_tile, thread_layout, thread_id, thread_steps);
+
+                    ck::wrapper::copy(lds_partition, y_partition);
+                });
+            });
+    });
+
+    const double gb_per_s = 2. * sizeof(float) * M * N / (ms * 1e6);
+
+    std::cout << name << ", " << TileM << "x" << TileN << ", " << ThreadM << "x" << ThreadN
+              << ", " << (Packed ? "packed" : "raked") << ", " << std::fixed
+              << std::setprecision(3) << ms << ", " << std::setprecision(2) << gb_per_s
+              << std::endl;
+
+    const bool pass = y == x;
+
+    if(!pass)
+    {
+        std::cout << name << ": wrong copy" << std::endl;
+    }
+
+    return pass;
+}
+
+} // namespace
+
+int profile_wrapper_host_copy(int argc, char* argv[])
+{
+    if(argc > 5)
+    {
+        print_helper_msg();
+        return EXIT_FAILURE;
+    }
+
+    const index_t M  = argc > 2 ? std::stoi(argv[2]) : 4096;
+    const index_t N  = argc > 3 ? std::stoi(argv[3]) : 4096;
+    const int repeat = argc > 4 ? std::stoi(argv[4]) : 10;
+
+    // the largest tiles below
+    if(M <= 0 || N <= 0 || M % 128 != 0 || N % 128 != 0 || repeat <= 0)
+    {
+        std::cout << "M and N must be positive multiples of 128" << std::endl;
+        print_helper_msg();
+        return EXIT_FAILURE;
+    }
+
+    std::vector<float> x(static_cast<std::size_t>(M) * N);
+    std::vector<float> y(x.size());
+
+    std::iota(x.begin(), x.end(), 0.f);
+
+    std::cout << "path, tile, threads, partition, ms, GB/s" << std::endl;
+
+    // reference: the rows copied on the host thread pool
+    const double memcpy_ms = time_ms(repeat, [&] {
+        ck::utils::host_parallel_for(M, [&](std::size_t row_begin, std::size_t row_end) {
+            std::copy(x.data() + row_begin * N, x.data() + row_end * N, y.data() + row_begin * N);
+        });
+    });
+
+    std::cout << "std::copy, -, -, -, " << std::fixed << std::setprecision(3) << memcpy_ms << ", "
+              << std::setprecision(2) << 2. * sizeof(float) * M * N / (memcpy_ms * 1e6)
+              << std::endl;
+
+    constexpr auto Direct = CopyPath::Direct;
+    constexpr auto ViaLds = CopyPath::ViaLds;
+
+    bool pass = true;
+
+    // consecutive threads along N (ThreadM = 1) access consecutive addresses of a row-major tile
+    pass &= time_copy<64, 64, 1, 64, false>("direct", x, y, M, N, Direct, repeat);
+    pass &= time_copy<64, 64, 64, 1, false>("direct", x, y, M, N, Direct, repeat);
+    pass &= time_copy<64, 64, 8, 8, true>("direct", x, y, M, N, Direct, repeat);
+    pass &= time_copy<32, 128, 1, 128, false>("direct", x, y, M, N, Direct, repeat);
+    pass &= time_copy<128, 128, 4, 64, false>("direct", x, y, M, N, Direct, repeat);
+    pass &= time_copy<64, 64, 1, 64, false>("via_lds", x, y, M, N, ViaLds, repeat);
+    pass &= time_copy<64, 64, 8, 8, true>("via_lds", x, y, M, N, ViaLds, repeat);
+
+    return pass ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+REGISTER_PROFILER_OPERATION(OP_NAME, OP_DESC, profile_wrapper_host_copy);
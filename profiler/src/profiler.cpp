@@ -2,17 +2,121 @@
 // Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
 
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
 
+#include "ck/library/utility/host_random.hpp"
+
+#include "profiler/profiler_cost_model.hpp"
+#include "profiler/profiler_perf_db.hpp"
+#include "profiler/profiler_result.hpp"
 #include "profiler_operation_registry.hpp"
 
 static void print_helper_message()
 {
     std::cout << "arg1: tensor operation " << ProfilerOperationRegistry::GetInstance() << std::endl;
+    std::cout << "--seed <value>: seed of the random tensor initialization, can be given anywhere "
+                 "on the command line (default: CK_RANDOM_SEED or 11939)"
+              << std::endl;
+    std::cout << "--perf-db <file>: record the best instance of each timed problem into a perf-db "
+                 "file, can be given anywhere on the command line"
+              << std::endl;
+    std::cout << "--results <file>: append the timing statistics and verification of every timed "
+                 "instance to a JSON Lines file, or CSV for a .csv file, can be given anywhere on "
+                 "the command line"
+              << std::endl;
+    std::cout << "--top-k <k>: only time the k supported instances ranked first by the cost model, "
+                 "can be given anywhere on the command line (default: 0, time all instances)"
+              << std::endl;
+}
+
+// removes the options shared by all operations from the command line
+static bool parse_common_options(int& argc, char* argv[])
+{
+    int num_arg = 1;
+
+    for(int i = 1; i < argc; ++i)
+    {
+        if(std::strcmp(argv[i], "--seed") == 0)
+        {
+            char* end = nullptr;
+
+            const auto seed = i + 1 < argc ? std::strtoull(argv[i + 1], &end, 0) : 0;
+
+            if(end == nullptr || end == argv[i + 1] || *end != '\0')
+            {
+                std::cerr << "invalid value for --seed" << std::endl;
+                return false;
+            }
+
+            ck::utils::set_host_random_seed(seed);
+
+            ++i;
+            continue;
+        }
+
+        if(std::strcmp(argv[i], "--top-k") == 0)
+        {
+            char* end = nullptr;
+
+            const auto top_k = i + 1 < argc ? std::strtoull(argv[i + 1], &end, 0) : 0;
+
+            if(end == nullptr || end == argv[i + 1] || *end != '\0')
+            {
+                std::cerr << "invalid value for --top-k" << std::endl;
+                return false;
+            }
+
+            ck::profiler::get_profiler_top_k() = top_k;
+
+            ++i;
+            continue;
+        }
+
+        if(std::strcmp(argv[i], "--perf-db") == 0)
+        {
+            if(i + 1 == argc)
+            {
+                std::cerr << "missing file for --perf-db" << std::endl;
+                return false;
+            }
+
+            ck::profiler::get_perf_db_record_path() = argv[i + 1];
+
+            ++i;
+            continue;
+        }
+
+        if(std::strcmp(argv[i], "--results") == 0)
+        {
+            if(i + 1 == argc)
+            {
+                std::cerr << "missing file for --results" << std::endl;
+                return false;
+            }
+
+            ck::profiler::get_profile_result_path() = argv[i + 1];
+
+            ++i;
+            continue;
+        }
+
+        argv[num_arg++] = argv[i];
+    }
+
+    argc          = num_arg;
+    argv[num_arg] = nullptr;
+
+    return true;
 }
 
 int main(int argc, char* argv[])
 {
+    if(!parse_common_options(argc, argv))
+    {
+        return EXIT_FAILURE;
+    }
+
     if(argc == 1)
     {
         print_helper_message();
@@ -1,3 +0,0 @@
-CC=g++
-
-$CC -Wall -std=c++17 -Iinclude -O3 block_swizzle_test.cpp -o block_swizzle_test.exe
\ No newline at end of file
@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <list>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/host_thread_pool.hpp"
+
+using ck::utils::ErrorSummary;
+
+TEST(CheckErr, ErrorSummary)
+{
+    std::vector<float> ref(1000, 1.f);
+    std::vector<float> out = ref;
+
+    out[7]   = std::nextafter(1.f, 2.f);
+    out[20]  = 1.25f;
+    out[500] = 1.5f;
+    out[999] = std::numeric_limits<float>::quiet_NaN();
+    out[3]   = std::numeric_limits<float>::infinity();
+    ref[3]   = std::numeric_limits<float>::infinity();
+
+    const ErrorSummary summary = ck::utils::get_error_summary(out, ref, 1e-5, 3e-6, 2);
+
+    EXPECT_FALSE(summary.Passed());
+    EXPECT_EQ(summary.num_element_, 1000);
+    EXPECT_EQ(summary.num_error_, 4);
+    EXPECT_EQ(summary.error_indices_, (std::vector<std::size_t>{3, 20}));
+    EXPECT_DOUBLE_EQ(summary.max_abs_err_, 0.5);
+    EXPECT_DOUBLE_EQ(summary.max_rel_err_, 0.5);
+    EXPECT_EQ(summary.num_out_nan_, 1);
+    EXPECT_EQ(summary.num_out_inf_, 1);
+    EXPECT_EQ(summary.num_ref_nan_, 0);
+    EXPECT_EQ(summary.num_ref_inf_, 1);
+
+    EXPECT_EQ(summary.ulp_histogram_[0], 995);
+    EXPECT_EQ(summary.ulp_histogram_[1], 1);
+    EXPECT_EQ(summary.ulp_histogram_[ErrorSummary::NumUlpBins - 1], 2);
+
+    EXPECT_FALSE(ck::utils::check_err(out, ref));
+    EXPECT_TRUE(ck::utils::check_err(out, out, "", 0, 0) == false); // NaN and Inf never pass
+    EXPECT_TRUE(ck::utils::check_err(std::vector<float>(10, 1.f), std::vector<float>(10, 1.f)));
+
+    // sequential ranges give the same result
+    const std::list<float> out_list(out.begin(), out.end());
+    const ErrorSummary list_summary = ck::utils::get_error_summary(out_list, ref, 1e-5, 3e-6, 2);
+
+    EXPECT_EQ(list_summary.num_error_, summary.num_error_);
+    EXPECT_EQ(list_summary.error_indices_, summary.error_indices_);
+    EXPECT_EQ(list_summary.ulp_histogram_, summary.ulp_histogram_);
+}
+
+TEST(CheckErr, IndependentOfNumThreads)
+{
+    std::vector<float> ref(1000003);
+    std::vector<float> out(ref.size());
+
+    for(std::size_t i = 0; i < ref.size(); ++i)
+    {
+        ref[i] = std::sin(static_cast<float>(i));
+        out[i] = ref[i] + (i % 1000 == 0 ? 1e-2f : 0.f) + (i % 7 == 0 ? 1e-7f : 0.f);
+    }
+
+    const std::size_t saved_num_threads = ck::utils::get_host_num_threads();
+
+    ck::utils::set_host_num_threads(1);
+    const ErrorSummary serial = ck::utils::get_error_summary(out, ref);
+
+    ck::utils::set_host_num_threads(8);
+    const ErrorSummary parallel = ck::utils::get_error_summary(out, ref);
+
+    ck::utils::set_host_num_threads(saved_num_threads);
+
+    EXPECT_EQ(serial.num_error_, 1001);
+    EXPECT_EQ(serial.error_indices_.size(), 16);
+    EXPECT_EQ(serial.error_indices_[1], 1000);
+
+    EXPECT_EQ(parallel.num_error_, serial.num_error_);
+    EXPECT_EQ(parallel.error_indices_, serial.error_indices_);
+    EXPECT_EQ(parallel.ulp_histogram_, serial.ulp_histogram_);
+    EXPECT_EQ(parallel.max_abs_err_, serial.max_abs_err_);
+    EXPECT_EQ(parallel.max_rel_err_, serial.max_rel_err_);
+}
+
+TEST(CheckErr, UlpDistance)
+{
+    const std::vector<ck::half_t> out{ck::half_t{1.f}, ck::half_t{-0.f}, ck::half_t{-1.f}};
+    const std::vector<ck::half_t> ref{ck::half_t{1.0009765625f}, ck::half_t{0.f}, ck::half_t{1.f}};
+
+    const ErrorSummary summary = ck::utils::get_error_summary(out, ref, 0, 0);
+
+    // -1 and 1 are 2 * 0x3c00 ulps apart
+    EXPECT_EQ(summary.ulp_histogram_[0], 1);
+    EXPECT_EQ(summary.ulp_histogram_[1], 1);
+    EXPECT_EQ(summary.ulp_histogram_[ErrorSummary::NumUlpBins - 1], 1);
+
+    const std::vector<int8_t> out_int{1, 2, 3, -128};
+    const std::vector<int8_t> ref_int{1, 2, 7, 127};
+
+    const ErrorSummary int_summary = ck::utils::get_error_summary(out_int, ref_int, 0, 0);
+
+    EXPECT_EQ(int_summary.num_error_, 2);
+    EXPECT_EQ(int_summary.ulp_histogram_[0], 2);
+    EXPECT_EQ(int_summary.ulp_histogram_[3], 1);
+    EXPECT_EQ(int_summary.ulp_histogram_[8], 1);
+
+    EXPECT_TRUE(ck::utils::check_err(out_int, ref_int, "", 0, 255));
+    EXPECT_FALSE(ck::utils::check_err(out_int, ref_int, "", 0, 4));
+}
+
+// 64-bit integers which are equal once converted to double
+TEST(CheckErr, ExactIntegers)
+{
+    const int64_t big = int64_t{1} << 60;
+
+    const std::vector<int64_t> out{big, -big, 5};
+    const std::vector<int64_t> ref{big + 1, -big, 5};
+
+    EXPECT_FALSE(ck::utils::check_err(out, ref));
+    EXPECT_TRUE(ck::utils::check_err(out, ref, "", 0, 1));
+
+    const ErrorSummary summary = ck::utils::get_error_summary(out, ref, 0, 0);
+
+    EXPECT_EQ(summary.num_error_, 1);
+    EXPECT_EQ(summary.error_indices_, (std::vector<std::size_t>{0}));
+    EXPECT_EQ(summary.ulp_histogram_[0], 2);
+    EXPECT_EQ(summary.ulp_histogram_[1], 1);
+
+    const uint64_t max = std::numeric_limits<uint64_t>::max();
+
+    const std::vector<uint64_t> out_unsigned{max, 0};
+    const std::vector<uint64_t> ref_unsigned{max - 1, max};
+
+    const ErrorSummary unsigned_summary =
+        ck::utils::get_error_summary(out_unsigned, ref_unsigned, 0, 1.5);
+
+    EXPECT_EQ(unsigned_summary.num_error_, 1);
+    EXPECT_EQ(unsigned_summary.error_indices_, (std::vector<std::size_t>{1}));
+    EXPECT_EQ(unsigned_summary.ulp_histogram_[1], 1);
+    EXPECT_EQ(unsigned_summary.ulp_histogram_[ErrorSummary::NumUlpBins - 1], 1);
+}
@@ -0,0 +1,179 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdint>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/library/utility/convert.hpp"
+
+using ck::bf8_t;
+using ck::bhalf_t;
+using ck::ConvertRounding;
+using ck::f8_t;
+using ck::half_t;
+
+namespace {
+
+template <typename T>
+auto get_bits(T x)
+{
+    if constexpr(sizeof(T) == 4)
+        return ck::bit_cast<uint32_t>(x);
+    else if constexpr(sizeof(T) == 2)
+        return ck::bit_cast<uint16_t>(x);
+    else
+        return ck::bit_cast<uint8_t>(x);
+}
+
+// every value of the 8- or 16-bit type T
+template <typename T>
+std::vector<T> make_all_values()
+{
+    using Bits = std::conditional_t<sizeof(T) == 1, uint8_t, uint16_t>;
+
+    std::vector<T> values(std::size_t{1} << (8 * sizeof(T)));
+
+    for(std::size_t i = 0; i < values.size(); ++i)
+        values[i] = ck::bit_cast<T>(static_cast<Bits>(i));
+
+    return values;
+}
+
+// Floats of all upper 16 bits, where fp8, bf8 and bf16 rounding ties may be, with the lower bits
+// around the rounding points of half_t and bf16.
+std::vector<float> make_float_values()
+{
+    const uint32_t lowers[] = {
+        0x0000, 0x0001, 0x0FFF, 0x1000, 0x1001, 0x7FFF, 0x8000, 0x8001, 0xFFFF};
+
+    std::vector<float> values;
+
+    for(uint32_t upper = 0; upper < (1u << 16); ++upper)
+        for(const uint32_t lower : lowers)
+            values.push_back(ck::bit_cast<float>((upper << 16) | lower));
+
+    return values;
+}
+
+// convert_n(x) is bit-exact with scalar(x[i], i)
+template <typename Y, typename X, typename F>
+void check_convert_n(const std::vector<X>& x, ConvertRounding rounding, F&& scalar)
+{
+    std::vector<Y> y(x.size());
+
+    ck::convert_n(x.data(), y.data(), x.size(), rounding);
+
+    std::size_t num_mismatch = 0;
+
+    for(std::size_t i = 0; i < x.size(); ++i)
+    {
+        if(get_bits(y[i]) != get_bits(scalar(x[i], i)) && num_mismatch++ < 8)
+        {
+            ADD_FAILURE() << "input bits 0x" << std::hex << +get_bits(x[i]) << ": 0x"
+                          << +get_bits(y[i]) << " instead of 0x" << +get_bits(scalar(x[i], i));
+        }
+    }
+
+    EXPECT_EQ(num_mismatch, 0);
+}
+
+// f8_convert_sr<Y>(x) seeded by the index of the element, as ConvertRounding::Stochastic
+template <typename Y, typename X>
+Y convert_stochastic(X x, std::size_t i)
+{
+    const uint32_t rng = ck::prand_generator<X, 42>(static_cast<ck::index_t>(i), x);
+
+    return ck::utils::cast_to_f8<X, Y, true, true, true>(x, rng);
+}
+
+} // namespace
+
+TEST(TestConvert, FromHalf)
+{
+    const auto x = make_all_values<half_t>();
+
+    check_convert_n<float>(x, ConvertRounding::Default, [](half_t v, auto) {
+        return ck::type_convert<float>(v);
+    });
+    check_convert_n<bhalf_t>(x, ConvertRounding::Default, [](half_t v, auto) {
+        return ck::type_convert<bhalf_t>(v);
+    });
+    check_convert_n<bhalf_t>(x, ConvertRounding::NearestEven, [](half_t v, auto) {
+        return ck::bf16_convert_rtn<bhalf_t>(v);
+    });
+    check_convert_n<f8_t>(x, ConvertRounding::NearestEven, [](half_t v, auto) {
+        return ck::f8_convert_rne<f8_t>(v);
+    });
+    check_convert_n<bf8_t>(x, ConvertRounding::NearestEven, [](half_t v, auto) {
+        return ck::f8_convert_rne<bf8_t>(v);
+    });
+    check_convert_n<f8_t>(x, ConvertRounding::Stochastic, convert_stochastic<f8_t, half_t>);
+    check_convert_n<bf8_t>(x, ConvertRounding::Stochastic, convert_stochastic<bf8_t, half_t>);
+}
+
+TEST(TestConvert, FromBhalf)
+{
+    const auto x = make_all_values<bhalf_t>();
+
+    check_convert_n<float>(x, ConvertRounding::Default, [](bhalf_t v, auto) {
+        return ck::type_convert<float>(v);
+    });
+    check_convert_n<half_t>(x, ConvertRounding::Default, [](bhalf_t v, auto) {
+        return ck::type_convert<half_t>(v);
+    });
+}
+
+TEST(TestConvert, FromF8)
+{
+    const auto f8  = make_all_values<f8_t>();
+    const auto bf8 = make_all_values<bf8_t>();
+
+    check_convert_n<float>(f8, ConvertRounding::Default, [](f8_t v, auto) {
+        return ck::type_convert<float>(v);
+    });
+    check_convert_n<half_t>(f8, ConvertRounding::Default, [](f8_t v, auto) {
+        return ck::type_convert<half_t>(v);
+    });
+    check_convert_n<float>(bf8, ConvertRounding::Default, [](bf8_t v, auto) {
+        return ck::type_convert<float>(v);
+    });
+    check_convert_n<half_t>(bf8, ConvertRounding::Default, [](bf8_t v, auto) {
+        return ck::type_convert<half_t>(v);
+    });
+}
+
+TEST(TestConvert, FromFloat)
+{
+    const auto x = make_float_values();
+
+    check_convert_n<half_t>(x, ConvertRounding::Default, [](float v, auto) {
+        return ck::type_convert<half_t>(v);
+    });
+    check_convert_n<bhalf_t>(x, ConvertRounding::Default, [](float v, auto) {
+        return ck::type_convert<bhalf_t>(v);
+    });
+    check_convert_n<bhalf_t>(x, ConvertRounding::NearestEven, [](float v, auto) {
+        return ck::bf16_convert_rtn<bhalf_t>(v);
+    });
+    check_convert_n<f8_t>(x, ConvertRounding::NearestEven, [](float v, auto) {
+        return ck::f8_convert_rne<f8_t>(v);
+    });
+    check_convert_n<bf8_t>(x, ConvertRounding::NearestEven, [](float v, auto) {
+        return ck::f8_convert_rne<bf8_t>(v);
+    });
+    check_convert_n<f8_t>(x, ConvertRounding::Stochastic, convert_stochastic<f8_t, float>);
+    check_convert_n<bf8_t>(x, ConvertRounding::Stochastic, convert_stochastic<bf8_t, float>);
+}
+
+TEST(TestConvert, Generic)
+{
+    std::vector<int8_t> x(1000);
+
+    for(std::size_t i = 0; i < x.size(); ++i)
+        x[i] = static_cast<int8_t>(i * 37);
+
+    check_convert_n<float>(x, ConvertRounding::Default, [](int8_t v, auto) {
+        return ck::type_convert<float>(v);
+    });
+}
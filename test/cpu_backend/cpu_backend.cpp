@@ -0,0 +1,246 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <array>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/tensor_operation_instance/cpu/gemm.hpp"
+#include "ck/library/tensor_operation_instance/cpu/grouped_convolution_forward.hpp"
+#include "ck/library/tensor_operation_instance/device_operation_instance_registry.hpp"
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+using Row         = ck::tensor_layout::gemm::RowMajor;
+using Col         = ck::tensor_layout::gemm::ColumnMajor;
+using GNHWC       = ck::tensor_layout::convolution::GNHWC;
+using GKYXC       = ck::tensor_layout::convolution::GKYXC;
+using GNHWK       = ck::tensor_layout::convolution::GNHWK;
+
+using ck::tensor_operation::device::instance::CpuBackend;
+
+template <typename ALayout, typename BLayout>
+using DeviceGemmF32 = ck::tensor_operation::device::
+    DeviceGemm<ALayout, BLayout, Row, float, float, float, PassThrough, PassThrough, PassThrough>;
+
+using DeviceConvFwdF32 =
+    ck::tensor_operation::device::DeviceGroupedConvFwdMultipleABD<2,
+                                                                  GNHWC,
+                                                                  GKYXC,
+                                                                  ck::Tuple<>,
+                                                                  GNHWK,
+                                                                  float,
+                                                                  float,
+                                                                  ck::Tuple<>,
+                                                                  float,
+                                                                  PassThrough,
+                                                                  PassThrough,
+                                                                  PassThrough>;
+
+template <typename Layout>
+HostTensorDescriptor make_gemm_descriptor(std::size_t rows, std::size_t cols, std::size_t stride)
+{
+    if constexpr(std::is_same_v<Layout, Row>)
+        return HostTensorDescriptor({rows, cols}, {stride, std::size_t{1}});
+    else
+        return HostTensorDescriptor({rows, cols}, {std::size_t{1}, stride});
+}
+
+// runs every CPU instance on an M x N x K problem with padded leading dimensions, by default
+// with sizes that are not multiples of the tiles
+template <typename ALayout, typename BLayout>
+void run_gemm_instances(ck::index_t M = 131,
+                        ck::index_t N = 77,
+                        ck::index_t K = 300,
+                        double rtol   = 1e-5,
+                        double atol   = 3e-6)
+{
+    using DeviceOp = DeviceGemmF32<ALayout, BLayout>;
+
+    const ck::index_t StrideA = (std::is_same_v<ALayout, Row> ? K : M) + 3;
+    const ck::index_t StrideB = (std::is_same_v<BLayout, Row> ? N : K) + 5;
+    const ck::index_t StrideC = N + 1;
+
+    Tensor<float> a_m_k(make_gemm_descriptor<ALayout>(M, K, StrideA));
+    Tensor<float> b_k_n(make_gemm_descriptor<BLayout>(K, N, StrideB));
+    Tensor<float> c_m_n(make_gemm_descriptor<Row>(M, N, StrideC));
+    Tensor<float> c_m_n_ref(make_gemm_descriptor<Row>(M, N, StrideC));
+
+    a_m_k.GenerateTensorValue(GeneratorTensor_3<float>{-1.f, 1.f});
+    b_k_n.GenerateTensorValue(GeneratorTensor_3<float>{-1.f, 1.f});
+
+    using ReferenceGemm = ck::tensor_operation::host::
+        ReferenceGemm<float, float, float, float, PassThrough, PassThrough, PassThrough>;
+
+    ReferenceGemm{}.MakeInvoker().Run(ReferenceGemm::MakeArgument(
+        a_m_k, b_k_n, c_m_n_ref, PassThrough{}, PassThrough{}, PassThrough{}));
+
+    const auto op_ptrs =
+        ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<DeviceOp,
+                                                                               CpuBackend>::
+            GetInstances();
+
+    ASSERT_FALSE(op_ptrs.empty());
+
+    for(const auto& op_ptr : op_ptrs)
+    {
+        auto argument_ptr = op_ptr->MakeArgumentPointer(a_m_k.mData.data(),
+                                                        b_k_n.mData.data(),
+                                                        c_m_n.mData.data(),
+                                                        M,
+                                                        N,
+                                                        K,
+                                                        StrideA,
+                                                        StrideB,
+                                                        StrideC,
+                                                        PassThrough{},
+                                                        PassThrough{},
+                                                        PassThrough{});
+
+        ASSERT_TRUE(op_ptr->IsSupportedArgument(argument_ptr.get()))
+            << op_ptr->GetTypeString();
+
+        c_m_n.SetZero();
+        op_ptr->MakeInvokerPointer()->Run(argument_ptr.get(), StreamConfig{nullptr, false});
+
+        EXPECT_TRUE(
+            ck::utils::check_err(c_m_n, c_m_n_ref, op_ptr->GetTypeString(), rtol, atol));
+    }
+}
+
+} // namespace
+
+TEST(TestCpuBackend, GemmRowCol) { run_gemm_instances<Row, Col>(); }
+
+TEST(TestCpuBackend, GemmColRow) { run_gemm_instances<Col, Row>(); }
+
+// a single output tile, whose reduction is split over K and summed in another order
+TEST(TestCpuBackend, GemmSplitK) { run_gemm_instances<Row, Col>(16, 16, 4096, 1e-4, 1e-3); }
+
+TEST(TestCpuBackend, GemmRejectsShortStride)
+{
+    auto& registry = ck::tensor_operation::device::instance::
+        DeviceOperationInstanceRegistry<DeviceGemmF32<Row, Row>, CpuBackend>::GetInstance();
+
+    ASSERT_GT(registry.GetNumInstances(), 0);
+
+    auto* op_ptr = registry.GetInstance(0);
+
+    std::vector<float> a(64 * 64), b(64 * 64), c(64 * 64);
+
+    // StrideA is shorter than the rows of A
+    auto argument_ptr = op_ptr->MakeArgumentPointer(a.data(),
+                                                    b.data(),
+                                                    c.data(),
+                                                    64,
+                                                    64,
+                                                    64,
+                                                    32,
+                                                    64,
+                                                    64,
+                                                    PassThrough{},
+                                                    PassThrough{},
+                                                    PassThrough{});
+
+    EXPECT_FALSE(op_ptr->IsSupportedArgument(argument_ptr.get()));
+}
+
+TEST(TestCpuBackend, GroupedConvFwd)
+{
+    const std::size_t G = 2, N = 3, C = 5, K = 6;
+    const std::size_t Hi = 9, Wi = 7, Y = 3, X = 3;
+
+    const std::vector<ck::index_t> strides{2, 1}, dilations{1, 2}, left_pads{1, 2},
+        right_pads{1, 2};
+
+    const std::size_t Ho = (Hi + 2 - 3) / 2 + 1;
+    const std::size_t Wo = (Wi + 4 - 5) / 1 + 1;
+
+    const std::size_t one = 1;
+
+    // [G, N, C, Hi, Wi] lengths in GNHWC memory order, and likewise for weight and output
+    Tensor<float> in(
+        HostTensorDescriptor({G, N, C, Hi, Wi}, {N * Hi * Wi * C, Hi * Wi * C, one, Wi * C, C}));
+    Tensor<float> wei(
+        HostTensorDescriptor({G, K, C, Y, X}, {K * Y * X * C, Y * X * C, one, X * C, C}));
+    Tensor<float> out(
+        HostTensorDescriptor({G, N, K, Ho, Wo}, {N * Ho * Wo * K, Ho * Wo * K, one, Wo * K, K}));
+    Tensor<float> out_ref(out.mDesc);
+
+    in.GenerateTensorValue(GeneratorTensor_3<float>{-1.f, 1.f});
+    wei.GenerateTensorValue(GeneratorTensor_3<float>{-1.f, 1.f});
+
+    using ReferenceConvFwd = ck::tensor_operation::host::
+        ReferenceConvFwd<2, float, float, float, PassThrough, PassThrough, PassThrough>;
+
+    ReferenceConvFwd{}.MakeInvoker().Run(ReferenceConvFwd::MakeArgument(in,
+                                                                        wei,
+                                                                        out_ref,
+                                                                        strides,
+                                                                        dilations,
+                                                                        left_pads,
+                                                                        right_pads,
+                                                                        PassThrough{},
+                                                                        PassThrough{},
+                                                                        PassThrough{}));
+
+    auto to_array = [](const auto& values) {
+        std::array<ck::index_t, 5> array;
+        std::copy(values.begin(), values.end(), array.begin());
+        return array;
+    };
+
+    auto to_params = [](const std::vector<ck::index_t>& values) {
+        return std::array<ck::index_t, 2>{values[0], values[1]};
+    };
+
+    const auto op_ptrs = ck::tensor_operation::device::instance::
+        DeviceOperationInstanceFactory<DeviceConvFwdF32, CpuBackend>::GetInstances();
+
+    ASSERT_FALSE(op_ptrs.empty());
+
+    for(const auto& op_ptr : op_ptrs)
+    {
+        auto argument_ptr = op_ptr->MakeArgumentPointer(in.mData.data(),
+                                                        wei.mData.data(),
+                                                        {},
+                                                        out.mData.data(),
+                                                        to_array(in.GetLengths()),
+                                                        to_array(in.GetStrides()),
+                                                        to_array(wei.GetLengths()),
+                                                        to_array(wei.GetStrides()),
+                                                        {},
+                                                        {},
+                                                        to_array(out.GetLengths()),
+                                                        to_array(out.GetStrides()),
+                                                        to_params(strides),
+                                                        to_params(dilations),
+                                                        to_params(left_pads),
+                                                        to_params(right_pads),
+                                                        PassThrough{},
+                                                        PassThrough{},
+                                                        PassThrough{});
+
+        ASSERT_TRUE(op_ptr->IsSupportedArgument(argument_ptr.get()))
+            << op_ptr->GetTypeString();
+
+        out.SetZero();
+
+        // with timing on, the invoker returns the mean time of the timed runs
+        const float ave_time =
+            op_ptr->MakeInvokerPointer()->Run(argument_ptr.get(), StreamConfig{nullptr, true});
+
+        EXPECT_GE(ave_time, 0);
+        EXPECT_TRUE(ck::utils::check_err(out, out_ref, op_ptr->GetTypeString()));
+    }
+}
@@ -0,0 +1,118 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/tensor_operation_instance/gpu/gemm.hpp"
+#include "ck/library/tensor_operation_instance/device_operation_instance_registry.hpp"
+
+namespace {
+
+using F16         = ck::half_t;
+using Row         = ck::tensor_layout::gemm::RowMajor;
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+using DeviceOp = ck::tensor_operation::device::
+    DeviceGemm<Row, Row, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>;
+
+using ck::tensor_operation::device::instance::DeviceOperationInstanceFactory;
+using ck::tensor_operation::device::instance::DeviceOperationInstanceMetadata;
+using ck::tensor_operation::device::instance::DeviceOperationInstanceRegistry;
+
+} // namespace
+
+TEST(DeviceOperationInstanceRegistry, MatchesFactory)
+{
+    const auto op_ptrs = DeviceOperationInstanceFactory<DeviceOp>::GetInstances();
+
+    auto& registry = DeviceOperationInstanceRegistry<DeviceOp>::GetInstance();
+
+    ASSERT_EQ(registry.GetNumInstances(), op_ptrs.size());
+
+    const auto instances = registry.GetInstances();
+
+    for(std::size_t i = 0; i < op_ptrs.size(); ++i)
+    {
+        const auto& metadata = registry.GetMetadata()[i];
+
+        EXPECT_EQ(metadata.index_, i);
+        EXPECT_EQ(metadata.type_string_, op_ptrs[i]->GetTypeString());
+        EXPECT_EQ(metadata.hash_, op_ptrs[i]->GetDescriptor().GetHash());
+        EXPECT_EQ(instances[i], registry.GetInstance(i));
+        EXPECT_EQ(registry.FindByTypeString(metadata.type_string_)->GetTypeString(),
+                  metadata.type_string_);
+        EXPECT_EQ(registry.FindByHash(metadata.hash_)->GetDescriptor().GetHash(), metadata.hash_);
+    }
+
+    EXPECT_EQ(registry.GetInstance(op_ptrs.size()), nullptr);
+    EXPECT_EQ(registry.FindByTypeString("no such instance"), nullptr);
+
+    // the instances are only constructed once
+    EXPECT_EQ(&DeviceOperationInstanceRegistry<DeviceOp>::GetInstance(), &registry);
+    EXPECT_EQ(registry.GetInstances(), instances);
+}
+
+TEST(DeviceOperationInstanceRegistry, Filter)
+{
+    auto& registry = DeviceOperationInstanceRegistry<DeviceOp>::GetInstance();
+
+    const auto all_op_ptrs = registry.GetInstances();
+
+    ASSERT_GE(all_op_ptrs.size(), 2);
+
+    // indices in the factory order of the instances returned
+    auto get_indices = [&](const std::vector<DeviceOp*>& op_ptrs) {
+        std::vector<std::size_t> indices;
+
+        for(const auto* op_ptr : op_ptrs)
+            indices.push_back(std::find(all_op_ptrs.begin(), all_op_ptrs.end(), op_ptr) -
+                              all_op_ptrs.begin());
+
+        return indices;
+    };
+
+    // every third instance, which does not depend on the descriptors
+    std::vector<std::size_t> expected_thirds;
+
+    for(std::size_t i = 0; i < all_op_ptrs.size(); i += 3)
+        expected_thirds.push_back(i);
+
+    auto is_third = [](const DeviceOperationInstanceMetadata& metadata) {
+        return metadata.index_ % 3 == 0;
+    };
+
+    EXPECT_EQ(get_indices(registry.GetInstances(is_third)), expected_thirds);
+
+    // BlockSize 256, expected from the descriptors of new instances of the factory rather than
+    // from the metadata of the registry
+    const auto op_ptrs = DeviceOperationInstanceFactory<DeviceOp>::GetInstances();
+
+    std::vector<std::size_t> expected_block_size_256;
+
+    for(std::size_t i = 0; i < op_ptrs.size(); ++i)
+    {
+        const auto descriptor  = op_ptrs[i]->GetDescriptor();
+        const auto* block_size = descriptor.Get<int64_t>("BlockSize");
+
+        if(block_size != nullptr && *block_size == 256)
+            expected_block_size_256.push_back(i);
+    }
+
+    // the filter keeps some of the instances and rejects others
+    ASSERT_GT(expected_block_size_256.size(), 0);
+    ASSERT_LT(expected_block_size_256.size(), op_ptrs.size());
+
+    auto has_block_size_256 = [](const DeviceOperationInstanceMetadata& metadata) {
+        const auto* block_size = metadata.descriptor_.Get<int64_t>("BlockSize");
+        return block_size != nullptr && *block_size == 256;
+    };
+
+    EXPECT_EQ(get_indices(registry.GetInstances(has_block_size_256)), expected_block_size_256);
+}
@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/tensor_operation_instance/gpu/gemm.hpp"
+
+namespace {
+
+using ck::tensor_operation::device::BaseOperator;
+using ck::tensor_operation::device::DeviceOperatorDescriptor;
+
+struct FakeOperator : public BaseOperator
+{
+    std::string GetTypeString() const override { return "FakeOperator<64, 32>"; }
+};
+
+DeviceOperatorDescriptor make_descriptor(int64_t block_size)
+{
+    DeviceOperatorDescriptor desc{"DeviceGemm_Xdl_CShuffle"};
+
+    desc.Add("GemmSpec", "MNKPadding")
+        .Add("BlockSize", block_size)
+        .Add("MPerBlock", 128)
+        .Add("LoopScheduler", "Default");
+
+    return desc;
+}
+
+} // namespace
+
+TEST(DeviceOperatorDescriptor, LookupAndHash)
+{
+    const auto desc = make_descriptor(256);
+
+    ASSERT_NE(desc.Get<int64_t>("BlockSize"), nullptr);
+    EXPECT_EQ(*desc.Get<int64_t>("BlockSize"), 256);
+    EXPECT_EQ(*desc.Get<std::string>("GemmSpec"), "MNKPadding");
+    EXPECT_EQ(desc.Get<std::string>("BlockSize"), nullptr);
+    EXPECT_EQ(desc.Find("NPerBlock"), nullptr);
+
+    // the hash must not change between builds, perf databases and selection indices store it
+    EXPECT_EQ(desc.GetHash(), 0x6a98419718a512f4ull);
+    EXPECT_NE(desc.GetHash(), make_descriptor(128).GetHash());
+    EXPECT_NE(desc.GetHash(), DeviceOperatorDescriptor{"DeviceGemm_Xdl_CShuffle"}.GetHash());
+}
+
+TEST(DeviceOperatorDescriptor, DefaultDescriptor)
+{
+    const auto desc = FakeOperator{}.GetDescriptor();
+
+    EXPECT_EQ(desc.name_, "FakeOperator<64, 32>");
+    EXPECT_TRUE(desc.params_.empty());
+}
+
+TEST(DeviceOperatorDescriptor, GemmInstances)
+{
+    using ck::tensor_operation::device::DeviceGemm;
+
+    using F16         = ck::half_t;
+    using Row         = ck::tensor_layout::gemm::RowMajor;
+    using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+    using DeviceOp =
+        DeviceGemm<Row, Row, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>;
+
+    const auto op_ptrs = ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<
+        DeviceOp>::GetInstances();
+
+    // instances with the same descriptor hash must be the same configuration
+    std::unordered_map<uint64_t, std::string> hash_to_type_string;
+
+    for(const auto& op_ptr : op_ptrs)
+    {
+        const auto desc = op_ptr->GetDescriptor();
+
+        EXPECT_EQ(op_ptr->GetTypeString().rfind(desc.name_, 0), 0) << op_ptr->GetTypeString();
+
+        if(!desc.params_.empty())
+        {
+            ASSERT_NE(desc.Get<int64_t>("BlockSize"), nullptr) << desc.name_;
+            EXPECT_GT(*desc.Get<int64_t>("BlockSize"), 0);
+        }
+
+        const auto [it, inserted] =
+            hash_to_type_string.emplace(desc.GetHash(), op_ptr->GetTypeString());
+
+        if(!inserted)
+            EXPECT_EQ(it->second, op_ptr->GetTypeString());
+    }
+}
@@ -0,0 +1,260 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/tensor_operation/gpu/element/quantization_operation.hpp"
+
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/literals.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_element_wise.hpp"
+
+namespace element_wise = ck::tensor_operation::element_wise;
+
+using ck::half_t;
+
+namespace {
+
+// Floats of all upper 16 bits, each with the lower 16 bits 0x0000, 0x5555 and 0xFFFF, but no NaN:
+// every sign and exponent and the ends of the mantissa ranges, not every float
+std::vector<float> make_float_values()
+{
+    const uint32_t lowers[] = {0x0000, 0x5555, 0xFFFF};
+
+    std::vector<float> values;
+
+    for(uint32_t upper = 0; upper < (1u << 16); ++upper)
+        for(const uint32_t lower : lowers)
+        {
+            const float x = ck::bit_cast<float>((upper << 16) | lower);
+
+            if(!std::isnan(x))
+                values.push_back(x);
+        }
+
+    return values;
+}
+
+// distance of a and b in floats
+int64_t ulp_distance(float a, float b)
+{
+    auto ordered = [](float v) {
+        const int32_t bits = ck::bit_cast<int32_t>(v);
+
+        return bits < 0 ? int64_t{std::numeric_limits<int32_t>::min()} - bits : int64_t{bits};
+    };
+
+    return std::abs(ordered(a) - ordered(b));
+}
+
+float ulp(float x)
+{
+    const float z = std::abs(x);
+
+    return std::nextafter(z, std::numeric_limits<float>::infinity()) - z;
+}
+
+enum struct Tolerance
+{
+    // max_ulp ulp of y
+    UlpOfY,
+    // max_ulp ulp of x, for the operations x * f(x) whose results cancel for negative x
+    UlpOfX,
+};
+
+// the float span overload of op differs from its scalar host operation by at most max_ulp
+template <typename Op>
+void check_span(const Op& op, Tolerance tolerance, int max_ulp)
+{
+    const std::vector<float> x = make_float_values();
+
+    std::vector<float> y(x.size());
+
+    op(y.data(), x.data(), x.size());
+
+    std::size_t num_mismatch = 0;
+
+    for(std::size_t i = 0; i < x.size(); ++i)
+    {
+        float y_ref;
+
+        op(y_ref, x[i]);
+
+        if(y[i] == y_ref || (std::isnan(y[i]) && std::isnan(y_ref)))
+            continue;
+
+        const bool near = tolerance == Tolerance::UlpOfY
+                              ? ulp_distance(y[i], y_ref) <= max_ulp
+                              : std::abs(y[i] - y_ref) <= max_ulp * ulp(x[i]);
+
+        if(!near && num_mismatch++ < 8)
+        {
+            ADD_FAILURE() << "x = " << x[i] << ": " << y[i] << " instead of " << y_ref;
+        }
+    }
+
+    EXPECT_EQ(num_mismatch, 0);
+}
+
+// the half_t span overload of op is the conversion of its float span overload
+template <typename Op>
+void check_span_half(const Op& op)
+{
+    const std::vector<float> x = make_float_values();
+
+    std::vector<float> y(x.size());
+    std::vector<half_t> y_half(x.size());
+
+    op(y.data(), x.data(), x.size());
+    op(y_half.data(), x.data(), x.size());
+
+    std::size_t num_mismatch = 0;
+
+    for(std::size_t i = 0; i < x.size(); ++i)
+    {
+        const half_t y_ref = ck::type_convert<half_t>(y[i]);
+
+        if(ck::bit_cast<uint16_t>(y_half[i]) != ck::bit_cast<uint16_t>(y_ref) &&
+           num_mismatch++ < 8)
+        {
+            ADD_FAILURE() << "x = " << x[i];
+        }
+    }
+
+    EXPECT_EQ(num_mismatch, 0);
+}
+
+} // namespace
+
+TEST(ElementWiseHostSpan, FastGelu) { check_span(element_wise::FastGelu{}, Tolerance::UlpOfX, 2); }
+
+TEST(ElementWiseHostSpan, Gelu) { check_span(element_wise::Gelu{}, Tolerance::UlpOfX, 2); }
+
+TEST(ElementWiseHostSpan, Sigmoid) { check_span(element_wise::Sigmoid{}, Tolerance::UlpOfY, 4); }
+
+TEST(ElementWiseHostSpan, TanH) { check_span(element_wise::TanH{}, Tolerance::UlpOfY, 3); }
+
+TEST(ElementWiseHostSpan, Swish)
+{
+    check_span(element_wise::Swish{}, Tolerance::UlpOfY, 4);
+    check_span(element_wise::Swish{0.5f}, Tolerance::UlpOfY, 4);
+}
+
+TEST(ElementWiseHostSpan, Half)
+{
+    check_span_half(element_wise::FastGelu{});
+    check_span_half(element_wise::Gelu{});
+    check_span_half(element_wise::Sigmoid{});
+    check_span_half(element_wise::TanH{});
+    check_span_half(element_wise::Swish{});
+}
+
+TEST(ElementWiseHostSpan, Requantization)
+{
+    using Relu = element_wise::Relu;
+
+    const element_wise::Activation_Mul_Clamp<Relu> op{0.01f, Relu{}};
+    const element_wise::Add_Activation_Mul2_Clamp<Relu> op_bias{Relu{}};
+
+    constexpr std::size_t n = 1000;
+
+    std::vector<int32_t> x(n);
+    std::vector<int32_t> bias(n);
+    std::vector<float> scale(n);
+
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        x[i]     = static_cast<int32_t>(i * 37 % 40000) - 20000;
+        bias[i]  = static_cast<int32_t>(i * 11 % 1000) - 500;
+        scale[i] = 0.001f * static_cast<float>(i % 20 + 1);
+    }
+
+    std::vector<int8_t> y(n);
+    std::vector<int8_t> y_bias(n);
+
+    op(y.data(), x.data(), n);
+    op_bias(y_bias.data(), x.data(), bias.data(), scale.data(), n);
+
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        int8_t y_ref;
+        int8_t y_bias_ref;
+
+        op(y_ref, x[i]);
+        op_bias(y_bias_ref, x[i], bias[i], scale[i]);
+
+        EXPECT_EQ(y[i], y_ref) << "i = " << i;
+        EXPECT_EQ(y_bias[i], y_bias_ref) << "i = " << i;
+    }
+}
+
+// broadcast and transposed tensors go through the per-element loop, contiguous rows through the
+// span overloads
+TEST(ElementWiseHostSpan, ReferenceElementWise)
+{
+    using namespace ck::literals;
+
+    constexpr std::size_t N = 3;
+    constexpr std::size_t H = 5;
+    constexpr std::size_t K = 70;
+
+    // y in NHK, c in NKH, d broadcast along N and H
+    Tensor<float> y(HostTensorDescriptor({N, H, K}, {H * K, K, 1_uz}));
+    Tensor<float> c(HostTensorDescriptor({N, H, K}, {H * K, 1_uz, H}));
+    Tensor<float> c_nhk(HostTensorDescriptor({N, H, K}, {H * K, K, 1_uz}));
+    Tensor<float> d(HostTensorDescriptor({N, H, K}, {0_uz, 0_uz, 1_uz}));
+
+    c.ForEach([](auto& self, auto idx) {
+        self(idx) = 0.1f * static_cast<float>(idx[0] * 31 + idx[1] * 7 + idx[2]) - 8.f;
+    });
+    c_nhk.ForEach([&](auto& self, auto idx) { self(idx) = c(idx); });
+    d.ForEach([](auto& self, auto idx) { self(idx) = 0.05f * static_cast<float>(idx[2]); });
+
+    const element_wise::Add add{};
+    const element_wise::AddFastGelu add_fast_gelu{};
+
+    ck::tensor_operation::host::reference_element_wise(add, y, c, d);
+
+    y.ForEach([&](auto& self, auto idx) {
+        float y_ref;
+
+        add(y_ref, c(idx), d(idx));
+
+        EXPECT_EQ(self(idx), y_ref);
+    });
+
+    ck::tensor_operation::host::reference_element_wise(add_fast_gelu, y, c_nhk, d);
+
+    y.ForEach([&](auto& self, auto idx) {
+        float y_ref;
+
+        add_fast_gelu(y_ref, c_nhk(idx), d(idx));
+
+        EXPECT_LE(std::abs(self(idx) - y_ref), 2 * ulp(c_nhk(idx) + d(idx)));
+    });
+}
+
+TEST(ElementWiseHostSpan, ReferenceElementWiseScalar)
+{
+    const HostTensorDescriptor scalar_desc{std::vector<std::size_t>{}};
+
+    Tensor<float> y(scalar_desc);
+    Tensor<float> c(scalar_desc);
+    Tensor<float> d(scalar_desc);
+
+    ASSERT_EQ(y.mDesc.GetNumOfDimension(), 0);
+    ASSERT_EQ(y.mData.size(), 1);
+
+    c.mData[0] = 1.5f;
+    d.mData[0] = -0.25f;
+
+    ck::tensor_operation::host::reference_element_wise(element_wise::Add{}, y, c, d);
+
+    EXPECT_EQ(y.mData[0], 1.25f);
+}
@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <array>
+#include <atomic>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/library/utility/host_common_util.hpp"
+#include "ck/library/utility/host_thread_pool.hpp"
+
+using ck::index_t;
+
+namespace {
+
+// index tuples of lengths listed by nested loops, i.e. in row-major order
+std::vector<std::array<index_t, 4>> make_row_major_indices(const std::array<index_t, 4>& lengths)
+{
+    std::vector<std::array<index_t, 4>> indices;
+
+    for(index_t i0 = 0; i0 < lengths[0]; ++i0)
+        for(index_t i1 = 0; i1 < lengths[1]; ++i1)
+            for(index_t i2 = 0; i2 < lengths[2]; ++i2)
+                for(index_t i3 = 0; i3 < lengths[3]; ++i3)
+                    indices.push_back({i0, i1, i2, i3});
+
+    return indices;
+}
+
+} // namespace
+
+TEST(HostCommonUtil, IndexFromLinearOffset)
+{
+    const std::array<index_t, 4> lengths{3, 1, 4, 2};
+
+    const auto indices = make_row_major_indices(lengths);
+
+    ASSERT_EQ(ck::host_common::get_index_count<4>(lengths), indices.size());
+
+    std::array<index_t, 4> stepped{};
+
+    for(std::size_t i = 0; i < indices.size(); ++i)
+    {
+        EXPECT_EQ(ck::host_common::get_index_from_linear_offset<4>(lengths, i), indices[i])
+            << "i = " << i;
+        EXPECT_EQ(stepped, indices[i]) << "i = " << i;
+
+        ck::host_common::step_index<4>(lengths, stepped);
+    }
+}
+
+TEST(HostCommonUtil, ForEachIndexOffset)
+{
+    const std::array<index_t, 4> lengths{3, 1, 4, 2};
+    const std::array<index_t, 4> strides_a{8, 8, 2, 1};
+    const std::array<index_t, 4> strides_b{1, 0, 9, 3};
+
+    const auto indices = make_row_major_indices(lengths);
+
+    std::size_t count = 0;
+
+    ck::host_common::for_each_index_offset<4>(
+        lengths,
+        [&](std::size_t i, std::size_t offset_a, std::size_t offset_b) {
+            ASSERT_EQ(i, count);
+
+            EXPECT_EQ(offset_a, ck::host_common::get_offset_from_index<4>(strides_a, indices[i]))
+                << "i = " << i;
+            EXPECT_EQ(offset_b, ck::host_common::get_offset_from_index<4>(strides_b, indices[i]))
+                << "i = " << i;
+
+            ++count;
+        },
+        strides_a,
+        strides_b);
+
+    EXPECT_EQ(count, indices.size());
+}
+
+TEST(HostCommonUtil, ParallelForEachIndex)
+{
+    const std::array<index_t, 3> lengths{7, 13, 11};
+    const std::array<index_t, 3> strides{143, 11, 1};
+
+    std::vector<std::atomic<int>> visits(7 * 13 * 11);
+
+    ck::host_common::parallel_for_each_index<3>(lengths, [&](const std::array<index_t, 3>& index) {
+        visits[ck::host_common::get_offset_from_index<3>(strides, index)]++;
+    });
+
+    for(std::size_t i = 0; i < visits.size(); ++i)
+        EXPECT_EQ(visits[i], 1) << "i = " << i;
+}
@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdint>
+#include <list>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_random.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/utility/host_thread_pool.hpp"
+
+using ck::utils::Philox4x32;
+
+TEST(HostRandom, Philox4x32)
+{
+    // known answers from the Random123 library
+    EXPECT_EQ(Philox4x32::Generate({0, 0, 0, 0}, {0, 0}),
+              (Philox4x32::Counter{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}));
+    EXPECT_EQ(Philox4x32::Generate({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+                                   {0xffffffff, 0xffffffff}),
+              (Philox4x32::Counter{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}));
+    EXPECT_EQ(Philox4x32::Generate({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344},
+                                   {0xa4093822, 0x299f31d0}),
+              (Philox4x32::Counter{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}));
+}
+
+TEST(HostRandom, Streams)
+{
+    std::vector<uint32_t> u(1001);
+    ck::utils::for_each_random_uint32(7, 3, u.size(), [&](uint64_t i, uint32_t v) { u[i] = v; });
+
+    for(std::size_t i = 3; i < u.size(); ++i)
+        EXPECT_EQ(u[i], ck::utils::get_random_uint32(7, i));
+
+    for(uint32_t v : {0u, 1u, 0x7fffffffu, 0xffffffffu})
+    {
+        const int x = ck::utils::get_uniform_int(v, -5, 5);
+        EXPECT_TRUE(x >= -5 && x < 5);
+
+        const float y = ck::utils::get_uniform_float(v);
+        EXPECT_TRUE(y >= 0.f && y < 1.f);
+    }
+
+    const uint64_t saved_seed = ck::utils::get_host_random_seed();
+
+    ck::utils::set_host_random_seed(42);
+    const uint64_t s0 = ck::utils::make_random_seed();
+    const uint64_t s1 = ck::utils::make_random_seed();
+
+    ck::utils::set_host_random_seed(42);
+    EXPECT_EQ(ck::utils::make_random_seed(), s0);
+    EXPECT_EQ(ck::utils::make_random_seed(), s1);
+    EXPECT_NE(s0, s1);
+
+    // the seed is kept
+    ck::utils::restart_random_streams();
+    EXPECT_EQ(ck::utils::get_host_random_seed(), 42);
+    EXPECT_EQ(ck::utils::make_random_seed(), s0);
+
+    ck::utils::set_host_random_seed(saved_seed);
+}
+
+class TestHostRandomFill : public ::testing::TestWithParam<std::size_t>
+{
+    protected:
+    void SetUp() override
+    {
+        saved_num_threads_ = ck::utils::get_host_num_threads();
+        ck::utils::set_host_num_threads(GetParam());
+    }
+
+    void TearDown() override { ck::utils::set_host_num_threads(saved_num_threads_); }
+
+    std::size_t saved_num_threads_;
+};
+
+TEST_P(TestHostRandomFill, FillUniformDistribution)
+{
+    const uint64_t seed = 1234;
+
+    std::vector<float> x(100003);
+    ck::utils::FillUniformDistribution<float>{-2.f, 3.f, seed}(x);
+
+    std::vector<int> y(x.size());
+    ck::utils::FillUniformDistributionIntegerValue<int>{-5.f, 5.f, seed}(y);
+
+    for(std::size_t i = 0; i < x.size(); ++i)
+    {
+        const float u = ck::utils::get_uniform_float(ck::utils::get_random_uint32(seed, i));
+
+        ASSERT_EQ(x[i], -2.f + 5.f * u);
+        ASSERT_TRUE(y[i] >= -5 && y[i] <= 5);
+    }
+
+    // sequential ranges get the same values
+    std::list<float> z(x.size());
+    ck::utils::FillUniformDistribution<float>{-2.f, 3.f, seed}(z);
+
+    EXPECT_TRUE(std::equal(x.begin(), x.end(), z.begin()));
+}
+
+TEST_P(TestHostRandomFill, GenerateTensorValue)
+{
+    Tensor<float> t2({17, 33, 5});
+    Tensor<float> t3({17, 33, 5});
+
+    t2.GenerateTensorValue(GeneratorTensor_2<float>{-5, 5, 99}, GetParam());
+    t3.GenerateTensorValue(GeneratorTensor_3<float>{-1.f, 1.f, 99}, GetParam());
+
+    for(std::size_t i0 = 0; i0 < 17; ++i0)
+        for(std::size_t i1 = 0; i1 < 33; ++i1)
+            for(std::size_t i2 = 0; i2 < 5; ++i2)
+            {
+                const uint32_t u = ck::utils::get_random_uint32_at(99, i0, i1, i2);
+
+                ASSERT_EQ(t2(i0, i1, i2), ck::utils::get_uniform_int(u, -5, 5));
+                ASSERT_EQ(t3(i0, i1, i2), -1.f + 2.f * ck::utils::get_uniform_float(u));
+            }
+}
+
+INSTANTIATE_TEST_SUITE_P(HostRandom, TestHostRandomFill, ::testing::Values(1, 2, 8));
@@ -0,0 +1,63 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <array>
+#include <numeric>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace {
+
+constexpr HostTensorDescriptorN<3> packed_desc({2, 3, 4});
+constexpr HostTensorDescriptorN<3> strided_desc({2, 3, 4}, {1, 8, 2});
+
+static_assert(packed_desc.GetStrides()[0] == 12 && packed_desc.GetStrides()[1] == 4 &&
+              packed_desc.GetStrides()[2] == 1);
+static_assert(packed_desc.IsPacked() && !strided_desc.IsPacked());
+static_assert(packed_desc.GetElementSize() == 24 && packed_desc.GetElementSpaceSize() == 24);
+static_assert(strided_desc.GetElementSpaceSize() == 24);
+static_assert(packed_desc.GetOffsetFromMultiIndex(1, 2, 3) == 23);
+static_assert(strided_desc.GetOffsetFromLinearIndex(23) == 1 + 16 + 6);
+
+} // namespace
+
+TEST(TestHostTensorDescriptor, DynamicRankRoundTrip)
+{
+    const HostTensorDescriptor desc({5, 6, 7}, {1, 35, 5});
+
+    const HostTensorDescriptorN<3> desc_n(desc);
+    EXPECT_FALSE(desc_n.IsPacked());
+    EXPECT_FALSE(desc.IsPacked());
+    EXPECT_EQ(desc_n.GetOffsetFromMultiIndex(4, 5, 6), desc.GetOffsetFromMultiIndex(4, 5, 6));
+
+    const HostTensorDescriptor round_trip = desc_n;
+    EXPECT_EQ(round_trip.GetLengths(), desc.GetLengths());
+    EXPECT_EQ(round_trip.GetStrides(), desc.GetStrides());
+
+    EXPECT_TRUE(HostTensorDescriptor({5, 1, 7}, {7, 100, 1}).IsPacked());
+    EXPECT_THROW(HostTensorDescriptorN<2>{desc}, std::runtime_error);
+}
+
+TEST(TestHostTensorDescriptor, ForEachElementMatchesForEach)
+{
+    for(const auto& desc : {HostTensorDescriptor({3, 4, 5}),
+                            HostTensorDescriptor({3, 4, 5}, {1, 15, 3}),
+                            HostTensorDescriptor({3, 4, 5}, {40, 10, 2})})
+    {
+        Tensor<int> tensor(desc);
+        std::iota(tensor.begin(), tensor.end(), 0);
+
+        std::vector<int> expected;
+        tensor.ForEach([&](auto& self, auto idx) { expected.push_back(self(idx)); });
+
+        std::vector<int> values;
+        tensor.ForEachElement<3>([&](int& value, const std::array<std::size_t, 3>& idx) {
+            EXPECT_EQ(&value, &tensor(idx));
+            values.push_back(value);
+        });
+
+        EXPECT_EQ(values, expected);
+    }
+}
@@ -0,0 +1,164 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <numeric>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_view.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+// copies the elements of a view into a packed tensor
+template <typename T>
+Tensor<std::remove_const_t<T>> materialize(const TensorView<T>& view)
+{
+    Tensor<std::remove_const_t<T>> tensor(view.GetLengths());
+
+    std::copy(view.begin(), view.end(), tensor.begin());
+
+    return tensor;
+}
+
+} // namespace
+
+TEST(TestHostTensorView, WrapsExternalBuffer)
+{
+    std::vector<float> buffer(12);
+    std::iota(buffer.begin(), buffer.end(), 0.f);
+
+    const auto view = make_tensor_view(buffer.data(), HostTensorDescriptor({3, 4}));
+
+    EXPECT_TRUE(view.IsPacked());
+    EXPECT_EQ(view.size(), 12);
+    EXPECT_EQ(view(2, 1), 9.f);
+
+    view(0, 3) = -1.f;
+    EXPECT_EQ(buffer[3], -1.f);
+}
+
+TEST(TestHostTensorView, SliceTransposeBroadcast)
+{
+    Tensor<int> tensor({3, 4, 5});
+    std::iota(tensor.begin(), tensor.end(), 0);
+
+    const auto view = make_tensor_view(tensor);
+
+    const auto slice = view.Slice(1, 1, 3);
+    EXPECT_EQ(slice.GetLengths(), (std::vector<std::size_t>{3, 2, 5}));
+    EXPECT_FALSE(slice.IsPacked());
+    EXPECT_EQ(slice(2, 1, 4), tensor(2, 2, 4));
+    EXPECT_TRUE(view.Slice(0, 1, 2).IsPacked());
+
+    const auto transposed = view.Transpose(std::vector<std::size_t>{2, 0, 1});
+    EXPECT_EQ(transposed.GetLengths(), (std::vector<std::size_t>{5, 3, 4}));
+    EXPECT_EQ(transposed(4, 1, 2), tensor(1, 2, 4));
+
+    const auto row       = view.Slice(0, 1, 2).Slice(1, 0, 1);
+    const auto broadcast = row.Broadcast(std::vector<std::size_t>{2, 3, 4, 5});
+    EXPECT_EQ(broadcast.size(), 120);
+    EXPECT_EQ(broadcast(1, 2, 3, 4), tensor(1, 0, 4));
+
+    // the range order is the row-major index order of the view
+    std::size_t i = 0;
+    for(int v : transposed)
+    {
+        const std::size_t d0 = i / 12, d1 = i / 4 % 3, d2 = i % 4;
+        EXPECT_EQ(v, tensor(d1, d2, d0));
+        ++i;
+    }
+
+    EXPECT_THROW(view.Slice(1, 2, 5), std::runtime_error);
+    EXPECT_THROW(view.Broadcast(std::vector<std::size_t>{3, 2, 5}), std::runtime_error);
+}
+
+// the iterators hold the pointer and the descriptor, so they outlive a temporary view
+TEST(TestHostTensorView, IteratorsOfTemporaryView)
+{
+    Tensor<int> tensor({4, 6});
+    std::iota(tensor.begin(), tensor.end(), 0);
+
+    const std::vector<std::size_t> new2old{1, 0};
+
+    const auto first = make_tensor_view(tensor).Transpose(new2old).begin();
+    const auto last  = make_tensor_view(tensor).Transpose(new2old).end();
+
+    const std::vector<int> transposed(first, last);
+
+    ASSERT_EQ(transposed.size(), 24);
+
+    for(std::size_t i = 0; i < 4; ++i)
+        for(std::size_t j = 0; j < 6; ++j)
+            EXPECT_EQ(transposed[j * 4 + i], tensor(i, j));
+}
+
+TEST(TestHostTensorView, FillAndCheckErrOnStridedView)
+{
+    Tensor<float> tensor({16, 8});
+    ck::utils::FillConstant<float>{7.f}(tensor);
+
+    const auto column = make_tensor_view(tensor).Slice(1, 3, 4);
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(column);
+
+    for(std::size_t m = 0; m < 16; ++m)
+        for(std::size_t n = 0; n < 8; ++n)
+        {
+            if(n == 3)
+                EXPECT_LE(std::abs(tensor(m, n)), 1.f);
+            else
+                EXPECT_EQ(tensor(m, n), 7.f);
+        }
+
+    auto copy = materialize(column);
+    EXPECT_TRUE(ck::utils::check_err(column, copy, "Error: view != copy", 0, 0));
+
+    copy.mData[5] += 1.f;
+    EXPECT_FALSE(ck::utils::check_err(column, copy, "Error: view != copy", 0, 0));
+}
+
+TEST(TestHostTensorView, ReferenceGemmOnViews)
+{
+    const std::size_t M = 13, N = 9, K = 17;
+
+    // A is the transpose of a K x M tensor, B and C are column slices of wider tensors
+    Tensor<float> a_k_m({K, M});
+    Tensor<float> b_k_2n({K, 2 * N});
+    Tensor<float> c_m_2n({M, 2 * N});
+
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(a_k_m);
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(b_k_2n);
+    c_m_2n.SetZero();
+
+    const auto a_m_k = make_tensor_view(a_k_m).Transpose(std::vector<std::size_t>{1, 0});
+    const auto b_k_n = make_tensor_view(b_k_2n).Slice(1, N, 2 * N);
+    const auto c_m_n = make_tensor_view(c_m_2n).Slice(1, 0, N);
+
+    using ReferenceGemmInstance = ck::tensor_operation::host::
+        ReferenceGemm<float, float, float, float, PassThrough, PassThrough, PassThrough>;
+
+    ReferenceGemmInstance::MakeInvoker().Run(ReferenceGemmInstance::MakeArgument(
+        a_m_k, b_k_n, c_m_n, PassThrough{}, PassThrough{}, PassThrough{}));
+
+    const auto a_copy = materialize(a_m_k);
+    const auto b_copy = materialize(b_k_n);
+    Tensor<float> c_copy({M, N});
+
+    ReferenceGemmInstance::MakeInvoker().Run(ReferenceGemmInstance::MakeArgument(
+        a_copy, b_copy, c_copy, PassThrough{}, PassThrough{}, PassThrough{}));
+
+    EXPECT_TRUE(ck::utils::check_err(c_m_n, c_copy, "Error: gemm on views", 0, 0));
+
+    // the other half of C is untouched
+    for(std::size_t m = 0; m < M; ++m)
+        for(std::size_t n = N; n < 2 * N; ++n)
+            EXPECT_EQ(c_m_2n(m, n), 0.f);
+}
@@ -0,0 +1,118 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_thread_pool.hpp"
+
+namespace {
+
+class TestHostThreadPool : public ::testing::TestWithParam<std::size_t>
+{
+    protected:
+    void SetUp() override
+    {
+        saved_num_threads_ = ck::utils::get_host_num_threads();
+        ck::utils::set_host_num_threads(GetParam());
+    }
+
+    void TearDown() override { ck::utils::set_host_num_threads(saved_num_threads_); }
+
+    std::size_t saved_num_threads_;
+};
+
+} // namespace
+
+TEST_P(TestHostThreadPool, CoversRangeOnce)
+{
+    for(std::size_t n : {0, 1, 7, 1000, 123457})
+    {
+        std::vector<std::atomic<int>> visits(n);
+
+        ck::utils::host_parallel_for(n, [&](std::size_t begin, std::size_t end) {
+            for(std::size_t i = begin; i < end; ++i)
+                visits[i]++;
+        });
+
+        for(std::size_t i = 0; i < n; ++i)
+            EXPECT_EQ(visits[i], 1) << "n = " << n << ", i = " << i;
+    }
+}
+
+TEST_P(TestHostThreadPool, Grain)
+{
+    std::atomic<std::size_t> count{0};
+
+    ck::utils::host_parallel_for(
+        1000,
+        [&](std::size_t begin, std::size_t end) {
+            EXPECT_TRUE(end - begin >= 100 || end == 1000);
+            count += end - begin;
+        },
+        0,
+        100);
+
+    EXPECT_EQ(count, 1000);
+}
+
+TEST_P(TestHostThreadPool, NestedLoopRunsSerially)
+{
+    std::atomic<std::size_t> sum{0};
+
+    ck::utils::host_parallel_for(64, [&](std::size_t begin, std::size_t end) {
+        for(std::size_t i = begin; i < end; ++i)
+            ck::utils::host_parallel_for(i, [&](std::size_t b, std::size_t e) { sum += e - b; });
+    });
+
+    EXPECT_EQ(sum, 64 * 63 / 2);
+}
+
+TEST_P(TestHostThreadPool, PropagatesException)
+{
+    EXPECT_THROW(ck::utils::host_parallel_for(100,
+                                              [&](std::size_t begin, std::size_t) {
+                                                  if(begin == 0)
+                                                      throw std::runtime_error("error");
+                                              }),
+                 std::runtime_error);
+
+    // the pool stays usable afterwards
+    std::atomic<std::size_t> count{0};
+    ck::utils::host_parallel_for(100, [&](std::size_t begin, std::size_t end) {
+        count += end - begin;
+    });
+    EXPECT_EQ(count, 100);
+}
+
+TEST_P(TestHostThreadPool, SetNumThreadsFromTaskThrows)
+{
+    // with one thread the loop runs inline, outside of the pool
+    if(GetParam() == 1)
+        return;
+
+    EXPECT_THROW(ck::utils::host_parallel_for(
+                     100, [&](std::size_t, std::size_t) { ck::utils::set_host_num_threads(1); }),
+                 std::logic_error);
+
+    EXPECT_EQ(ck::utils::get_host_num_threads(), GetParam());
+}
+
+TEST_P(TestHostThreadPool, ParallelTensorFunctor)
+{
+    Tensor<int> t({3, 5, 7, 2});
+
+    auto f = [&](auto i0, auto i1, auto i2, auto i3) {
+        t(i0, i1, i2, i3) = ((i0 * 5 + i1) * 7 + i2) * 2 + i3;
+    };
+
+    make_ParallelTensorFunctor(f, 3, 5, 7, 2)(std::thread::hardware_concurrency());
+
+    for(std::size_t i = 0; i < t.mData.size(); ++i)
+        EXPECT_EQ(t.mData[i], static_cast<int>(i));
+}
+
+INSTANTIATE_TEST_SUITE_P(HostThreadPool, TestHostThreadPool, ::testing::Values(1, 2, 3, 8));
@@ -0,0 +1,137 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+
+#include "ck/library/utility/instance_cost_model.hpp"
+
+namespace {
+
+using ck::tensor_operation::device::BaseOperator;
+using ck::tensor_operation::device::DeviceOperatorDescriptor;
+using ck::utils::GemmCostModelProblem;
+
+DeviceOperatorDescriptor make_gemm_descriptor(const std::string& gemm_spec,
+                                              int64_t block_size,
+                                              int64_t m_per_block,
+                                              int64_t n_per_block,
+                                              int64_t k_per_block)
+{
+    DeviceOperatorDescriptor desc{"DeviceGemm_Xdl_CShuffle"};
+
+    desc.Add("GemmSpec", gemm_spec)
+        .Add("BlockSize", block_size)
+        .Add("MPerBlock", m_per_block)
+        .Add("NPerBlock", n_per_block)
+        .Add("KPerBlock", k_per_block)
+        .Add("ABlockTransferSrcScalarPerVector", 8)
+        .Add("BBlockTransferSrcScalarPerVector", 8);
+
+    return desc;
+}
+
+struct FakeOperator : public BaseOperator
+{
+    explicit FakeOperator(DeviceOperatorDescriptor desc) : desc_(std::move(desc)) {}
+
+    DeviceOperatorDescriptor GetDescriptor() const override { return desc_; }
+
+    DeviceOperatorDescriptor desc_;
+};
+
+} // namespace
+
+TEST(InstanceCostModel, TileConfig)
+{
+    const auto config =
+        ck::utils::get_gemm_tile_config(make_gemm_descriptor("MNPadding", 256, 256, 128, 32));
+
+    ASSERT_TRUE(config.has_value());
+    EXPECT_EQ(config->block_size_, 256);
+    EXPECT_EQ(config->m_per_block_, 256);
+    EXPECT_EQ(config->n_per_block_, 128);
+    EXPECT_EQ(config->k_per_block_, 32);
+    EXPECT_TRUE(config->pad_m_);
+    EXPECT_TRUE(config->pad_n_);
+    EXPECT_FALSE(config->pad_k_);
+    EXPECT_EQ(config->a_scalar_per_vector_, 8);
+
+    DeviceOperatorDescriptor xdl_desc{"DeviceGemmXdl"};
+    xdl_desc.Add("GemmSpec", "Default")
+        .Add("BlockSize", 256)
+        .Add("MPerBlock", 128)
+        .Add("NPerBlock", 128)
+        .Add("K0PerBlock", 4)
+        .Add("K1", 8);
+
+    const auto xdl_config = ck::utils::get_gemm_tile_config(xdl_desc);
+
+    ASSERT_TRUE(xdl_config.has_value());
+    EXPECT_EQ(xdl_config->k_per_block_, 32);
+    EXPECT_FALSE(xdl_config->pad_m_);
+
+    // no tile sizes
+    EXPECT_FALSE(ck::utils::get_gemm_tile_config(DeviceOperatorDescriptor{"DeviceGemmFoo<...>"}));
+}
+
+TEST(InstanceCostModel, Estimate)
+{
+    const auto config_default =
+        *ck::utils::get_gemm_tile_config(make_gemm_descriptor("Default", 256, 128, 128, 32));
+    const auto config_padded =
+        *ck::utils::get_gemm_tile_config(make_gemm_descriptor("MNKPadding", 256, 128, 128, 32));
+
+    // not a multiple of the tile and no padding
+    const GemmCostModelProblem problem{1000, 1024, 1024};
+
+    EXPECT_FALSE(ck::utils::estimate_gemm_time(config_default, problem));
+    EXPECT_TRUE(ck::utils::estimate_gemm_time(config_padded, problem));
+
+    ck::utils::GemmCostModelDevice device;
+    device.num_cu_ = 8;
+
+    // with one tile more than twice the CUs, some CUs run three tiles instead of two
+    const double two_tiles_per_cu = *ck::utils::estimate_gemm_time(
+        config_padded, GemmCostModelProblem{128 * 16, 128, 1024}, device);
+    const double one_more_tile = *ck::utils::estimate_gemm_time(
+        config_padded, GemmCostModelProblem{128 * 17, 128, 1024}, device);
+
+    EXPECT_DOUBLE_EQ(one_more_tile, two_tiles_per_cu * 1.5);
+
+    // a large tile wastes most of its work on a small problem
+    const auto config_large =
+        *ck::utils::get_gemm_tile_config(make_gemm_descriptor("MNKPadding", 256, 256, 256, 32));
+
+    EXPECT_LT(*ck::utils::estimate_gemm_time(config_padded, GemmCostModelProblem{128, 128, 4096}),
+              *ck::utils::estimate_gemm_time(config_large, GemmCostModelProblem{128, 128, 4096}));
+}
+
+TEST(InstanceCostModel, RankInstances)
+{
+    std::vector<std::unique_ptr<BaseOperator>> op_ptrs;
+    for(const auto& desc : {DeviceOperatorDescriptor{"NoParams"},
+                            make_gemm_descriptor("MNKPadding", 256, 256, 256, 32),
+                            make_gemm_descriptor("Default", 256, 128, 128, 32),
+                            make_gemm_descriptor("MNKPadding", 256, 128, 128, 32)})
+        op_ptrs.push_back(std::make_unique<FakeOperator>(desc));
+
+    // instance 2 cannot run the problem, instance 0 has no estimate
+    const auto order =
+        ck::utils::rank_instances_by_cost(op_ptrs, GemmCostModelProblem{200, 200, 4096});
+
+    EXPECT_EQ(order, (std::vector<std::size_t>{3, 1, 0, 2}));
+}
+
+TEST(InstanceCostModel, RankCorrelation)
+{
+    EXPECT_DOUBLE_EQ(ck::utils::get_rank_correlation({1, 2, 3, 4}, {10, 20, 30, 40}), 1);
+    EXPECT_DOUBLE_EQ(ck::utils::get_rank_correlation({1, 2, 3, 4}, {4, 3, 2, 1}), -1);
+    EXPECT_DOUBLE_EQ(ck::utils::get_rank_correlation({1, 2, 3}, {1, 3, 2}), 0.5);
+    EXPECT_NEAR(ck::utils::get_rank_correlation({1, 1, 2}, {1, 2, 3}), 0.8660254, 1e-6);
+}
@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+
+#include "ck/library/utility/perf_db.hpp"
+
+namespace {
+
+using ck::utils::PerfDb;
+using ck::utils::PerfDbEntry;
+
+using Row = ck::tensor_layout::gemm::RowMajor;
+using Col = ck::tensor_layout::gemm::ColumnMajor;
+
+std::string make_gemm_key(int M, int N, int K)
+{
+    using ck::utils::get_perf_db_type_names;
+
+    return ck::utils::make_perf_db_key("gemm",
+                                       get_perf_db_type_names<ck::half_t, ck::half_t, float>(),
+                                       get_perf_db_type_names<Row, Col, Row>(),
+                                       {M, N, K, K, K, N});
+}
+
+struct FakeInstance
+{
+    std::string GetTypeString() const { return name_; }
+
+    std::string name_;
+};
+
+} // namespace
+
+TEST(PerfDb, Key)
+{
+    EXPECT_EQ(make_gemm_key(256, 128, 64),
+              "gemm|fp16,fp16,fp32|RowMajor,ColumnMajor,RowMajor|256,128,64,64,64,128");
+}
+
+TEST(PerfDb, SaveLoadMerge)
+{
+    const std::string path_a = ::testing::TempDir() + "perf_db_a.txt";
+    const std::string path_b = ::testing::TempDir() + "perf_db_b.txt";
+
+    {
+        PerfDb db;
+        EXPECT_TRUE(db.Record(make_gemm_key(256, 256, 256), {3, "Gemm<256, 128>", 2.f, 1.f, 1.f}));
+        EXPECT_TRUE(db.Record(make_gemm_key(512, 512, 512), {1, "Gemm<64, 64>", 5.f, 1.f, 1.f}));
+
+        // a slower record does not replace the existing one
+        EXPECT_FALSE(db.Record(make_gemm_key(256, 256, 256), {4, "Gemm<64, 64>", 3.f, 1.f, 1.f}));
+        ASSERT_TRUE(db.Save(path_a));
+    }
+
+    {
+        PerfDb db;
+        EXPECT_TRUE(db.Record(make_gemm_key(512, 512, 512), {2, "Gemm<128, 64>", 4.f, 2.f, 3.f}));
+        EXPECT_TRUE(db.Record(make_gemm_key(64, 64, 64), {0, "Gemm<32, 32>", 0.5f, 1.f, 1.f}));
+        ASSERT_TRUE(db.Save(path_b));
+    }
+
+    PerfDb db(path_a);
+    ASSERT_EQ(db.Size(), 2);
+    EXPECT_EQ(db.Find(make_gemm_key(256, 256, 256))->instance_name_, "Gemm<256, 128>");
+    EXPECT_EQ(db.Find(make_gemm_key(64, 64, 64)), nullptr);
+
+    db.Merge(PerfDb(path_b));
+    ASSERT_EQ(db.Size(), 3);
+
+    const PerfDbEntry* entry = db.Find(make_gemm_key(512, 512, 512));
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->instance_id_, 2);
+    EXPECT_EQ(entry->instance_name_, "Gemm<128, 64>");
+    EXPECT_FLOAT_EQ(entry->ave_time_, 4.f);
+    EXPECT_FLOAT_EQ(entry->gb_per_sec_, 3.f);
+
+    EXPECT_FALSE(db.Load(::testing::TempDir() + "perf_db_missing.txt"));
+
+    std::remove(path_a.c_str());
+    std::remove(path_b.c_str());
+}
+
+TEST(PerfDb, FindInstance)
+{
+    std::vector<std::unique_ptr<FakeInstance>> op_ptrs;
+    for(const auto* name : {"Gemm<32, 32>", "Gemm<64, 64>", "Gemm<128, 64>"})
+        op_ptrs.push_back(std::make_unique<FakeInstance>(FakeInstance{name}));
+
+    PerfDb db;
+    db.Record("a", {1, "Gemm<64, 64>", 1.f, 1.f, 1.f});
+    db.Record("b", {0, "Gemm<128, 64>", 1.f, 1.f, 1.f});
+    db.Record("c", {2, "Gemm<256, 64>", 1.f, 1.f, 1.f});
+
+    EXPECT_EQ(ck::utils::find_perf_db_instance(db, "a", op_ptrs), 1);
+    // the instance list changed since the record was made
+    EXPECT_EQ(ck::utils::find_perf_db_instance(db, "b", op_ptrs), 2);
+    EXPECT_EQ(ck::utils::find_perf_db_instance(db, "c", op_ptrs), op_ptrs.size());
+    EXPECT_EQ(ck::utils::find_perf_db_instance(db, "d", op_ptrs), op_ptrs.size());
+}
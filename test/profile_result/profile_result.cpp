@@ -0,0 +1,212 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/library/utility/profile_result.hpp"
+
+namespace {
+
+using ck::utils::ProfileResult;
+using ck::utils::VerificationStatus;
+
+ProfileResult make_gemm_result(const std::string& instance, std::vector<double> samples)
+{
+    ProfileResult result;
+
+    result.op_            = "gemm";
+    result.data_types_    = {"fp16", "fp16", "fp16"};
+    result.layouts_       = {"RowMajor", "ColumnMajor", "RowMajor"};
+    result.problem_       = {1024, 1024, 512, 512, 512, 1024};
+    result.instance_name_ = instance;
+
+    result.descriptor_.name_ = "DeviceGemm_Xdl_CShuffle";
+    result.descriptor_.Add("BlockSize", 256);
+    result.descriptor_.Add("GemmSpec", "Default");
+
+    result.time_samples_ms_ = std::move(samples);
+    result.tflops_          = 100.5f;
+    result.gb_per_sec_      = 800.25f;
+    result.verification_    = VerificationStatus::Pass;
+    result.error_           = {0.5, 0.125};
+
+    return result;
+}
+
+void check_round_trip(const std::string& path)
+{
+    std::remove(path.c_str());
+
+    // the comma and quote need escaping in both formats
+    const auto a = make_gemm_result("Gemm<256, \"a\">", {1.5, 1.25, 1.75});
+    auto b       = make_gemm_result("Gemm<128, 64>", {2.5});
+    b.verification_ = VerificationStatus::NotRun;
+
+    ASSERT_TRUE(ck::utils::append_profile_result(path, a));
+    ASSERT_TRUE(ck::utils::append_profile_result(path, b));
+
+    std::vector<ProfileResult> results;
+    ASSERT_TRUE(ck::utils::load_profile_results(path, results));
+    ASSERT_EQ(results.size(), 2);
+
+    for(std::size_t i = 0; i < 2; ++i)
+    {
+        const auto& expected = i == 0 ? a : b;
+
+        EXPECT_EQ(ck::utils::make_profile_result_key(results[i]),
+                  ck::utils::make_profile_result_key(expected));
+        EXPECT_EQ(results[i].descriptor_.GetHash(), expected.descriptor_.GetHash());
+        EXPECT_EQ(results[i].time_samples_ms_, expected.time_samples_ms_);
+        EXPECT_EQ(results[i].tflops_, expected.tflops_);
+        EXPECT_EQ(results[i].gb_per_sec_, expected.gb_per_sec_);
+        EXPECT_EQ(results[i].verification_, expected.verification_);
+        EXPECT_EQ(results[i].error_.max_rel_error_, expected.error_.max_rel_error_);
+    }
+
+    std::remove(path.c_str());
+}
+
+} // namespace
+
+TEST(ProfileResult, TimeStatistics)
+{
+    const auto stats = ck::utils::get_time_statistics({5, 1, 4, 2, 3});
+
+    EXPECT_EQ(stats.num_samples_, 5);
+    EXPECT_DOUBLE_EQ(stats.mean_, 3);
+    EXPECT_DOUBLE_EQ(stats.median_, 3);
+    EXPECT_DOUBLE_EQ(stats.p10_, 1.4);
+    EXPECT_DOUBLE_EQ(stats.p90_, 4.6);
+    EXPECT_DOUBLE_EQ(stats.stddev_, std::sqrt(2.5));
+    EXPECT_DOUBLE_EQ(stats.min_, 1);
+    EXPECT_DOUBLE_EQ(stats.max_, 5);
+
+    const auto errors = ck::utils::get_error_statistics(std::vector<float>{1, 2.5f, 0.5f},
+                                                        std::vector<float>{1, 2, 0});
+
+    EXPECT_DOUBLE_EQ(errors.max_abs_error_, 0.5);
+    EXPECT_DOUBLE_EQ(errors.max_rel_error_, 0.25);
+}
+
+TEST(ProfileResult, JsonLines) { check_round_trip(::testing::TempDir() + "results.jsonl"); }
+
+TEST(ProfileResult, Csv) { check_round_trip(::testing::TempDir() + "results.csv"); }
+
+TEST(ProfileResult, Compare)
+{
+    const std::vector<ProfileResult> baseline = {
+        make_gemm_result("Gemm<256, 128>", {1.0, 1.02, 0.98, 1.01, 0.99}),
+        make_gemm_result("Gemm<128, 64>", {2.0, 2.1, 1.9, 2.05, 1.95}),
+        make_gemm_result("Gemm<64, 64>", {3.0, 3.0, 3.0})};
+
+    auto current = baseline;
+
+    // 20% slower
+    current[0].time_samples_ms_ = {1.2, 1.22, 1.18, 1.21, 1.19};
+    // the median is 7.5% slower but within the noise of the runs
+    current[1].time_samples_ms_ = {2.15, 1.7, 2.6, 2.3, 1.9};
+    current[2].verification_    = VerificationStatus::Fail;
+    current.push_back(make_gemm_result("Gemm<32, 32>", {9.0}));
+
+    const auto comparisons = ck::utils::compare_profile_results(baseline, current, 0.05);
+
+    ASSERT_EQ(comparisons.size(), 3);
+
+    EXPECT_TRUE(comparisons[0].regression_);
+    EXPECT_NEAR(comparisons[0].change_, 0.2, 1e-9);
+    EXPECT_GT(comparisons[1].change_, 0.05);
+    EXPECT_FALSE(comparisons[1].regression_);
+    EXPECT_FALSE(comparisons[2].regression_);
+    EXPECT_TRUE(comparisons[2].verification_regression_);
+}
+
+TEST(ProfileResult, Problems)
+{
+    const std::string csv_path  = ::testing::TempDir() + "problems.csv";
+    const std::string json_path = ::testing::TempDir() + "problems.jsonl";
+
+    std::ofstream(csv_path) << "# op, data type, layout, verify, init, log, time, M, N, K, ...\n"
+                            << "gemm, 1, 1, 1, 1, 0, 1, 3840, 4096, 4096, 4096, 4096, 4096\n"
+                            << "\n"
+                            << "gemm_streamk_schedule,3840,4096,4096,256,128,32,104,1,0\n";
+
+    std::ofstream(json_path)
+        << "{\"op\": \"gemm\", \"args\": [1, 1, 1, 1, 0, 1, 3840, 4096, 4096, 4096, 4096, 4096]}\n"
+        << "{\"op\": \"gemm_streamk_schedule\", \"args\": [\"3840\", 4096, 4096, 256, 128, 32, "
+           "104, 1, 0]}\n";
+
+    for(const auto& path : {csv_path, json_path})
+    {
+        std::vector<ck::utils::ProfileProblem> problems;
+        ASSERT_TRUE(ck::utils::load_profile_problems(path, problems));
+        ASSERT_EQ(problems.size(), 2);
+
+        EXPECT_EQ(problems[0].op_, "gemm");
+        EXPECT_EQ(problems[0].args_.size(), 12);
+        EXPECT_EQ(problems[0].args_[5], "1");
+        EXPECT_EQ(problems[0].args_[6], "3840");
+        EXPECT_EQ(problems[1].op_, "gemm_streamk_schedule");
+        EXPECT_EQ(problems[1].args_.size(), 9);
+        EXPECT_EQ(problems[1].args_.front(), "3840");
+
+        std::remove(path.c_str());
+    }
+}
+
+// numeric arguments read back as the profilers parse them, large integers without an exponent
+TEST(ProfileResult, ProblemNumbers)
+{
+    const std::string path = ::testing::TempDir() + "problem_numbers.jsonl";
+
+    std::ofstream(path) << "{\"op\": \"batched_gemm\", \"args\": [1073741824, 12884901888, -3, "
+                           "0.1, 2.5e-7]}\n";
+
+    std::vector<ck::utils::ProfileProblem> problems;
+    ASSERT_TRUE(ck::utils::load_profile_problems(path, problems));
+    ASSERT_EQ(problems.size(), 1);
+
+    const auto& args = problems[0].args_;
+
+    ASSERT_EQ(args.size(), 5);
+    EXPECT_EQ(args[0], "1073741824");
+    EXPECT_EQ(std::stoi(args[0]), 1 << 30);
+    EXPECT_EQ(args[1], "12884901888");
+    EXPECT_EQ(args[2], "-3");
+    EXPECT_EQ(std::stod(args[3]), 0.1);
+    EXPECT_EQ(std::stod(args[4]), 2.5e-7);
+
+    std::remove(path.c_str());
+}
+
+// a value of the wrong type throws instead of being read as a number
+TEST(ProfileResult, WrongValueType)
+{
+    const std::string path = ::testing::TempDir() + "wrong_type.jsonl";
+
+    std::remove(path.c_str());
+    ASSERT_TRUE(ck::utils::append_profile_result(path, make_gemm_result("Gemm<256, 128>", {1.5})));
+
+    std::string record;
+    std::getline(std::ifstream(path), record);
+
+    const std::string samples = "\"samples\": [";
+    const auto pos            = record.find(samples);
+    ASSERT_NE(pos, std::string::npos);
+
+    std::ofstream(path) << record.insert(pos + samples.size(), "\"1.5\", ") << "\n";
+
+    std::vector<ProfileResult> results;
+    EXPECT_THROW(ck::utils::load_profile_results(path, results), std::runtime_error);
+
+    std::ofstream(path) << "{\"op\": \"gemm\", \"args\": [1, [2], 3]}\n";
+
+    std::vector<ck::utils::ProfileProblem> problems;
+    EXPECT_THROW(ck::utils::load_profile_problems(path, problems), std::runtime_error);
+
+    std::remove(path.c_str());
+}
@@ -0,0 +1,178 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_random.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/reference_cache.hpp"
+
+using ck::utils::ReferenceCache;
+
+namespace {
+
+// a problem run like the profilers: random inputs, then the reference output of the key, here
+// an element-wise product, cached in get_reference_cache(); returns the output
+std::vector<float> run_problem(std::size_t length, int& num_reference_run)
+{
+    ck::utils::restart_random_streams();
+
+    Tensor<float> a({length});
+    Tensor<float> b({length});
+    Tensor<float> c({length});
+
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(a);
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(b);
+
+    const auto key = ck::utils::make_reference_cache_key("multiply",
+                                                         {"fp32", "fp32", "fp32"},
+                                                         {},
+                                                         {static_cast<int64_t>(length)},
+                                                         {},
+                                                         2,
+                                                         ck::utils::get_host_random_seed());
+
+    ck::utils::run_reference_cached(key, c, [&] {
+        ++num_reference_run;
+
+        for(std::size_t i = 0; i < length; ++i)
+            c.mData[i] = a.mData[i] * b.mData[i];
+    });
+
+    // the output of these inputs, whether it was cached or not
+    for(std::size_t i = 0; i < length; ++i)
+        EXPECT_EQ(c.mData[i], a.mData[i] * b.mData[i]) << "length " << length << ", i " << i;
+
+    return c.mData;
+}
+
+} // namespace
+
+TEST(ReferenceCache, LoadStore)
+{
+    ReferenceCache cache(1024);
+
+    const std::vector<float> out{1, 2, 3, 4};
+    std::vector<float> loaded(4, 0);
+
+    EXPECT_FALSE(cache.Load("a", loaded.data(), 16));
+
+    cache.Store("a", out.data(), 16);
+
+    ASSERT_TRUE(cache.Load("a", loaded.data(), 16));
+    EXPECT_EQ(loaded, out);
+
+    // the output of another size is not the same problem
+    EXPECT_FALSE(cache.Load("a", loaded.data(), 8));
+
+    const auto key = ck::utils::make_reference_cache_key("gemm",
+                                                         {"fp16", "fp16", "fp16"},
+                                                         {"RowMajor", "RowMajor", "RowMajor"},
+                                                         {64, 64, 64},
+                                                         {"PassThrough", "Scale"},
+                                                         1,
+                                                         7);
+
+    EXPECT_EQ(key, "gemm|fp16,fp16,fp16|RowMajor,RowMajor,RowMajor|64,64,64|PassThrough,Scale|1|7");
+}
+
+TEST(ReferenceCache, Evict)
+{
+    ReferenceCache cache(256);
+
+    const std::vector<char> out(100, 1);
+    std::vector<char> loaded(100);
+
+    cache.Store("a", out.data(), 100);
+    cache.Store("b", out.data(), 100);
+
+    // "a" is used last, so "b" is evicted for "c"
+    ASSERT_TRUE(cache.Load("a", loaded.data(), 100));
+    cache.Store("c", out.data(), 100);
+
+    EXPECT_EQ(cache.Size(), 2);
+    EXPECT_EQ(cache.GetBytes(), 200);
+    EXPECT_TRUE(cache.Load("a", loaded.data(), 100));
+    EXPECT_FALSE(cache.Load("b", loaded.data(), 100));
+    EXPECT_TRUE(cache.Load("c", loaded.data(), 100));
+
+    // larger than the capacity
+    cache.Store("d", std::vector<char>(300).data(), 300);
+    EXPECT_FALSE(cache.Load("d", loaded.data(), 300));
+
+    cache.SetCapacity(0);
+    EXPECT_EQ(cache.Size(), 0);
+    EXPECT_EQ(cache.GetBytes(), 0);
+}
+
+TEST(ReferenceCache, Directory)
+{
+    const std::string directory = ::testing::TempDir() + "ck_reference_cache";
+
+    const std::vector<float> out{1, 2, 3, 4};
+    std::vector<float> loaded(4, 0);
+
+    {
+        // memory capacity 0: only the directory keeps the output
+        ReferenceCache cache;
+        cache.SetDirectory(directory, 1 << 20);
+        cache.Store("a", out.data(), 16);
+    }
+
+    ReferenceCache cache;
+    cache.SetDirectory(directory, 1 << 20);
+
+    ASSERT_TRUE(cache.Load("a", loaded.data(), 16));
+    EXPECT_EQ(loaded, out);
+    EXPECT_FALSE(cache.Load("a", loaded.data(), 8));
+    EXPECT_FALSE(cache.Load("b", loaded.data(), 16));
+
+    cache.SetRecompute(true);
+    EXPECT_FALSE(cache.Load("a", loaded.data(), 16));
+    cache.SetRecompute(false);
+
+    // the directory holds about two of these outputs, the last one stored is kept
+    const std::vector<char> big(1000, 1);
+    std::vector<char> big_loaded(1000);
+
+    cache.SetDirectory(directory, 2100);
+    cache.Store("b", big.data(), 1000);
+    cache.Store("c", big.data(), 1000);
+    cache.Store("d", big.data(), 1000);
+
+    EXPECT_TRUE(cache.Load("d", big_loaded.data(), 1000));
+    EXPECT_LE(int(cache.Load("b", big_loaded.data(), 1000)) +
+                  int(cache.Load("c", big_loaded.data(), 1000)),
+              1);
+
+    cache.SetDirectory(directory, 0);
+    std::remove(directory.c_str());
+}
+
+// the problems run in another order hit the outputs cached for the first order
+TEST(ReferenceCache, ProblemOrder)
+{
+    auto& cache = ck::utils::get_reference_cache();
+
+    cache.SetCapacity(1 << 20);
+
+    int num_reference_run = 0;
+
+    const auto a_first = run_problem(1000, num_reference_run);
+    const auto b_first = run_problem(300, num_reference_run);
+
+    EXPECT_EQ(num_reference_run, 2);
+
+    const auto b_second = run_problem(300, num_reference_run);
+    const auto a_second = run_problem(1000, num_reference_run);
+
+    EXPECT_EQ(num_reference_run, 2);
+    EXPECT_EQ(a_second, a_first);
+    EXPECT_EQ(b_second, b_first);
+
+    cache.SetCapacity(0);
+}
@@ -0,0 +1,392 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <array>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_thread_pool.hpp"
+#include "ck/library/utility/convolution_parameter.hpp"
+#include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_bwd_data.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_bwd_weight.hpp"
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+using ConvParam   = ck::utils::conv::ConvParam;
+
+namespace ctl = ck::tensor_layout::convolution;
+
+// elementwise ops with one extra tensor, so that every element sees a different operation
+struct Multiply
+{
+    template <typename T>
+    void operator()(T& y, const T& x, const T& t) const
+    {
+        y = x * t;
+    }
+};
+
+struct Add
+{
+    template <typename T>
+    void operator()(T& y, const T& x, const T& t) const
+    {
+        y = x + t;
+    }
+};
+
+template <ck::index_t NDimSpatial>
+std::vector<ConvParam> get_conv_params()
+{
+    if constexpr(NDimSpatial == 1)
+        return {ConvParam(1, 1, 3, 8, 4, {3}, {17}, {2}, {1}, {1}, {1}),
+                ConvParam(1, 2, 2, 5, 3, {5}, {20}, {3}, {2}, {2}, {0})};
+    else if constexpr(NDimSpatial == 2)
+        return {ConvParam(2, 2, 2, 5, 3, {3, 3}, {9, 10}, {2, 1}, {1, 2}, {1, 0}, {1, 2}),
+                ConvParam(2, 1, 4, 70, 20, {3, 3}, {14, 14}, {1, 1}, {1, 1}, {1, 1}, {1, 1}),
+                ConvParam(2, 1, 2, 16, 8, {1, 1}, {7, 7}, {2, 2}, {1, 1}, {0, 0}, {0, 0})};
+    else
+        return {ConvParam(
+            3, 1, 2, 4, 3, {2, 3, 3}, {5, 6, 7}, {1, 2, 1}, {1, 1, 2}, {0, 1, 1}, {1, 1, 0})};
+}
+
+template <ck::index_t NDimSpatial>
+struct ConvLayouts;
+
+template <>
+struct ConvLayouts<1>
+{
+    using InLayout  = ctl::GNWC;
+    using WeiLayout = ctl::GKXC;
+    using OutLayout = ctl::GNWK;
+};
+
+template <>
+struct ConvLayouts<2>
+{
+    using InLayout  = ctl::NHWGC;
+    using WeiLayout = ctl::GKYXC;
+    using OutLayout = ctl::NHWGK;
+};
+
+template <>
+struct ConvLayouts<3>
+{
+    using InLayout  = ctl::GNDHWC;
+    using WeiLayout = ctl::GKZYXC;
+    using OutLayout = ctl::GNDHWK;
+};
+
+template <ck::index_t NDimSpatial, typename DataType>
+void run_im2col_gemm_vs_direct(const ConvParam& param)
+{
+    using Layouts = ConvLayouts<NDimSpatial>;
+
+    const auto in_desc = ck::utils::conv::make_input_host_tensor_descriptor_g_n_c_wis_packed<
+        typename Layouts::InLayout>(param);
+    const auto wei_desc = ck::utils::conv::make_weight_host_tensor_descriptor_g_k_c_xs_packed<
+        typename Layouts::WeiLayout>(param);
+    const auto out_desc = ck::utils::conv::make_output_host_tensor_descriptor_g_n_k_wos_packed<
+        typename Layouts::OutLayout>(param);
+
+    Tensor<DataType> in(in_desc);
+    Tensor<DataType> wei(wei_desc);
+    Tensor<DataType> out(out_desc);
+
+    ck::utils::FillUniformDistribution<DataType>{-2.f, 2.f}(in);
+    ck::utils::FillUniformDistribution<DataType>{-2.f, 2.f}(wei);
+    ck::utils::FillUniformDistribution<DataType>{-2.f, 2.f}(out);
+
+    // the im2col path keeps the accumulation order, so results must be bit-identical
+    {
+        Tensor<DataType> out_gemm(out_desc);
+        Tensor<DataType> out_direct(out_desc);
+
+        using RefConv = ck::tensor_operation::host::ReferenceConvFwd<NDimSpatial,
+                                                                     DataType,
+                                                                     DataType,
+                                                                     DataType,
+                                                                     PassThrough,
+                                                                     PassThrough,
+                                                                     PassThrough>;
+
+        auto invoker = RefConv::MakeInvoker();
+
+        invoker.Run(RefConv::MakeArgument(in,
+                                          wei,
+                                          out_gemm,
+                                          param.conv_filter_strides_,
+                                          param.conv_filter_dilations_,
+                                          param.input_left_pads_,
+                                          param.input_right_pads_,
+                                          PassThrough{},
+                                          PassThrough{},
+                                          PassThrough{}));
+        invoker.RunDirect(RefConv::MakeArgument(in,
+                                                wei,
+                                                out_direct,
+                                                param.conv_filter_strides_,
+                                                param.conv_filter_dilations_,
+                                                param.input_left_pads_,
+                                                param.input_right_pads_,
+                                                PassThrough{},
+                                                PassThrough{},
+                                                PassThrough{}));
+
+        EXPECT_TRUE(
+            ck::utils::check_err(out_gemm, out_direct, "Error: forward im2col != direct", 0, 0));
+    }
+
+    {
+        Tensor<DataType> in_gemm(in_desc);
+        Tensor<DataType> in_direct(in_desc);
+
+        using RefConv = ck::tensor_operation::host::ReferenceConvBwdData<NDimSpatial,
+                                                                         DataType,
+                                                                         DataType,
+                                                                         DataType,
+                                                                         PassThrough,
+                                                                         PassThrough,
+                                                                         PassThrough>;
+
+        RefConv ref_conv;
+        auto invoker = ref_conv.MakeInvoker();
+
+        invoker.Run(ref_conv.MakeArgument(in_gemm,
+                                          wei,
+                                          out,
+                                          param.conv_filter_strides_,
+                                          param.conv_filter_dilations_,
+                                          param.input_left_pads_,
+                                          param.input_right_pads_,
+                                          PassThrough{},
+                                          PassThrough{},
+                                          PassThrough{}));
+        invoker.RunDirect(ref_conv.MakeArgument(in_direct,
+                                                wei,
+                                                out,
+                                                param.conv_filter_strides_,
+                                                param.conv_filter_dilations_,
+                                                param.input_left_pads_,
+                                                param.input_right_pads_,
+                                                PassThrough{},
+                                                PassThrough{},
+                                                PassThrough{}));
+
+        EXPECT_TRUE(ck::utils::check_err(
+            in_gemm, in_direct, "Error: backward data im2col != direct", 0, 0));
+    }
+
+    {
+        Tensor<DataType> wei_gemm(wei_desc);
+        Tensor<DataType> wei_direct(wei_desc);
+
+        using RefConv = ck::tensor_operation::host::ReferenceConvBwdWeight<NDimSpatial,
+                                                                           DataType,
+                                                                           DataType,
+                                                                           DataType,
+                                                                           PassThrough,
+                                                                           PassThrough,
+                                                                           PassThrough>;
+
+        RefConv ref_conv;
+        auto invoker = ref_conv.MakeInvoker();
+
+        invoker.Run(ref_conv.MakeArgument(in,
+                                          wei_gemm,
+                                          out,
+                                          param.conv_filter_strides_,
+                                          param.conv_filter_dilations_,
+                                          param.input_left_pads_,
+                                          param.input_right_pads_,
+                                          PassThrough{},
+                                          PassThrough{},
+                                          PassThrough{}));
+        invoker.RunDirect(ref_conv.MakeArgument(in,
+                                                wei_direct,
+                                                out,
+                                                param.conv_filter_strides_,
+                                                param.conv_filter_dilations_,
+                                                param.input_left_pads_,
+                                                param.input_right_pads_,
+                                                PassThrough{},
+                                                PassThrough{},
+                                                PassThrough{}));
+
+        EXPECT_TRUE(ck::utils::check_err(
+            wei_gemm, wei_direct, "Error: backward weight im2col != direct", 0, 0));
+    }
+}
+
+template <typename DataType>
+class TestReferenceConvIm2Col : public ::testing::Test
+{
+};
+
+using KernelTypes = ::testing::Types<float, ck::half_t, ck::bhalf_t>;
+
+} // namespace
+
+TYPED_TEST_SUITE(TestReferenceConvIm2Col, KernelTypes);
+
+TYPED_TEST(TestReferenceConvIm2Col, Conv1D)
+{
+    for(const auto& param : get_conv_params<1>())
+        run_im2col_gemm_vs_direct<1, TypeParam>(param);
+}
+
+TYPED_TEST(TestReferenceConvIm2Col, Conv2D)
+{
+    for(const auto& param : get_conv_params<2>())
+        run_im2col_gemm_vs_direct<2, TypeParam>(param);
+}
+
+TYPED_TEST(TestReferenceConvIm2Col, Conv3D)
+{
+    for(const auto& param : get_conv_params<3>())
+        run_im2col_gemm_vs_direct<3, TypeParam>(param);
+}
+
+TEST(TestReferenceConvIm2Col, ForwardElementwiseTensors)
+{
+    using Layouts = ConvLayouts<2>;
+
+    const auto param = get_conv_params<2>()[0];
+
+    const auto in_desc = ck::utils::conv::make_input_host_tensor_descriptor_g_n_c_wis_packed<
+        Layouts::InLayout>(param);
+    const auto wei_desc = ck::utils::conv::make_weight_host_tensor_descriptor_g_k_c_xs_packed<
+        Layouts::WeiLayout>(param);
+    const auto out_desc = ck::utils::conv::make_output_host_tensor_descriptor_g_n_k_wos_packed<
+        Layouts::OutLayout>(param);
+
+    Tensor<float> in(in_desc);
+    Tensor<float> wei(wei_desc);
+    Tensor<float> out_gemm(out_desc);
+    Tensor<float> out_direct(out_desc);
+
+    std::array<Tensor<float>, 1> a_tensors{Tensor<float>(in_desc)};
+    std::array<Tensor<float>, 1> b_tensors{Tensor<float>(wei_desc)};
+    std::array<Tensor<float>, 1> d_tensors{Tensor<float>(out_desc)};
+
+    ck::utils::FillUniformDistribution<float>{-2.f, 2.f}(in);
+    ck::utils::FillUniformDistribution<float>{-2.f, 2.f}(wei);
+    ck::utils::FillUniformDistribution<float>{-2.f, 2.f}(a_tensors[0]);
+    ck::utils::FillUniformDistribution<float>{-2.f, 2.f}(b_tensors[0]);
+    ck::utils::FillUniformDistribution<float>{-2.f, 2.f}(d_tensors[0]);
+
+    using RefConv = ck::tensor_operation::host::
+        ReferenceConvFwd<2, float, float, float, Multiply, Multiply, Add, 1, 1, 1>;
+
+    auto invoker = RefConv::MakeInvoker();
+
+    invoker.Run(RefConv::MakeArgument(in,
+                                      wei,
+                                      out_gemm,
+                                      param.conv_filter_strides_,
+                                      param.conv_filter_dilations_,
+                                      param.input_left_pads_,
+                                      param.input_right_pads_,
+                                      Multiply{},
+                                      Multiply{},
+                                      Add{},
+                                      a_tensors,
+                                      b_tensors,
+                                      d_tensors));
+    invoker.RunDirect(RefConv::MakeArgument(in,
+                                            wei,
+                                            out_direct,
+                                            param.conv_filter_strides_,
+                                            param.conv_filter_dilations_,
+                                            param.input_left_pads_,
+                                            param.input_right_pads_,
+                                            Multiply{},
+                                            Multiply{},
+                                            Add{},
+                                            a_tensors,
+                                            b_tensors,
+                                            d_tensors));
+
+    EXPECT_TRUE(
+        ck::utils::check_err(out_gemm, out_direct, "Error: forward im2col != direct", 0, 0));
+}
+
+// few weights and a long reduction: the backward weight GEMM splits the reduction, which must not
+// depend on the number of threads
+TEST(TestReferenceConvIm2Col, BackwardWeightSplitK)
+{
+    using Layouts = ConvLayouts<2>;
+
+    const ConvParam param(2, 1, 4, 8, 4, {3, 3}, {32, 32}, {1, 1}, {1, 1}, {1, 1}, {1, 1});
+
+    const auto in_desc = ck::utils::conv::make_input_host_tensor_descriptor_g_n_c_wis_packed<
+        Layouts::InLayout>(param);
+    const auto wei_desc = ck::utils::conv::make_weight_host_tensor_descriptor_g_k_c_xs_packed<
+        Layouts::WeiLayout>(param);
+    const auto out_desc = ck::utils::conv::make_output_host_tensor_descriptor_g_n_k_wos_packed<
+        Layouts::OutLayout>(param);
+
+    // K x (C * Y * X) weights, N * Ho * Wo reduction
+    ASSERT_LT(
+        ck::tensor_operation::host::get_blocked_gemm_k_per_split(1, 8, 4 * 3 * 3, 4 * 32 * 32),
+        4 * 32 * 32);
+
+    Tensor<float> in(in_desc);
+    Tensor<float> out(out_desc);
+
+    ck::utils::FillUniformDistribution<float>{-2.f, 2.f}(in);
+    ck::utils::FillUniformDistribution<float>{-2.f, 2.f}(out);
+
+    using RefConv = ck::tensor_operation::host::
+        ReferenceConvBwdWeight<2, float, float, float, PassThrough, PassThrough, PassThrough>;
+
+    RefConv ref_conv;
+    auto invoker = ref_conv.MakeInvoker();
+
+    auto run = [&](Tensor<float>& wei, bool direct) {
+        auto arg = ref_conv.MakeArgument(in,
+                                         wei,
+                                         out,
+                                         param.conv_filter_strides_,
+                                         param.conv_filter_dilations_,
+                                         param.input_left_pads_,
+                                         param.input_right_pads_,
+                                         PassThrough{},
+                                         PassThrough{},
+                                         PassThrough{});
+
+        if(direct)
+            invoker.RunDirect(arg);
+        else
+            invoker.Run(arg);
+    };
+
+    Tensor<float> wei_1(wei_desc);
+    Tensor<float> wei_4(wei_desc);
+    Tensor<float> wei_direct(wei_desc);
+
+    const std::size_t saved_num_threads = ck::utils::get_host_num_threads();
+
+    ck::utils::set_host_num_threads(1);
+    run(wei_1, false);
+    ck::utils::set_host_num_threads(4);
+    run(wei_4, false);
+    ck::utils::set_host_num_threads(saved_num_threads);
+
+    run(wei_direct, true);
+
+    EXPECT_TRUE(
+        ck::utils::check_err(wei_4, wei_1, "Error: backward weight depends on threads", 0, 0));
+    EXPECT_TRUE(ck::utils::check_err(
+        wei_1, wei_direct, "Error: backward weight im2col != direct", 1e-4, 1e-3));
+}
@@ -0,0 +1,224 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdlib>
+#include <tuple>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_thread_pool.hpp"
+#include "ck/library/utility/literals.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+using Row         = ck::tensor_layout::gemm::RowMajor;
+using Col         = ck::tensor_layout::gemm::ColumnMajor;
+
+// Same math as PassThrough, but a distinct type, so ReferenceGemm takes the generic loop
+struct OpaquePassThrough
+{
+    template <typename Y, typename X>
+    void operator()(Y& y, const X& x) const
+    {
+        PassThrough{}(y, x);
+    }
+};
+
+template <typename Layout>
+HostTensorDescriptor make_matrix_descriptor(std::size_t row, std::size_t col, Layout)
+{
+    using namespace ck::literals;
+
+    if constexpr(ck::is_same_v<Layout, Row>)
+        return HostTensorDescriptor({row, col}, {col, 1_uz});
+    else
+        return HostTensorDescriptor({row, col}, {1_uz, row});
+}
+
+template <typename ADataType,
+          typename BDataType,
+          typename CDataType,
+          typename AccDataType,
+          typename AElementOp,
+          typename BElementOp,
+          typename ALayout,
+          typename BLayout>
+Tensor<CDataType> run_reference_gemm(std::size_t M, std::size_t N, std::size_t K)
+{
+    Tensor<ADataType> a_m_k(make_matrix_descriptor(M, K, ALayout{}));
+    Tensor<BDataType> b_k_n(make_matrix_descriptor(K, N, BLayout{}));
+    Tensor<CDataType> c_m_n(make_matrix_descriptor(M, N, Row{}));
+
+    ck::utils::FillUniformDistribution<ADataType>{-5.f, 5.f}(a_m_k);
+    ck::utils::FillUniformDistribution<BDataType>{-5.f, 5.f}(b_k_n);
+
+    using ReferenceGemmInstance = ck::tensor_operation::host::ReferenceGemm<ADataType,
+                                                                            BDataType,
+                                                                            CDataType,
+                                                                            AccDataType,
+                                                                            AElementOp,
+                                                                            BElementOp,
+                                                                            PassThrough>;
+
+    auto ref_gemm     = ReferenceGemmInstance{};
+    auto ref_invoker  = ref_gemm.MakeInvoker();
+    auto ref_argument =
+        ref_gemm.MakeArgument(a_m_k, b_k_n, c_m_n, AElementOp{}, BElementOp{}, PassThrough{});
+
+    ref_invoker.Run(ref_argument);
+
+    return c_m_n;
+}
+
+template <typename Tuple>
+class TestReferenceGemm : public ::testing::Test
+{
+    protected:
+    using ADataType   = std::tuple_element_t<0, Tuple>;
+    using BDataType   = std::tuple_element_t<1, Tuple>;
+    using CDataType   = std::tuple_element_t<2, Tuple>;
+    using AccDataType = std::tuple_element_t<3, Tuple>;
+
+    std::vector<std::vector<std::size_t>> lengths_ = {
+        {1, 1, 1}, {3, 5, 7}, {64, 256, 256}, {67, 259, 300}, {130, 17, 513}, {16, 16, 0}};
+
+    template <typename ALayout, typename BLayout>
+    void Run()
+    {
+        for(const auto& mnk : lengths_)
+        {
+            const auto blocked = run_reference_gemm<ADataType,
+                                                    BDataType,
+                                                    CDataType,
+                                                    AccDataType,
+                                                    PassThrough,
+                                                    PassThrough,
+                                                    ALayout,
+                                                    BLayout>(mnk[0], mnk[1], mnk[2]);
+            const auto generic = run_reference_gemm<ADataType,
+                                                    BDataType,
+                                                    CDataType,
+                                                    AccDataType,
+                                                    OpaquePassThrough,
+                                                    OpaquePassThrough,
+                                                    ALayout,
+                                                    BLayout>(mnk[0], mnk[1], mnk[2]);
+
+            // the blocked path keeps the accumulation order, so results must be bit-identical
+            EXPECT_TRUE(ck::utils::check_err(blocked, generic, "Error: blocked != generic", 0, 0));
+        }
+    }
+};
+
+using KernelTypes = ::testing::Types<std::tuple<float, float, float, float>,
+                                     std::tuple<ck::half_t, ck::half_t, ck::half_t, float>,
+                                     std::tuple<ck::bhalf_t, ck::bhalf_t, ck::bhalf_t, float>,
+                                     std::tuple<int8_t, int8_t, int8_t, int32_t>>;
+
+} // namespace
+
+TYPED_TEST_SUITE(TestReferenceGemm, KernelTypes);
+
+TYPED_TEST(TestReferenceGemm, MK_KN) { this->template Run<Row, Row>(); }
+TYPED_TEST(TestReferenceGemm, MK_NK) { this->template Run<Row, Col>(); }
+TYPED_TEST(TestReferenceGemm, KM_KN) { this->template Run<Col, Row>(); }
+TYPED_TEST(TestReferenceGemm, KM_NK) { this->template Run<Col, Col>(); }
+
+// the reduction is split only for outputs of few tiles, in chunks of whole KC slices
+TEST(BatchedBlockedGemm, KPerSplit)
+{
+    using Config = ck::tensor_operation::host::BlockedGemmTileConfig;
+
+    auto get_num_k_split = [](std::size_t G, std::size_t M, std::size_t N, std::size_t K) {
+        const std::size_t k_per_split =
+            ck::tensor_operation::host::get_blocked_gemm_k_per_split(G, M, N, K);
+
+        return K > k_per_split ? (K + k_per_split - 1) / k_per_split : 1;
+    };
+
+    EXPECT_EQ(get_num_k_split(1, 4096, 4096, 4096), 1);
+    EXPECT_EQ(get_num_k_split(64, 64, 256, 1 << 20), 1);
+    EXPECT_EQ(get_num_k_split(1, 8, 36, 1000), 1);
+    EXPECT_EQ(get_num_k_split(1, 8, 36, 0), 1);
+    EXPECT_EQ(get_num_k_split(1, 8, 36, 4096), 4);
+    EXPECT_EQ(get_num_k_split(1, 8, 36, 1 << 20), 64);
+    EXPECT_EQ(get_num_k_split(8, 64, 256, 1 << 16), 8);
+    EXPECT_EQ(ck::tensor_operation::host::get_blocked_gemm_k_per_split(1, 8, 36, 4096),
+              4 * Config::KC);
+}
+
+// a split reduction is exact for integers and the same for any number of threads for floats
+TEST(BatchedBlockedGemm, SplitK)
+{
+    const std::size_t G = 3, M = 10, N = 20, K = 5000;
+
+    Tensor<int32_t> a_i(std::vector<std::size_t>{G, M, K});
+    Tensor<int32_t> b_i(std::vector<std::size_t>{G, K, N});
+    Tensor<float> a_f(std::vector<std::size_t>{G, M, K});
+    Tensor<float> b_f(std::vector<std::size_t>{G, K, N});
+
+    ck::utils::FillUniformDistributionIntegerValue<int32_t>{-5.f, 5.f}(a_i);
+    ck::utils::FillUniformDistributionIntegerValue<int32_t>{-5.f, 5.f}(b_i);
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(a_f);
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(b_f);
+
+    ASSERT_LT(ck::tensor_operation::host::get_blocked_gemm_k_per_split(G, M, N, K), K);
+
+    Tensor<int32_t> c_i(std::vector<std::size_t>{G, M, N});
+    Tensor<int32_t> c_i_naive(std::vector<std::size_t>{G, M, N});
+
+    ck::tensor_operation::host::batched_blocked_gemm<int32_t>(
+        G,
+        M,
+        N,
+        K,
+        [&](std::size_t g, std::size_t m, std::size_t k) { return a_i(g, m, k); },
+        [&](std::size_t g, std::size_t k, std::size_t n) { return b_i(g, k, n); },
+        [&](std::size_t g, std::size_t m, std::size_t n, int32_t v) { c_i(g, m, n) = v; });
+
+    c_i_naive.ForEach([&](auto& self, auto idx) {
+        int32_t v = 0;
+
+        for(std::size_t k = 0; k < K; ++k)
+            v += a_i(idx[0], idx[1], k) * b_i(idx[0], k, idx[2]);
+
+        self(idx) = v;
+    });
+
+    EXPECT_TRUE(ck::utils::check_err(c_i, c_i_naive, "Error: split-K != naive", 0, 0));
+
+    const std::size_t saved_num_threads = ck::utils::get_host_num_threads();
+
+    auto run_float = [&](std::size_t num_thread) {
+        ck::utils::set_host_num_threads(num_thread);
+
+        Tensor<float> c_f(std::vector<std::size_t>{G, M, N});
+
+        ck::tensor_operation::host::batched_blocked_gemm<float>(
+            G,
+            M,
+            N,
+            K,
+            [&](std::size_t g, std::size_t m, std::size_t k) { return a_f(g, m, k); },
+            [&](std::size_t g, std::size_t k, std::size_t n) { return b_f(g, k, n); },
+            [&](std::size_t g, std::size_t m, std::size_t n, float v) { c_f(g, m, n) = v; });
+
+        return c_f;
+    };
+
+    const auto c_f_1 = run_float(1);
+    const auto c_f_4 = run_float(4);
+
+    ck::utils::set_host_num_threads(saved_num_threads);
+
+    EXPECT_TRUE(ck::utils::check_err(c_f_4, c_f_1, "Error: split-K depends on threads", 0, 0));
+}
@@ -0,0 +1,233 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cmath>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_thread_pool.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_layernorm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_layernorm_bwd.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_groupnorm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_groupnorm_bwd.hpp"
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+using ReferenceLayernorm2D = ck::tensor_operation::host::
+    ReferenceLayernorm<float, float, float, float, float, float, PassThrough, 2, 1>;
+using ReferenceLayernormBwd = ck::tensor_operation::host::
+    ReferenceLayernormBwd<float, float, float, float, float, float, float, float>;
+using ReferenceGroupnorm = ck::tensor_operation::host::
+    ReferenceGroupnorm<float, float, float, float, float, float, PassThrough>;
+using ReferenceGroupnormBwd = ck::tensor_operation::host::
+    ReferenceGroupnormBwd<float, float, float, float, float, float, float, float>;
+
+constexpr float Epsilon = 1e-5f;
+
+class TestReferenceNormalization : public ::testing::Test
+{
+    protected:
+    void SetUp() override { saved_num_threads_ = ck::utils::get_host_num_threads(); }
+
+    void TearDown() override { ck::utils::set_host_num_threads(saved_num_threads_); }
+
+    std::size_t saved_num_threads_;
+};
+
+struct LayernormResult
+{
+    Tensor<float> y_, mean_, inv_std_, dgamma_, dbeta_, dx_;
+};
+
+LayernormResult run_layernorm_2d(const Tensor<float>& x,
+                                 const Tensor<float>& gamma,
+                                 const Tensor<float>& beta,
+                                 const Tensor<float>& dy)
+{
+    const std::size_t M = x.GetLengths()[0];
+    const std::size_t N = x.GetLengths()[1];
+
+    const std::vector<ck::index_t> lengths{static_cast<ck::index_t>(M),
+                                           static_cast<ck::index_t>(N)};
+
+    LayernormResult result{Tensor<float>(x.mDesc),
+                           Tensor<float>({M}),
+                           Tensor<float>({M}),
+                           Tensor<float>({N}),
+                           Tensor<float>({N}),
+                           Tensor<float>(x.mDesc)};
+
+    ReferenceLayernorm2D::MakeInvoker().Run(ReferenceLayernorm2D::MakeArgument(x,
+                                                                               gamma,
+                                                                               beta,
+                                                                               result.y_,
+                                                                               result.mean_,
+                                                                               result.inv_std_,
+                                                                               PassThrough{},
+                                                                               lengths,
+                                                                               {1},
+                                                                               Epsilon));
+
+    ReferenceLayernormBwd::MakeInvoker().Run(ReferenceLayernormBwd::MakeArgument(dy,
+                                                                                 x,
+                                                                                 gamma,
+                                                                                 result.mean_,
+                                                                                 result.inv_std_,
+                                                                                 result.dgamma_,
+                                                                                 result.dbeta_,
+                                                                                 result.dx_,
+                                                                                 lengths));
+
+    return result;
+}
+
+} // namespace
+
+// rows longer than one reduction chunk are merged from several partial Welford results
+TEST_F(TestReferenceNormalization, LayernormMatchesTwoPass)
+{
+    const std::size_t M = 5;
+    const std::size_t N = 10000;
+
+    Tensor<float> x({M, N}), gamma({N}), beta({N}), dy({M, N});
+
+    ck::utils::FillUniformDistribution<float>{-1.f, 3.f}(x);
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(gamma);
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(beta);
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(dy);
+
+    const auto result = run_layernorm_2d(x, gamma, beta, dy);
+
+    Tensor<float> y_ref(x.mDesc), mean_ref({M}), inv_std_ref({M});
+
+    for(std::size_t m = 0; m < M; ++m)
+    {
+        double mean = 0;
+        for(std::size_t n = 0; n < N; ++n)
+            mean += x(m, n);
+        mean /= N;
+
+        double var = 0;
+        for(std::size_t n = 0; n < N; ++n)
+            var += (x(m, n) - mean) * (x(m, n) - mean);
+        var /= N;
+
+        const double inv_std = 1 / std::sqrt(var + Epsilon);
+
+        mean_ref(m)    = static_cast<float>(mean);
+        inv_std_ref(m) = static_cast<float>(inv_std);
+
+        for(std::size_t n = 0; n < N; ++n)
+            y_ref(m, n) = static_cast<float>((x(m, n) - mean) * inv_std * gamma(n) + beta(n));
+    }
+
+    EXPECT_TRUE(ck::utils::check_err(result.mean_, mean_ref, "Error: mean", 1e-5, 1e-5));
+    EXPECT_TRUE(ck::utils::check_err(result.inv_std_, inv_std_ref, "Error: inv_std", 1e-5, 1e-5));
+    EXPECT_TRUE(ck::utils::check_err(result.y_, y_ref, "Error: y", 1e-4, 1e-4));
+}
+
+TEST_F(TestReferenceNormalization, GroupnormMatchesTwoPass)
+{
+    const std::size_t N = 2, H = 6, W = 5, G = 3, C = 4;
+
+    Tensor<float> x({N, H, W, G, C}), gamma({G, C}), beta({G, C}), y(x.mDesc), y_ref(x.mDesc);
+    Tensor<float> mean({N, G}), inv_std({N, G});
+
+    ck::utils::FillUniformDistribution<float>{-1.f, 3.f}(x);
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(gamma);
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(beta);
+
+    ReferenceGroupnorm::MakeInvoker().Run(ReferenceGroupnorm::MakeArgument(
+        x, gamma, beta, y, mean, inv_std, PassThrough{}, {2, 6, 5, 3, 4}, Epsilon));
+
+    const double reduce_size = H * W * C;
+
+    for(std::size_t n = 0; n < N; ++n)
+        for(std::size_t g = 0; g < G; ++g)
+        {
+            double mean_val = 0;
+            for(std::size_t h = 0; h < H; ++h)
+                for(std::size_t w = 0; w < W; ++w)
+                    for(std::size_t c = 0; c < C; ++c)
+                        mean_val += x(n, h, w, g, c);
+            mean_val /= reduce_size;
+
+            double var = 0;
+            for(std::size_t h = 0; h < H; ++h)
+                for(std::size_t w = 0; w < W; ++w)
+                    for(std::size_t c = 0; c < C; ++c)
+                        var += (x(n, h, w, g, c) - mean_val) * (x(n, h, w, g, c) - mean_val);
+            var /= reduce_size;
+
+            for(std::size_t h = 0; h < H; ++h)
+                for(std::size_t w = 0; w < W; ++w)
+                    for(std::size_t c = 0; c < C; ++c)
+                        y_ref(n, h, w, g, c) = static_cast<float>(
+                            gamma(g, c) * (x(n, h, w, g, c) - mean_val) / std::sqrt(Epsilon + var) +
+                            beta(g, c));
+        }
+
+    EXPECT_TRUE(ck::utils::check_err(y, y_ref, "Error: y", 1e-4, 1e-4));
+}
+
+TEST_F(TestReferenceNormalization, IndependentOfThreadCount)
+{
+    const std::size_t M = 9;
+    const std::size_t N = 5000;
+
+    Tensor<float> x({M, N}), gamma({N}), beta({N}), dy({M, N});
+
+    ck::utils::FillUniformDistribution<float>{-1.f, 3.f}(x);
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(gamma);
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(beta);
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(dy);
+
+    ck::utils::set_host_num_threads(1);
+    const auto serial = run_layernorm_2d(x, gamma, beta, dy);
+
+    ck::utils::set_host_num_threads(4);
+    const auto parallel = run_layernorm_2d(x, gamma, beta, dy);
+
+    EXPECT_TRUE(ck::utils::check_err(parallel.y_, serial.y_, "Error: y", 0, 0));
+    EXPECT_TRUE(ck::utils::check_err(parallel.mean_, serial.mean_, "Error: mean", 0, 0));
+    EXPECT_TRUE(ck::utils::check_err(parallel.dgamma_, serial.dgamma_, "Error: dgamma", 0, 0));
+    EXPECT_TRUE(ck::utils::check_err(parallel.dbeta_, serial.dbeta_, "Error: dbeta", 0, 0));
+    EXPECT_TRUE(ck::utils::check_err(parallel.dx_, serial.dx_, "Error: dx", 0, 0));
+
+    const std::size_t B = 2, H = 7, W = 9, G = 4, C = 70;
+
+    Tensor<float> gn_x({B, H, W, G, C}), gn_dy(gn_x.mDesc), gn_gamma({G, C});
+    Tensor<float> gn_mean({B, G}), gn_inv_std({B, G});
+
+    ck::utils::FillUniformDistribution<float>{-1.f, 3.f}(gn_x);
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(gn_dy);
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(gn_gamma);
+    ck::utils::FillUniformDistribution<float>{0.5f, 1.5f}(gn_inv_std);
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(gn_mean);
+
+    auto run_groupnorm_bwd = [&](Tensor<float>& dgamma, Tensor<float>& dbeta, Tensor<float>& dx) {
+        ReferenceGroupnormBwd::MakeInvoker().Run(ReferenceGroupnormBwd::MakeArgument(
+            gn_dy, gn_x, gn_gamma, gn_mean, gn_inv_std, dgamma, dbeta, dx, {2, 7, 9, 4, 70}));
+    };
+
+    Tensor<float> dgamma_1({G, C}), dbeta_1({G, C}), dx_1(gn_x.mDesc);
+    Tensor<float> dgamma_4({G, C}), dbeta_4({G, C}), dx_4(gn_x.mDesc);
+
+    ck::utils::set_host_num_threads(1);
+    run_groupnorm_bwd(dgamma_1, dbeta_1, dx_1);
+
+    ck::utils::set_host_num_threads(4);
+    run_groupnorm_bwd(dgamma_4, dbeta_4, dx_4);
+
+    EXPECT_TRUE(ck::utils::check_err(dgamma_4, dgamma_1, "Error: groupnorm dgamma", 0, 0));
+    EXPECT_TRUE(ck::utils::check_err(dbeta_4, dbeta_1, "Error: groupnorm dbeta", 0, 0));
+    EXPECT_TRUE(ck::utils::check_err(dx_4, dx_1, "Error: groupnorm dx", 0, 0));
+}
@@ -0,0 +1,143 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdint>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/utility/host_thread_pool.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_avgpool_bwd.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_maxpool_bwd.hpp"
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+using ReferenceAvgPool3dBwd = ck::tensor_operation::host::ReferenceAvgPoolBwd<3, float, float>;
+using ReferenceMaxPoolBwd =
+    ck::tensor_operation::host::ReferenceMaxPoolBwd<float, int32_t, float, float, PassThrough>;
+
+class TestReferencePoolBwd : public ::testing::Test
+{
+    protected:
+    void SetUp() override { saved_num_threads_ = ck::utils::get_host_num_threads(); }
+
+    void TearDown() override { ck::utils::set_host_num_threads(saved_num_threads_); }
+
+    std::size_t saved_num_threads_;
+};
+
+// [N, C, D, H, W] lengths, in NDHWC memory order
+HostTensorDescriptor make_ndhwc_descriptor(std::size_t N,
+                                           std::size_t C,
+                                           std::size_t D,
+                                           std::size_t H,
+                                           std::size_t W)
+{
+    return HostTensorDescriptor(std::vector<std::size_t>{N, C, D, H, W},
+                                std::vector<std::size_t>{D * H * W * C, 1, H * W * C, W * C, C});
+}
+
+} // namespace
+
+// overlapping, dilated and padded windows
+TEST_F(TestReferencePoolBwd, AvgPoolMatchesScatter)
+{
+    const std::size_t N = 2, C = 3, Di = 5, Hi = 9, Wi = 11;
+
+    const std::vector<ck::index_t> lengths{2, 3, 4}, strides{1, 2, 1}, dilations{2, 1, 2},
+        left_pads{1, 1, 2}, right_pads{0, 1, 1};
+
+    const std::vector<std::size_t> in_lengths{Di, Hi, Wi};
+    std::vector<std::size_t> out_lengths(3);
+
+    for(std::size_t k = 0; k < 3; ++k)
+    {
+        const std::size_t window = (lengths[k] - 1) * dilations[k] + 1;
+        out_lengths[k] = (in_lengths[k] + left_pads[k] + right_pads[k] - window) / strides[k] + 1;
+    }
+
+    const std::size_t Do = out_lengths[0], Ho = out_lengths[1], Wo = out_lengths[2];
+
+    Tensor<float> dout(make_ndhwc_descriptor(N, C, Do, Ho, Wo));
+    Tensor<float> din(make_ndhwc_descriptor(N, C, Di, Hi, Wi));
+    Tensor<float> din_ref(HostTensorDescriptor({N, C, Di, Hi, Wi}));
+
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(dout);
+    din_ref.SetZero();
+
+    ReferenceAvgPool3dBwd::MakeInvoker().Run(ReferenceAvgPool3dBwd::MakeArgument(
+        din, dout, lengths, strides, dilations, left_pads, right_pads));
+
+    const float window_size = lengths[0] * lengths[1] * lengths[2];
+
+    for(std::size_t n = 0; n < N; ++n)
+        for(std::size_t c = 0; c < C; ++c)
+            for(std::size_t do_ = 0; do_ < Do; ++do_)
+                for(std::size_t ho = 0; ho < Ho; ++ho)
+                    for(std::size_t wo = 0; wo < Wo; ++wo)
+                        for(ck::index_t z = 0; z < lengths[0]; ++z)
+                            for(ck::index_t y = 0; y < lengths[1]; ++y)
+                                for(ck::index_t x = 0; x < lengths[2]; ++x)
+                                {
+                                    const auto di = static_cast<int64_t>(do_ * strides[0]) +
+                                                    z * dilations[0] - left_pads[0];
+                                    const auto hi = static_cast<int64_t>(ho * strides[1]) +
+                                                    y * dilations[1] - left_pads[1];
+                                    const auto wi = static_cast<int64_t>(wo * strides[2]) +
+                                                    x * dilations[2] - left_pads[2];
+
+                                    if(di >= 0 && di < static_cast<int64_t>(Di) && hi >= 0 &&
+                                       hi < static_cast<int64_t>(Hi) && wi >= 0 &&
+                                       wi < static_cast<int64_t>(Wi))
+                                    {
+                                        din_ref(n, c, di, hi, wi) +=
+                                            dout(n, c, do_, ho, wo) / window_size;
+                                    }
+                                }
+
+    Tensor<float> din_ncdhw(din_ref.mDesc);
+
+    din_ncdhw.ForEach([&](auto& self, auto idx) { self(idx) = din(idx); });
+
+    EXPECT_TRUE(ck::utils::check_err(din_ncdhw, din_ref, "Error: din", 1e-5, 1e-5));
+}
+
+// several outputs scatter to the same input, indices out of range are skipped
+TEST_F(TestReferencePoolBwd, MaxPoolIndependentOfThreadCount)
+{
+    const int32_t din_length = 1000, dout_length = 5000;
+
+    Tensor<float> dout({dout_length});
+    Tensor<int32_t> indices({dout_length});
+
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(dout);
+    indices.GenerateTensorValue(GeneratorTensor_2<int32_t>{-2, din_length + 2});
+
+    std::vector<float> din_ref(din_length, 0.f);
+
+    for(int32_t i = 0; i < dout_length; ++i)
+    {
+        if(indices.mData[i] >= 0 && indices.mData[i] < din_length)
+            din_ref[indices.mData[i]] += dout.mData[i];
+    }
+
+    for(const std::size_t num_thread : {1, 4})
+    {
+        ck::utils::set_host_num_threads(num_thread);
+
+        Tensor<float> din({din_length});
+
+        ReferenceMaxPoolBwd::MakeInvoker().Run(
+            ReferenceMaxPoolBwd::MakeArgument(dout, indices, din, PassThrough{}));
+
+        EXPECT_TRUE(ck::utils::check_err(din.mData, din_ref, "Error: din", 0, 0));
+    }
+}
@@ -0,0 +1,162 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_thread_pool.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_softmax.hpp"
+
+namespace {
+
+using ReferenceSoftmax = ck::tensor_operation::host::ReferenceSoftmax<float, float, float>;
+
+class TestReferenceSoftmax : public ::testing::Test
+{
+    protected:
+    void SetUp() override { saved_num_threads_ = ck::utils::get_host_num_threads(); }
+
+    void TearDown() override { ck::utils::set_host_num_threads(saved_num_threads_); }
+
+    std::size_t saved_num_threads_;
+};
+
+// the former scalar loop: max, exp(x - max) and sum tensors, each filled by a pass over every
+// element of the input
+void softmax_scalar(const Tensor<float>& in,
+                    Tensor<float>& out,
+                    float alpha,
+                    float beta,
+                    const std::vector<ck::index_t>& reduce_dims)
+{
+    std::vector<std::size_t> scalar_dims;
+    std::vector<std::size_t> scalar_lengths;
+
+    for(std::size_t i = 0; i < in.GetNumOfDimension(); ++i)
+    {
+        if(std::find(reduce_dims.begin(), reduce_dims.end(), i) == reduce_dims.end())
+        {
+            scalar_dims.push_back(i);
+            scalar_lengths.push_back(in.GetLengths()[i]);
+        }
+    }
+
+    if(scalar_dims.empty())
+    {
+        scalar_lengths.push_back(1);
+    }
+
+    Tensor<float> reduce_max(scalar_lengths);
+    Tensor<float> reduce_sum(scalar_lengths);
+    Tensor<float> in_stable(in.mDesc);
+
+    std::fill(reduce_max.begin(), reduce_max.end(), std::numeric_limits<float>::lowest());
+    std::fill(reduce_sum.begin(), reduce_sum.end(), 0.f);
+
+    auto to_scalar_idx = [&](const std::vector<std::size_t>& idx) {
+        std::vector<std::size_t> scalar_idx;
+        for(std::size_t dim : scalar_dims)
+        {
+            scalar_idx.push_back(idx[dim]);
+        }
+        return scalar_idx;
+    };
+
+    in.ForEach([&](auto& self, auto idx) {
+        reduce_max(to_scalar_idx(idx)) = std::max(reduce_max(to_scalar_idx(idx)), self(idx));
+    });
+
+    in_stable.ForEach([&](auto& self, auto idx) {
+        self(idx) = std::exp(in(idx) - reduce_max(to_scalar_idx(idx)));
+    });
+
+    in_stable.ForEach([&](auto& self, auto idx) { reduce_sum(to_scalar_idx(idx)) += self(idx); });
+
+    out.ForEach([&](auto& self, auto idx) {
+        self(idx) = alpha * in_stable(idx) / reduce_sum(to_scalar_idx(idx)) + beta * self(idx);
+    });
+}
+
+void softmax(const Tensor<float>& in,
+             Tensor<float>& out,
+             float alpha,
+             float beta,
+             const std::vector<ck::index_t>& reduce_dims)
+{
+    ReferenceSoftmax ref;
+
+    ref.MakeInvoker().Run(ref.MakeArgument(in, out, alpha, beta, reduce_dims));
+}
+
+} // namespace
+
+// innermost, outer, middle, several and all dims, with and without beta
+TEST_F(TestReferenceSoftmax, MatchesScalarLoop)
+{
+    const std::vector<std::vector<ck::index_t>> reduce_dims_list{
+        {3}, {0}, {1}, {1, 3}, {0, 2}, {2, 1}, {0, 1, 2, 3}};
+
+    Tensor<float> in({3, 4, 5, 33});
+
+    ck::utils::FillUniformDistribution<float>{-8.f, 8.f}(in);
+
+    for(const auto& reduce_dims : reduce_dims_list)
+    {
+        for(const float beta : {0.f, 0.5f})
+        {
+            Tensor<float> out(in.mDesc);
+            ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(out);
+
+            Tensor<float> out_ref(out);
+
+            softmax(in, out, 1.5f, beta, reduce_dims);
+            softmax_scalar(in, out_ref, 1.5f, beta, reduce_dims);
+
+            EXPECT_TRUE(ck::utils::check_err(out, out_ref, "Error: softmax", 1e-5, 1e-6))
+                << "reduce dims " << reduce_dims.size() << ", first " << reduce_dims[0]
+                << ", beta " << beta;
+        }
+    }
+}
+
+// a reduction over a strided (non-innermost) dim of a transposed input and output
+TEST_F(TestReferenceSoftmax, StridedTensors)
+{
+    Tensor<float> in(std::vector<std::size_t>{6, 7, 40}, std::vector<std::size_t>{1, 240, 6});
+    Tensor<float> out(in.mDesc);
+
+    ck::utils::FillUniformDistribution<float>{-4.f, 4.f}(in);
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(out);
+
+    Tensor<float> out_ref(out);
+
+    softmax(in, out, 1.f, 1.f, {2});
+    softmax_scalar(in, out_ref, 1.f, 1.f, {2});
+
+    EXPECT_TRUE(ck::utils::check_err(out, out_ref, "Error: softmax", 1e-5, 1e-6));
+}
+
+TEST_F(TestReferenceSoftmax, IndependentOfThreadCount)
+{
+    Tensor<float> in({64, 3, 129});
+
+    ck::utils::FillUniformDistribution<float>{-8.f, 8.f}(in);
+
+    Tensor<float> out_1(in.mDesc), out_4(in.mDesc);
+
+    ck::utils::set_host_num_threads(1);
+    softmax(in, out_1, 1.f, 0.f, {0, 2});
+
+    ck::utils::set_host_num_threads(4);
+    softmax(in, out_4, 1.f, 0.f, {0, 2});
+
+    EXPECT_TRUE(ck::utils::check_err(out_4, out_1, "Error: softmax", 0, 0));
+}
@@ -0,0 +1,152 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/utility/host_thread_pool.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_sparse_embedding3_forward_layernorm.hpp"
+
+namespace {
+
+using ReferenceEmbeddings2 = ck::tensor_operation::host::
+    ReferenceSparseEmbeddingsForwardLayernorm<float, int64_t, float, float, float, float, 2>;
+using ReferenceEmbeddings3 = ck::tensor_operation::host::
+    ReferenceSparseEmbeddingsForwardLayernorm<float, int64_t, float, float, float, float, 3>;
+using ReferenceEmbedding3 = ck::tensor_operation::host::
+    ReferenceSparseEmbedding3ForwardLayernorm<float, int64_t, float, float, float, float>;
+
+static_assert(ReferenceEmbeddings2::IsValidCompilationParameter());
+// float indices
+static_assert(!ck::tensor_operation::host::ReferenceSparseEmbeddingsForwardLayernorm<
+              float, float, float, float, float, float, 2>::IsValidCompilationParameter());
+
+constexpr float Epsilon = 1e-4f;
+
+class TestReferenceSparseEmbedding : public ::testing::Test
+{
+    protected:
+    void SetUp() override { saved_num_threads_ = ck::utils::get_host_num_threads(); }
+
+    void TearDown() override { ck::utils::set_host_num_threads(saved_num_threads_); }
+
+    std::size_t saved_num_threads_;
+};
+
+} // namespace
+
+TEST_F(TestReferenceSparseEmbedding, MatchesTwoPass)
+{
+    const std::size_t E = 50, D = 300, L = 70;
+
+    Tensor<float> emb_a({E, D}), emb_b({E, D}), gamma({D}), beta({D}), out({L, D});
+    Tensor<int64_t> index_a({L}), index_b({L});
+
+    ck::utils::FillUniformDistribution<float>{-1.f, 3.f}(emb_a);
+    ck::utils::FillUniformDistribution<float>{-1.f, 3.f}(emb_b);
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(gamma);
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(beta);
+    index_a.GenerateTensorValue(GeneratorTensor_2<int64_t>{0, E});
+    index_b.GenerateTensorValue(GeneratorTensor_2<int64_t>{0, E});
+
+    ReferenceEmbeddings2::MakeInvoker().Run(ReferenceEmbeddings2::MakeArgument(
+        out, {emb_a, emb_b}, {index_a, index_b}, gamma, beta, E, D, L, Epsilon));
+
+    Tensor<float> out_ref({L, D});
+
+    for(std::size_t i = 0; i < L; ++i)
+    {
+        double mean = 0;
+        for(std::size_t d = 0; d < D; ++d)
+            mean += emb_a(index_a(i), d) + emb_b(index_b(i), d);
+        mean /= D;
+
+        double var = 0;
+        for(std::size_t d = 0; d < D; ++d)
+        {
+            const double x = emb_a(index_a(i), d) + emb_b(index_b(i), d);
+            var += (x - mean) * (x - mean);
+        }
+        var /= D;
+
+        for(std::size_t d = 0; d < D; ++d)
+        {
+            const double x = emb_a(index_a(i), d) + emb_b(index_b(i), d);
+            out_ref(i, d) =
+                static_cast<float>((x - mean) / std::sqrt(var + Epsilon) * gamma(d) + beta(d));
+        }
+    }
+
+    EXPECT_TRUE(ck::utils::check_err(out, out_ref, "Error: out", 1e-4, 1e-4));
+}
+
+// the three-table operator is the N-table one, whatever the number of threads
+TEST_F(TestReferenceSparseEmbedding, ThreeTablesIndependentOfThreadCount)
+{
+    const std::size_t E = 40, D = 128, L = 33;
+
+    Tensor<float> emb_a({E, D}), emb_b({E, D}), emb_c({E, D}), gamma({D}), beta({D});
+    Tensor<int64_t> index_a({L}), index_b({L}), index_c({L});
+
+    for(auto* emb : {&emb_a, &emb_b, &emb_c})
+        ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(*emb);
+    for(auto* index : {&index_a, &index_b, &index_c})
+        index->GenerateTensorValue(GeneratorTensor_2<int64_t>{0, E});
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(gamma);
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(beta);
+
+    Tensor<float> out_1({L, D}), out_4({L, D});
+
+    ck::utils::set_host_num_threads(1);
+    ReferenceEmbedding3::MakeInvoker().Run(ReferenceEmbedding3::MakeArgument(out_1,
+                                                                             emb_a,
+                                                                             emb_b,
+                                                                             emb_c,
+                                                                             index_a,
+                                                                             index_b,
+                                                                             index_c,
+                                                                             gamma,
+                                                                             beta,
+                                                                             E,
+                                                                             D,
+                                                                             L,
+                                                                             Epsilon));
+
+    ck::utils::set_host_num_threads(4);
+    ReferenceEmbeddings3::MakeInvoker().Run(
+        ReferenceEmbeddings3::MakeArgument(out_4,
+                                           {emb_a, emb_b, emb_c},
+                                           {index_a, index_b, index_c},
+                                           gamma,
+                                           beta,
+                                           E,
+                                           D,
+                                           L,
+                                           Epsilon));
+
+    EXPECT_TRUE(ck::utils::check_err(out_4, out_1, "Error: out", 0, 0));
+}
+
+TEST_F(TestReferenceSparseEmbedding, IndexOutOfRange)
+{
+    const std::size_t E = 8, D = 16, L = 4;
+
+    Tensor<float> emb_a({E, D}), emb_b({E, D}), gamma({D}), beta({D}), out({L, D});
+    Tensor<int64_t> index_a({L}), index_b({L});
+
+    index_a.SetZero();
+    index_b.SetZero();
+    index_b(2) = E;
+
+    EXPECT_THROW(ReferenceEmbeddings2::MakeInvoker().Run(ReferenceEmbeddings2::MakeArgument(
+                     out, {emb_a, emb_b}, {index_a, index_b}, gamma, beta, E, D, L, Epsilon)),
+                 std::runtime_error);
+}
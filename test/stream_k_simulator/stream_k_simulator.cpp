@@ -0,0 +1,180 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/grid/block_to_ctile_map.hpp"
+
+#include "ck/library/utility/stream_k_simulator.hpp"
+
+namespace {
+
+using ck::utils::StreamKProblem;
+using ck::utils::StreamKTileWork;
+
+constexpr uint32_t MPerBlock = 128;
+constexpr uint32_t NPerBlock = 128;
+constexpr uint32_t KPerBlock = 32;
+
+template <ck::StreamKReductionStrategy ReductionStrategy>
+using TileMap = ck::BlockToCTileMap_GemmStreamK<MPerBlock, NPerBlock, KPerBlock, ReductionStrategy>;
+
+std::vector<StreamKProblem> get_problems()
+{
+    // {M, N, K, ..., num_cu, occupancy}: fewer tiles than CUs, tiles left over after full
+    // dispatches, and K not a multiple of KPerBlock
+    return {{256, 256, 4096, MPerBlock, NPerBlock, KPerBlock, 8, 1},
+            {1024, 640, 1000, MPerBlock, NPerBlock, KPerBlock, 8, 2},
+            {1280, 1280, 2048, MPerBlock, NPerBlock, KPerBlock, 12, 2},
+            {1920, 1024, 512, MPerBlock, NPerBlock, KPerBlock, 16, 3},
+            {3840, 4096, 96, MPerBlock, NPerBlock, KPerBlock, 104, 2}};
+}
+
+// tiles of a block, one tile at a time, from the iteration range and the tile indices of the map
+template <typename Map>
+std::vector<StreamKTileWork> get_tile_map_block_work(const Map& map, uint32_t block_idx)
+{
+    uint32_t iter_start = 0, iter_end = 0;
+    map.get_block_itr(block_idx, iter_start, iter_end);
+
+    std::vector<StreamKTileWork> work;
+
+    while(iter_end > iter_start)
+    {
+        uint32_t tile_idx, iter_offset;
+        map.get_tile_idx_with_offset(iter_end - 1, tile_idx, iter_offset);
+
+        const uint32_t current_iter_length = std::min(iter_offset + 1, iter_end - iter_start);
+        iter_offset = iter_offset + 1 - current_iter_length;
+
+        work.push_back({tile_idx, iter_offset, iter_offset + current_iter_length});
+
+        iter_end -= current_iter_length;
+    }
+
+    return work;
+}
+
+template <ck::StreamKReductionStrategy ReductionStrategy>
+void check_tile_map(StreamKProblem problem, uint32_t sk_num_blocks)
+{
+    problem.reduction_ = ReductionStrategy == ck::StreamKReductionStrategy::Reduction;
+
+    const TileMap<ReductionStrategy> map{
+        problem.M_, problem.N_, problem.K_, problem.num_cu_, problem.occupancy_, sk_num_blocks};
+
+    const auto schedule = ck::utils::make_stream_k_schedule(problem, sk_num_blocks);
+
+    ASSERT_EQ(schedule.sk_num_blocks_, map.sk_num_blocks);
+    ASSERT_EQ(schedule.sk_num_big_blocks_, map.sk_num_big_blocks);
+    ASSERT_EQ(schedule.dp_start_block_idx_, map.dp_start_block_idx);
+    ASSERT_EQ(schedule.reduction_start_block_idx_, map.reduction_start_block_idx);
+    ASSERT_EQ(schedule.k_iters_per_tile_, map.k_iters_per_tile.get());
+    ASSERT_EQ(schedule.grid_size_, map.get_grid_dims().x);
+
+    if(sk_num_blocks > 0)
+    {
+        ASSERT_EQ(schedule.k_iters_per_big_block_, map.k_iters_per_big_block);
+        ASSERT_EQ(schedule.sk_tiles_, map.get_sk_tiles());
+    }
+
+    for(uint32_t block_idx = 0; block_idx < schedule.reduction_start_block_idx_; ++block_idx)
+    {
+        // padding blocks return before they look at their iterations
+        if(block_idx >= schedule.sk_num_blocks_ && block_idx < schedule.dp_start_block_idx_)
+            continue;
+
+        EXPECT_EQ(ck::utils::get_stream_k_block_work(schedule, block_idx),
+                  get_tile_map_block_work(map, block_idx))
+            << "block " << block_idx << " with " << sk_num_blocks << " SK blocks";
+    }
+}
+
+} // namespace
+
+TEST(StreamKSimulator, MatchesTileMap)
+{
+    for(const auto& problem : get_problems())
+    {
+        const auto candidates = ck::utils::get_stream_k_sk_num_blocks_candidates(problem);
+
+        for(uint32_t sk_num_blocks : candidates)
+        {
+            check_tile_map<ck::StreamKReductionStrategy::Atomic>(problem, sk_num_blocks);
+
+            if(sk_num_blocks > 0)
+                check_tile_map<ck::StreamKReductionStrategy::Reduction>(problem, sk_num_blocks);
+        }
+
+        // the heuristic of the tile map picks one of the candidates
+        const TileMap<ck::StreamKReductionStrategy::Atomic> map{
+            problem.M_, problem.N_, problem.K_, problem.num_cu_, problem.occupancy_};
+
+        EXPECT_NE(std::find(candidates.begin(), candidates.end(), map.sk_num_blocks),
+                  candidates.end());
+    }
+}
+
+TEST(StreamKSimulator, Coverage)
+{
+    for(const auto& problem : get_problems())
+    {
+        for(uint32_t sk_num_blocks : ck::utils::get_stream_k_sk_num_blocks_candidates(problem))
+        {
+            const auto schedule = ck::utils::make_stream_k_schedule(problem, sk_num_blocks);
+
+            // every K iteration of every tile is computed by exactly one block
+            std::vector<int> num_visits(schedule.num_tiles_ * schedule.k_iters_per_tile_, 0);
+
+            for(uint32_t block_idx = 0; block_idx < schedule.grid_size_; ++block_idx)
+                for(const auto& work : ck::utils::get_stream_k_block_work(schedule, block_idx))
+                {
+                    ASSERT_LT(work.tile_idx_, schedule.num_tiles_);
+                    ASSERT_LE(work.iter_end_, schedule.k_iters_per_tile_);
+
+                    for(uint32_t i = work.iter_begin_; i < work.iter_end_; ++i)
+                        ++num_visits[work.tile_idx_ * schedule.k_iters_per_tile_ + i];
+                }
+
+            EXPECT_TRUE(std::all_of(
+                num_visits.begin(), num_visits.end(), [](int n) { return n == 1; }))
+                << sk_num_blocks << " SK blocks";
+        }
+    }
+}
+
+TEST(StreamKSimulator, Tune)
+{
+    // 4 tiles of 128 iterations on 16 CUs: DP leaves 12 CUs idle
+    StreamKProblem problem{256, 256, 4096, MPerBlock, NPerBlock, KPerBlock, 16, 1};
+
+    const ck::utils::StreamKCostModel cost;
+
+    const auto dp_only = ck::utils::simulate_stream_k(problem, 0, cost);
+
+    EXPECT_DOUBLE_EQ(dp_only.makespan_, 128 + cost.tile_store_time_);
+    EXPECT_DOUBLE_EQ(dp_only.dp_time_, dp_only.makespan_);
+    EXPECT_EQ(dp_only.sk_time_, 0);
+
+    const auto result = ck::utils::tune_stream_k(problem, cost);
+
+    ASSERT_EQ(result.candidates_.size(),
+              ck::utils::get_stream_k_sk_num_blocks_candidates(problem).size());
+    EXPECT_GT(result.best_.sk_num_blocks_, 0);
+    EXPECT_LT(result.best_.makespan_, dp_only.makespan_);
+
+    for(const auto& candidate : result.candidates_)
+        EXPECT_LE(result.best_.makespan_, candidate.makespan_);
+
+    // the reductions wait for the partial tiles
+    problem.reduction_ = true;
+
+    const auto reduction = ck::utils::simulate_stream_k(problem, result.best_.sk_num_blocks_, cost);
+
+    EXPECT_GT(reduction.reduction_time_, reduction.sk_time_);
+    EXPECT_DOUBLE_EQ(reduction.makespan_, reduction.reduction_time_);
+}
@@ -0,0 +1,241 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_description/tensor_descriptor.hpp"
+#include "ck/tensor_description/tensor_descriptor_helper.hpp"
+#include "ck/tensor_description/tensor_descriptor_flatten.hpp"
+
+using namespace ck;
+
+namespace {
+
+constexpr auto I1 = Number<1>{};
+constexpr auto I2 = Number<2>{};
+constexpr auto I3 = Number<3>{};
+constexpr auto I4 = Number<4>{};
+constexpr auto I5 = Number<5>{};
+constexpr auto I6 = Number<6>{};
+
+// flat maps every index of desc to the same validity and offset, by make_tensor_coordinate() and
+// by move_tensor_coordinate() along the innermost dimension
+template <typename Desc, typename FlatDesc>
+void check_equivalent(const Desc& desc, const FlatDesc& flat)
+{
+    constexpr index_t ndim = Desc::GetNumOfDimension();
+
+    static_assert(FlatDesc::GetNumOfDimension() == ndim);
+
+    std::vector<index_t> lengths(ndim);
+
+    static_for<0, ndim, 1>{}([&](auto i) {
+        lengths[i] = desc.GetLength(i);
+
+        EXPECT_EQ(flat.GetLength(i), lengths[i]) << "dimension " << i.value;
+    });
+
+    index_t num_elem = 1;
+
+    for(const index_t length : lengths)
+    {
+        num_elem *= length;
+    }
+
+    const auto step_idx =
+        generate_tuple([](auto i) { return index_t{i.value == ndim - 1}; }, Number<ndim>{});
+
+    const auto step      = make_tensor_coordinate_step(desc, step_idx);
+    const auto flat_step = make_tensor_coordinate_step(flat, step_idx);
+
+    auto moved      = make_tensor_coordinate(desc, make_zero_multi_index<ndim>());
+    auto flat_moved = make_tensor_coordinate(flat, make_zero_multi_index<ndim>());
+
+    for(index_t e = 0; e < num_elem; ++e)
+    {
+        auto idx = make_zero_multi_index<ndim>();
+
+        index_t r = e;
+
+        static_for<ndim, 0, -1>{}([&](auto i_p1) {
+            constexpr auto i = i_p1 - I1;
+
+            idx(i) = r % lengths[i];
+            r /= lengths[i];
+        });
+
+        const auto coord      = make_tensor_coordinate(desc, idx);
+        const auto flat_coord = make_tensor_coordinate(flat, idx);
+
+        const bool valid = coordinate_has_valid_offset(desc, coord);
+
+        ASSERT_EQ(coordinate_has_valid_offset(flat, flat_coord), valid) << "element " << e;
+
+        if(valid)
+        {
+            ASSERT_EQ(flat_coord.GetOffset(), coord.GetOffset()) << "element " << e;
+        }
+
+        if(idx[Number<ndim - 1>{}] == 0)
+        {
+            moved      = coord;
+            flat_moved = flat_coord;
+        }
+        else
+        {
+            move_tensor_coordinate(desc, moved, step);
+            move_tensor_coordinate(flat, flat_moved, flat_step);
+
+            if(valid)
+            {
+                ASSERT_EQ(moved.GetOffset(), coord.GetOffset()) << "element " << e;
+                ASSERT_EQ(flat_moved.GetOffset(), coord.GetOffset()) << "element " << e;
+            }
+        }
+    }
+}
+
+} // namespace
+
+TEST(TensorDescriptorFlatten, UnMergeReorder)
+{
+    const auto desc_m_k = make_naive_tensor_descriptor(make_tuple(4, 5), make_tuple(10, 1));
+
+    const auto desc_m0_k_m1 = transform_tensor_descriptor(
+        desc_m_k,
+        make_tuple(make_unmerge_transform(make_tuple(2, 2)), make_pass_through_transform(5)),
+        make_tuple(Sequence<0>{}, Sequence<1>{}),
+        make_tuple(Sequence<0, 2>{}, Sequence<1>{}));
+
+    const auto flat = flatten_tensor_descriptor(desc_m0_k_m1);
+
+    static_assert(decltype(flat)::GetNumOfTransform() == 1);
+
+    check_equivalent(desc_m0_k_m1, flat);
+}
+
+TEST(TensorDescriptorFlatten, KnownAtCompileTime)
+{
+    constexpr auto desc = make_naive_tensor_descriptor_packed(make_tuple(I4, I6, I5));
+
+    constexpr auto desc_sliced = transform_tensor_descriptor(
+        desc,
+        make_tuple(make_slice_transform(I4, I1, I3),
+                   make_unmerge_transform(make_tuple(I2, I3)),
+                   make_freeze_transform(I2)),
+        make_tuple(Sequence<0>{}, Sequence<1>{}, Sequence<2>{}),
+        make_tuple(Sequence<1>{}, Sequence<0, 2>{}, Sequence<>{}));
+
+    constexpr auto flat = flatten_tensor_descriptor(desc_sliced);
+
+    static_assert(decltype(flat)::IsKnownAtCompileTime());
+    static_assert(decltype(flat)::GetNumOfTransform() == 2);
+
+    check_equivalent(desc_sliced, flat);
+}
+
+// the Pad keeps its validity check, the affine transforms above it are collapsed
+TEST(TensorDescriptorFlatten, PadKept)
+{
+    const auto desc = make_naive_tensor_descriptor(make_tuple(3, 7, 5), make_tuple(40, 5, 1));
+
+    const auto desc_padded = transform_tensor_descriptor(
+        desc,
+        make_tuple(make_pass_through_transform(3),
+                   make_pad_transform(7, 1, 2),
+                   make_pass_through_transform(5)),
+        make_tuple(Sequence<0>{}, Sequence<1>{}, Sequence<2>{}),
+        make_tuple(Sequence<0>{}, Sequence<1>{}, Sequence<2>{}));
+
+    const auto desc_merged = transform_tensor_descriptor(
+        desc_padded,
+        make_tuple(make_merge_transform(make_tuple(3, 10)),
+                   make_unmerge_transform(make_tuple(5, 1))),
+        make_tuple(Sequence<0, 1>{}, Sequence<2>{}),
+        make_tuple(Sequence<0>{}, Sequence<1, 2>{}));
+
+    const auto flat = flatten_tensor_descriptor(desc_merged);
+
+    static_assert(decltype(flat)::GetNumOfTransform() == 3);
+
+    check_equivalent(desc_merged, flat);
+}
+
+// an affine group rooted at the upper dimension of a Merge
+TEST(TensorDescriptorFlatten, AboveMerge)
+{
+    const auto desc = make_naive_tensor_descriptor(make_tuple(6, 4), make_tuple(9, 2));
+
+    const auto desc_merged = transform_tensor_descriptor(
+        desc,
+        make_tuple(make_merge_transform_v3_division_mod(make_tuple(6, 4))),
+        make_tuple(Sequence<0, 1>{}),
+        make_tuple(Sequence<0>{}));
+
+    const auto desc_unmerged =
+        transform_tensor_descriptor(desc_merged,
+                                    make_tuple(make_unmerge_transform(make_tuple(3, 8))),
+                                    make_tuple(Sequence<0>{}),
+                                    make_tuple(Sequence<0, 1>{}));
+
+    const auto desc_sliced = transform_tensor_descriptor(
+        desc_unmerged,
+        make_tuple(make_slice_transform(3, 1, 3), make_pass_through_transform(8)),
+        make_tuple(Sequence<0>{}, Sequence<1>{}),
+        make_tuple(Sequence<1>{}, Sequence<0>{}));
+
+    const auto flat = flatten_tensor_descriptor(desc_sliced);
+
+    static_assert(decltype(flat)::GetNumOfTransform() == 4);
+
+    check_equivalent(desc_sliced, flat);
+}
+
+TEST(TensorDescriptorFlatten, MergeUnMerge)
+{
+    constexpr auto desc =
+        make_naive_tensor_descriptor(make_tuple(I4, I6), make_tuple(Number<8>{}, I1));
+
+    constexpr auto desc_merged =
+        transform_tensor_descriptor(desc,
+                                    make_tuple(make_merge_transform(make_tuple(I4, I6))),
+                                    make_tuple(Sequence<0, 1>{}),
+                                    make_tuple(Sequence<0>{}));
+
+    constexpr auto desc_unmerged =
+        transform_tensor_descriptor(desc_merged,
+                                    make_tuple(make_unmerge_transform(make_tuple(I4, I6))),
+                                    make_tuple(Sequence<0>{}),
+                                    make_tuple(Sequence<0, 1>{}));
+
+    constexpr auto flat = flatten_tensor_descriptor(desc_unmerged);
+
+    static_assert(decltype(flat)::GetNumOfTransform() == 1);
+
+    check_equivalent(desc_unmerged, flat);
+}
+
+TEST(TensorDescriptorFlatten, UnMergeMerge)
+{
+    const auto desc = make_naive_tensor_descriptor(make_tuple(24, 3), make_tuple(1, 30));
+
+    const auto desc_unmerged = transform_tensor_descriptor(
+        desc,
+        make_tuple(make_unmerge_transform(make_tuple(I4, I6)), make_pass_through_transform(3)),
+        make_tuple(Sequence<0>{}, Sequence<1>{}),
+        make_tuple(Sequence<0, 1>{}, Sequence<2>{}));
+
+    const auto desc_merged = transform_tensor_descriptor(
+        desc_unmerged,
+        make_tuple(make_merge_transform(make_tuple(I4, I6)), make_pass_through_transform(3)),
+        make_tuple(Sequence<0, 1>{}, Sequence<2>{}),
+        make_tuple(Sequence<1>{}, Sequence<0>{}));
+
+    const auto flat = flatten_tensor_descriptor(desc_merged);
+
+    static_assert(decltype(flat)::GetNumOfTransform() == 1);
+
+    check_equivalent(desc_merged, flat);
+}
@@ -0,0 +1,229 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2023-2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <numeric>
+#include <cstdlib>
+#include <iostream>
+#include <initializer_list>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/host_thread_group.hpp"
+#include "ck/utility/common_header.hpp"
+#include "ck/wrapper/layout.hpp"
+#include "ck/wrapper/tensor.hpp"
+#include "ck/wrapper/operations/copy.hpp"
+
+// Host counterpart of TestCopyDevice: copy from Global to Global through LDS and VGPR
+template <typename InputTensor,
+          typename OutputTensor,
+          typename BlockShape,
+          typename ThreadLayoutShape,
+          typename LocalTileSteps,
+          typename LocalPartitionSteps>
+void TestCopyHost(const ck::wrapper::host::ThreadGroup& group,
+                  const InputTensor& input_tensor,
+                  OutputTensor& output_tensor,
+                  const BlockShape tile_shape,
+                  const ThreadLayoutShape thread_layout,
+                  const LocalTileSteps block_steps,
+                  const LocalPartitionSteps thread_steps)
+{
+    std::vector<ck::index_t> p_shared(ck::wrapper::size(tile_shape));
+    auto tensor_lds = ck::wrapper::make_tensor<ck::wrapper::MemoryTypeEnum::Lds>(
+        p_shared.data(), ck::wrapper::make_layout(tile_shape));
+
+    const auto block_idxs = ck::make_tuple(ck::make_tuple(0, 0), group.GetBlockId());
+
+    // Get local tiles for global memory
+    const auto input_local_tile =
+        ck::wrapper::make_local_tile(input_tensor, tile_shape, block_idxs, block_steps);
+    const auto output_local_tile =
+        ck::wrapper::make_local_tile(output_tensor, tile_shape, block_idxs, block_steps);
+
+    // Allocate VGPR of every thread
+    constexpr ck::index_t scalar_per_vector = 1;
+    constexpr ck::index_t vgpr_size =
+        ck::wrapper::size(tile_shape) / ck::wrapper::size(thread_layout);
+    using VgprTensor = decltype(ck::wrapper::make_register_tensor<ck::wrapper::MemoryTypeEnum::Vgpr,
+                                                                  vgpr_size,
+                                                                  scalar_per_vector,
+                                                                  ck::index_t>());
+    std::vector<VgprTensor> tensors_vgpr;
+    tensors_vgpr.reserve(group.GetNumThreads());
+
+    // Perform copy, with a barrier after each stage
+    group.ForEachThread([&](ck::index_t thread_id) {
+        const auto input_local_partition = ck::wrapper::make_local_partition(
+            input_local_tile, thread_layout, thread_id, thread_steps);
+        auto lds_local_partition =
+            ck::wrapper::make_local_partition(tensor_lds, thread_layout, thread_id, thread_steps);
+
+        ck::wrapper::copy(input_local_partition, lds_local_partition);
+    });
+
+    group.ForEachThread([&](ck::index_t thread_id) {
+        const auto lds_local_partition =
+            ck::wrapper::make_local_partition(tensor_lds, thread_layout, thread_id, thread_steps);
+
+        tensors_vgpr.push_back(ck::wrapper::make_register_tensor<ck::wrapper::MemoryTypeEnum::Vgpr,
+                                                                 vgpr_size,
+                                                                 scalar_per_vector,
+                                                                 ck::index_t>());
+        ck::wrapper::copy(lds_local_partition, tensors_vgpr.back());
+    });
+
+    group.ForEachThread([&](ck::index_t thread_id) {
+        auto output_local_partition = ck::wrapper::make_local_partition(
+            output_local_tile, thread_layout, thread_id, thread_steps);
+
+        ck::wrapper::copy(tensors_vgpr[thread_id], output_local_partition);
+    });
+}
+
+TEST(TestHostThreadGroup, CopyGlobalToGlobalViaLDS)
+{
+    const auto shape =
+        ck::make_tuple(ck::make_tuple(ck::Number<2>{}, ck::Number<2>{}), ck::Number<256>{});
+    const auto strides =
+        ck::make_tuple(ck::make_tuple(ck::Number<1>{}, ck::Number<2>{}), ck::Number<4>{});
+    const auto layout = ck::wrapper::make_layout(shape, strides);
+
+    // 0, 1, 2, ..., size(shape) - 1
+    std::vector<ck::index_t> input_data(ck::wrapper::size(shape));
+    std::iota(input_data.begin(), input_data.end(), 0);
+    std::vector<ck::index_t> output_data(ck::wrapper::size(shape), 0);
+
+    const auto input_tensor_global = ck::wrapper::make_tensor<ck::wrapper::MemoryTypeEnum::Global>(
+        static_cast<const ck::index_t*>(input_data.data()), layout);
+    auto output_tensor_global = ck::wrapper::make_tensor<ck::wrapper::MemoryTypeEnum::Global>(
+        output_data.data(), layout);
+
+    const auto thread_layout =
+        ck::make_tuple(ck::make_tuple(ck::Number<1>{}, ck::Number<1>{}), ck::Number<32>{});
+    const auto tile_shape =
+        ck::make_tuple(ck::make_tuple(ck::Number<2>{}, ck::Number<2>{}), ck::Number<64>{});
+
+    const auto thread_steps =
+        ck::make_tuple(ck::make_tuple(ck::Number<1>{}, ck::Number<1>{}), ck::Number<2>{});
+    const auto block_steps =
+        ck::make_tuple(ck::make_tuple(ck::Number<1>{}, ck::Number<1>{}), ck::Number<64>{});
+
+    const ck::index_t grid_size = ck::math::integer_divide_ceil(
+        ck::wrapper::size(input_tensor_global), ck::wrapper::size(tile_shape));
+
+    ck::wrapper::host::launch_host_kernel(
+        grid_size,
+        ck::wrapper::size(thread_layout),
+        [&](const ck::wrapper::host::ThreadGroup& group) {
+            TestCopyHost(group,
+                         input_tensor_global,
+                         output_tensor_global,
+                         tile_shape,
+                         thread_layout,
+                         block_steps,
+                         thread_steps);
+        });
+
+    EXPECT_TRUE(ck::utils::check_err(output_data, input_data));
+}
+
+// Lockstep copy of the tiles of a matrix by raked and packed thread partitions
+TEST(TestHostThreadGroup, CopyLockstep)
+{
+    const auto shape   = ck::make_tuple(ck::Number<64>{}, ck::Number<96>{});
+    const auto strides = ck::make_tuple(ck::Number<96>{}, ck::Number<1>{});
+    const auto layout  = ck::wrapper::make_layout(shape, strides);
+
+    std::vector<float> input_data(ck::wrapper::size(shape));
+    std::iota(input_data.begin(), input_data.end(), 0.f);
+
+    const auto input_tensor = ck::wrapper::make_tensor<ck::wrapper::MemoryTypeEnum::Global>(
+        static_cast<const float*>(input_data.data()), layout);
+
+    const auto tile_shape    = ck::make_tuple(ck::Number<16>{}, ck::Number<32>{});
+    const auto thread_layout = ck::make_tuple(ck::Number<4>{}, ck::Number<8>{});
+    const auto thread_steps  = ck::make_tuple(ck::Number<4>{}, ck::Number<4>{});
+
+    const ck::index_t num_tile_n = ck::wrapper::size<1>(shape) / ck::wrapper::size<1>(tile_shape);
+    const ck::index_t grid_size  = ck::wrapper::size(shape) / ck::wrapper::size(tile_shape);
+
+    for(const bool packed : {false, true})
+    {
+        std::vector<float> output_data(ck::wrapper::size(shape), 0.f);
+
+        auto output_tensor = ck::wrapper::make_tensor<ck::wrapper::MemoryTypeEnum::Global>(
+            output_data.data(), layout);
+
+        ck::wrapper::host::launch_host_kernel(
+            grid_size,
+            ck::wrapper::size(thread_layout),
+            [&](const ck::wrapper::host::ThreadGroup& group) {
+                const auto block_idxs = ck::make_tuple(group.GetBlockId() / num_tile_n,
+                                                       group.GetBlockId() % num_tile_n);
+
+                const auto input_tile =
+                    ck::wrapper::make_local_tile(input_tensor, tile_shape, block_idxs);
+                auto output_tile =
+                    ck::wrapper::make_local_tile(output_tensor, tile_shape, block_idxs);
+
+                if(packed)
+                {
+                    ck::wrapper::host::copy(
+                        group, input_tile, output_tile, thread_layout, thread_steps);
+                }
+                else
+                {
+                    ck::wrapper::host::copy(group, input_tile, output_tile, thread_layout);
+                }
+            });
+
+        EXPECT_TRUE(ck::utils::check_err(output_data, input_data)) << "packed: " << packed;
+    }
+}
+
+// Sum of each block by a tree reduction through LDS, with a barrier at each level
+TEST(TestHostThreadGroup, BlockReduction)
+{
+    constexpr ck::index_t block_size = 64;
+    constexpr ck::index_t grid_size  = 37;
+
+    const auto layout = ck::wrapper::make_layout(
+        ck::make_tuple(ck::Number<block_size>{}, grid_size),
+        ck::make_tuple(ck::Number<1>{}, ck::Number<block_size>{}));
+
+    std::vector<ck::index_t> input_data(block_size * grid_size);
+    std::iota(input_data.begin(), input_data.end(), 0);
+    std::vector<ck::index_t> block_sums(grid_size, 0);
+
+    const auto input_tensor = ck::wrapper::make_tensor<ck::wrapper::MemoryTypeEnum::Global>(
+        static_cast<const ck::index_t*>(input_data.data()), layout);
+
+    ck::wrapper::host::launch_host_kernel(
+        grid_size, block_size, [&](const ck::wrapper::host::ThreadGroup& group) {
+            std::vector<ck::index_t> p_shared(block_size);
+
+            group.ForEachThread([&](ck::index_t thread_id) {
+                p_shared[thread_id] = input_tensor(thread_id, group.GetBlockId());
+            });
+
+            for(ck::index_t stride = block_size / 2; stride > 0; stride /= 2)
+            {
+                group.ForEachThread([&](ck::index_t thread_id) {
+                    if(thread_id < stride)
+                    {
+                        p_shared[thread_id] += p_shared[thread_id + stride];
+                    }
+                });
+            }
+
+            block_sums[group.GetBlockId()] = p_shared[0];
+        });
+
+    for(ck::index_t block_id = 0; block_id < grid_size; block_id++)
+    {
+        const ck::index_t first = block_id * block_size;
+        EXPECT_EQ(block_sums[block_id], block_size * first + block_size * (block_size - 1) / 2);
+    }
+}